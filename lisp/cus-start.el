@@ -265,6 +265,10 @@ minibuffer-prompt-properties--setter
 	     ;; fileio.c
 	     (delete-by-moving-to-trash auto-save boolean "23.1")
 	     (auto-save-visited-file-name auto-save boolean)
+	     (large-file-mapping-threshold files
+					   (choice (const :tag "Never" nil)
+						   integer)
+					   "28.1")
 	     ;; filelock.c
 	     (create-lockfiles files boolean "24.3")
 	     (temporary-file-directory
@@ -22,17 +22,13 @@
 
 ;;; Commentary:
 
-;; The main exported function is `syntax-ppss'.  You might also need
-;; to call `syntax-ppss-flush-cache' or to add it to
-;; before-change-functions'(although this is automatically done by
-;; syntax-ppss when needed, but that might fail if syntax-ppss is
-;; called in a context where before-change-functions is temporarily
-;; let-bound to nil).
+;; The main exported function is `syntax-ppss'.  Its cache is kept by
+;; `parse-partial-sexp' and flushed automatically when the buffer is
+;; modified, but you might still need to call `syntax-ppss-flush-cache'
+;; if the way the buffer is parsed changes in some other way.
 
 ;;; Todo:
 
-;; - do something about the case where the syntax-table is changed.
-;;   This typically happens with tex-mode and its `$' operator.
 ;; - new functions `syntax-state', ... to replace uses of parse-partial-state
 ;;   with something higher-level (similar to syntax-ppss-context).
 ;; - interaction with mmm-mode.
@@ -444,37 +440,52 @@ syntax-ppss-context
    ((nth 4 ppss) 'comment)
    (t nil)))
 
-(defvar syntax-ppss-max-span 20000
-  "Threshold below which cache info is deemed unnecessary.
-We try to make sure that cache entries are at least this far apart
-from each other, to avoid keeping too much useless info.")
-
 (defvar syntax-begin-function nil
   "Function to move back outside of any comment/string/paren.
 This function should move the cursor back to some syntactically safe
 point (where the PPSS is equivalent to nil).")
 (make-obsolete-variable 'syntax-begin-function nil "25.1")
 
-;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
-;; Several caches.
-;;
-;; Because `syntax-ppss' is equivalent to (parse-partial-sexp
-;; (POINT-MIN) x), we need either to empty the cache when we narrow
-;; the buffer, which is suboptimal, or we need to use several caches.
-;; We use two of them, one for widened buffer, and one for narrowing.
-;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+;; The states computed by `syntax-ppss' are cached by
+;; `parse-partial-sexp' itself, see `parse-sexp-use-checkpoints'.  The
+;; cache is discarded automatically when the buffer text, its text
+;; properties or its syntax table change.
+
+(defvar syntax-ppss-max-span 20000
+  "This variable is obsolete and has no effect.")
+(make-obsolete-variable 'syntax-ppss-max-span nil "28.1")
 
 (defvar-local syntax-ppss-wide nil
-  "Cons of two elements (LAST . CACHE).
-Where LAST is a pair (LAST-POS . LAST-PPS) caching the last invocation
-and CACHE is a list of (POS . PPSS) pairs, in decreasing POS order.
-These are valid when the buffer has no restriction.")
+  "This variable is obsolete and has no effect.")
+(make-obsolete-variable 'syntax-ppss-wide nil "28.1")
 
 (defvar-local syntax-ppss-narrow nil
-  "Same as `syntax-ppss-wide' but for a narrowed buffer.")
+  "This variable is obsolete and has no effect.")
+(make-obsolete-variable 'syntax-ppss-narrow nil "28.1")
 
 (defvar-local syntax-ppss-narrow-start nil
-  "Start position of the narrowing for `syntax-ppss-narrow'.")
+  "This variable is obsolete and has no effect.")
+(make-obsolete-variable 'syntax-ppss-narrow-start nil "28.1")
+
+(defvar syntax-ppss-stats
+  [(0 . 0) (0 . 0) (0 . 0) (0 . 0) (0 . 0) (2 . 2500)]
+  "This variable is obsolete and is no longer updated.")
+(make-obsolete-variable 'syntax-ppss-stats nil "28.1")
+
+(defun syntax-ppss-stats ()
+  "This function is obsolete; `syntax-ppss' no longer records statistics."
+  (with-suppressed-warnings ((obsolete syntax-ppss-stats))
+    (mapcar (lambda (x)
+	      (condition-case nil
+		  (cons (car x) (/ (cdr x) (car x)))
+	        (error nil)))
+	    syntax-ppss-stats)))
+(make-obsolete 'syntax-ppss-stats nil "28.1")
+
+(defun syntax-ppss-debug ()
+  "This function is obsolete and returns nil."
+  nil)
+(make-obsolete 'syntax-ppss-debug nil "28.1")
 
 (define-obsolete-function-alias 'syntax-ppss-after-change-function
   #'syntax-ppss-flush-cache "27.1")
@@ -483,56 +494,7 @@ syntax-ppss-flush-cache
   ;; Set syntax-propertize to refontify anything past beg.
   (unless syntax-propertize--inhibit-flush
     (setq syntax-propertize--done (min beg syntax-propertize--done)))
-  ;; Flush invalid cache entries.
-  (dolist (cell (list syntax-ppss-wide syntax-ppss-narrow))
-    (pcase cell
-      (`(,last . ,cache)
-       (while (and cache (> (caar cache) beg))
-         (setq cache (cdr cache)))
-       ;; Throw away `last' value if made invalid.
-       (when (< beg (or (car last) 0))
-         ;; If syntax-begin-function jumped to BEG, then the old state at BEG can
-         ;; depend on the text after BEG (which is presumably changed).  So if
-         ;; BEG=(car (nth 10 syntax-ppss-last)) don't reuse that data because the
-         ;; assumed nil state at BEG may not be valid any more.
-         (if (<= beg (or (syntax-ppss-toplevel-pos (cdr last))
-                         (nth 3 last)
-                         0))
-	     (setq last nil)
-           (setcar last nil)))
-       ;; Unregister if there's no cache left.  Sadly this doesn't work
-       ;; because `before-change-functions' is temporarily bound to nil here.
-       ;; (unless cache
-       ;;   (remove-hook 'before-change-functions #'syntax-ppss-flush-cache t))
-       (setcar cell last)
-       (setcdr cell cache)))
-    ))
-
-;;; FIXME: Explain this variable.  Currently only its last (5th) slot is used.
-;;; Perhaps the other slots should be removed?
-(defvar syntax-ppss-stats
-  [(0 . 0) (0 . 0) (0 . 0) (0 . 0) (0 . 0) (2 . 2500)])
-(defun syntax-ppss-stats ()
-  (mapcar (lambda (x)
-	    (condition-case nil
-		(cons (car x) (/ (cdr x) (car x)))
-	      (error nil)))
-	  syntax-ppss-stats))
-(defun syntax-ppss--update-stats (i old new)
-  (let ((pair (aref syntax-ppss-stats i)))
-    (cl-incf (car pair))
-    (cl-incf (cdr pair) (- new old))))
-
-(defun syntax-ppss--data ()
-  (if (eq (point-min) 1)
-      (progn
-        (unless syntax-ppss-wide
-          (setq syntax-ppss-wide (cons nil nil)))
-        syntax-ppss-wide)
-    (unless (eq syntax-ppss-narrow-start (point-min))
-      (setq syntax-ppss-narrow-start (point-min))
-      (setq syntax-ppss-narrow (cons nil nil)))
-    syntax-ppss-narrow))
+  (parse-sexp-flush-checkpoints beg))
 
 (defun syntax-ppss (&optional pos)
   "Parse-Partial-Sexp State at POS, defaulting to point.
@@ -541,167 +503,18 @@ syntax-ppss
 in the returned list (counting from 0) cannot be relied upon.
 Point is at POS when this function returns.
 
-It is necessary to call `syntax-ppss-flush-cache' explicitly if
-this function is called while `before-change-functions' is
-temporarily let-bound, or if the buffer is modified without
-running the hook."
+The states are cached, so that this function takes time proportional
+to the distance between POS and a position where the state is already
+known.  It is necessary to call `syntax-ppss-flush-cache' explicitly
+only if the way the buffer is parsed changes without a change in its
+text, text properties or syntax table, for instance when a character
+of the syntax table is modified with `aset'."
   ;; Default values.
   (unless pos (setq pos (point)))
   (syntax-propertize pos)
-  ;;
   (with-syntax-table (or syntax-ppss-table (syntax-table))
-  (let* ((cell (syntax-ppss--data))
-         (ppss-last (car cell))
-         (ppss-cache (cdr cell))
-         (old-ppss (cdr ppss-last))
-         (old-pos (car ppss-last))
-         (ppss nil)
-         (pt-min (point-min)))
-    (if (and old-pos (> old-pos pos)) (setq old-pos nil))
-    ;; Use the OLD-POS if usable and close.  Don't update the `last' cache.
-    (condition-case nil
-	(if (and old-pos (< (- pos old-pos)
-			    ;; The time to use syntax-begin-function and
-			    ;; find PPSS is assumed to be about 2 * distance.
-			    (let ((pair (aref syntax-ppss-stats 5)))
-			      (/ (* 2 (cdr pair)) (car pair)))))
-	    (progn
-	      (syntax-ppss--update-stats 0 old-pos pos)
-	      (parse-partial-sexp old-pos pos nil nil old-ppss))
-
-	  (cond
-	   ;; Use OLD-PPSS if possible and close enough.
-	   ((and (not old-pos) old-ppss
-                 ;; If `pt-min' is too far from `pos', we could try to use
-		 ;; other positions in (nth 9 old-ppss), but that doesn't
-		 ;; seem to happen in practice and it would complicate this
-		 ;; code (and the before-change-function code even more).
-		 ;; But maybe it would be useful in "degenerate" cases such
-		 ;; as when the whole file is wrapped in a set
-		 ;; of parentheses.
-		 (setq pt-min (or (syntax-ppss-toplevel-pos old-ppss)
-				  (nth 2 old-ppss)))
-		 (<= pt-min pos) (< (- pos pt-min) syntax-ppss-max-span))
-	    (syntax-ppss--update-stats 1 pt-min pos)
-	    (setq ppss (parse-partial-sexp pt-min pos)))
-	   ;; The OLD-* data can't be used.  Consult the cache.
-	   (t
-	    (let ((cache-pred nil)
-		  (cache ppss-cache)
-		  (pt-min (point-min))
-		  ;; I differentiate between PT-MIN and PT-BEST because
-		  ;; I feel like it might be important to ensure that the
-		  ;; cache is only filled with 100% sure data (whereas
-		  ;; syntax-begin-function might return incorrect data).
-		  ;; Maybe that's just stupid.
-		  (pt-best (point-min))
-		  (ppss-best nil))
-	      ;; look for a usable cache entry.
-	      (while (and cache (< pos (caar cache)))
-		(setq cache-pred cache)
-		(setq cache (cdr cache)))
-	      (if cache (setq pt-min (caar cache) ppss (cdar cache)))
-
-	      ;; Setup the before-change function if necessary.
-	      (unless (or ppss-cache ppss-last)
-                ;; Note: combine-change-calls-1 needs to be kept in sync
-                ;; with this!
-		(add-hook 'before-change-functions
-			  #'syntax-ppss-flush-cache
-                          ;; We should be either the very last function on
-                          ;; before-change-functions or the very first on
-                          ;; after-change-functions.
-                          99 t))
-
-	      ;; Use the best of OLD-POS and CACHE.
-	      (if (or (not old-pos) (< old-pos pt-min))
-		  (setq pt-best pt-min ppss-best ppss)
-		(syntax-ppss--update-stats 4 old-pos pos)
-		(setq pt-best old-pos ppss-best old-ppss))
-
-	      ;; Use the `syntax-begin-function' if available.
-	      ;; We could try using that function earlier, but:
-	      ;; - The result might not be 100% reliable, so it's better to use
-	      ;;   the cache if available.
-	      ;; - The function might be slow.
-	      ;; - If this function almost always finds a safe nearby spot,
-	      ;;   the cache won't be populated, so consulting it is cheap.
-	      (when (and syntax-begin-function
-			 (progn (goto-char pos)
-				(funcall syntax-begin-function)
-				;; Make sure it's better.
-				(> (point) pt-best))
-			 ;; Simple sanity checks.
-                         (< (point) pos) ; backward-paragraph can fail here.
-			 (not (memq (get-text-property (point) 'face)
-				    '(font-lock-string-face font-lock-doc-face
-				      font-lock-comment-face))))
-		(syntax-ppss--update-stats 5 (point) pos)
-		(setq pt-best (point) ppss-best nil))
-
-	      (cond
-	       ;; Quick case when we found a nearby pos.
-	       ((< (- pos pt-best) syntax-ppss-max-span)
-		(syntax-ppss--update-stats 2 pt-best pos)
-		(setq ppss (parse-partial-sexp pt-best pos nil nil ppss-best)))
-	       ;; Slow case: compute the state from some known position and
-	       ;; populate the cache so we won't need to do it again soon.
-	       (t
-		(syntax-ppss--update-stats 3 pt-min pos)
-
-		;; If `pt-min' is too far, add a few intermediate entries.
-		(while (> (- pos pt-min) (* 2 syntax-ppss-max-span))
-		  (setq ppss (parse-partial-sexp
-			      pt-min (setq pt-min (/ (+ pt-min pos) 2))
-			      nil nil ppss))
-                  (push (cons pt-min ppss)
-                        (if cache-pred (cdr cache-pred) ppss-cache)))
-
-		;; Compute the actual return value.
-		(setq ppss (parse-partial-sexp pt-min pos nil nil ppss))
-
-		;; Debugging check.
-		;; (let ((real-ppss (parse-partial-sexp (point-min) pos)))
-		;;   (setcar (last ppss 4) 0)
-		;;   (setcar (last real-ppss 4) 0)
-		;;   (setcar (last ppss 8) nil)
-		;;   (setcar (last real-ppss 8) nil)
-		;;   (unless (equal ppss real-ppss)
-		;;     (message "!!Syntax: %s != %s" ppss real-ppss)
-		;;     (setq ppss real-ppss)))
-
-		;; Store it in the cache.
-		(let ((pair (cons pos ppss)))
-		  (if cache-pred
-		      (if (> (- (caar cache-pred) pos) syntax-ppss-max-span)
-			  (push pair (cdr cache-pred))
-			(setcar cache-pred pair))
-		    (if (or (null ppss-cache)
-			    (> (- (caar ppss-cache) pos)
-			       syntax-ppss-max-span))
-			(push pair ppss-cache)
-		      (setcar ppss-cache pair)))))))))
-
-	  (setq ppss-last (cons pos ppss))
-          (setcar cell ppss-last)
-          (setcdr cell ppss-cache)
-	  ppss)
-      (args-out-of-range
-       ;; If the buffer is more narrowed than when we built the cache,
-       ;; we may end up calling parse-partial-sexp with a position before
-       ;; point-min.  In that case, just parse from point-min assuming
-       ;; a nil state.
-       (parse-partial-sexp (point-min) pos))))))
-
-;; Debugging functions
-
-(defun syntax-ppss-debug ()
-  (let ((pt nil)
-	(min-diffs nil))
-    (dolist (x (append (cdr (syntax-ppss--data)) (list (cons (point-min) nil))))
-      (when pt (push (- pt (car x)) min-diffs))
-      (setq pt (car x)))
-    min-diffs))
+    (let ((parse-sexp-use-checkpoints t))
+      (parse-partial-sexp (point-min) pos))))
 
 (provide 'syntax)
 
@@ -2443,6 +2443,125 @@ insert-file-contents-literally
         (inhibit-file-name-operation 'insert-file-contents))
     (insert-file-contents filename visit beg end replace)))
 
+;; Inserting files a chunk at a time.
+
+(defvar insert-file-contents-chunk-size (* 1024 1024)
+  "Number of bytes that `insert-file-contents-incrementally' reads at once.")
+
+(defun insert-file-contents-incrementally (filename &optional callback)
+  "Insert the contents of file FILENAME after point, a chunk at a time.
+The first chunk of the file is inserted right away, and the others
+are appended to it by a timer, so that Emacs stays responsive while
+a large file is being inserted.  Point does not move.
+
+Return the timer, which can be passed to `cancel-timer' to stop the
+insertion.  Return nil if the whole file was inserted right away.
+
+If CALLBACK is non-nil, it is called after each chunk is inserted,
+with the current buffer being the one where it is inserted, and
+three arguments: the number of bytes read from the file so far, the
+size of the file in bytes, and a status, which is nil while there is
+more to insert, `done' once the whole file is inserted, and an error
+object (ERROR-SYMBOL . DATA) if the insertion failed.  The insertion
+also stops if the buffer is killed.
+
+The coding system used is `coding-system-for-read' if it is non-nil,
+and otherwise the one found for the file from its first chunk.
+Unlike `insert-file-contents', this does not decode file formats or
+run `after-insert-file-functions'.  Files handled by file name
+handlers are inserted at once with `insert-file-contents'."
+  (setq filename (expand-file-name filename))
+  (if (find-file-name-handler filename 'insert-file-contents)
+      (let ((size (cadr (insert-file-contents filename))))
+        (when callback
+          (funcall callback size size 'done))
+        nil)
+    (let* ((size (or (file-attribute-size (file-attributes filename)) 0))
+           (coding coding-system-for-read)
+           (lines (or (null coding)
+                      (coding-system-get coding :ascii-compatible-p)))
+           (chunk-size (if lines (max insert-file-contents-chunk-size 1)
+                         (1+ size)))
+           (buffer (current-buffer))
+           (marker (copy-marker (point) t))
+           (offset 0)
+           (carry "")
+           (timer nil)
+           (step
+            (lambda ()
+              ;; Read the next chunk, and insert the text of the
+              ;; complete lines in it and in what is left of the
+              ;; previous chunks, so that no multibyte sequence is cut.
+              (let ((eof nil)
+                    (text nil))
+                (with-temp-buffer
+                  (set-buffer-multibyte nil)
+                  (insert carry)
+                  (let ((nbytes (cadr (insert-file-contents-literally
+                                       filename nil offset
+                                       (+ offset chunk-size)))))
+                    (setq offset (+ offset nbytes))
+                    (setq eof (< nbytes chunk-size)))
+                  (goto-char (point-max))
+                  (let ((end (cond (eof (point-max))
+                                   ((and lines (search-backward "\n" nil t))
+                                    (1+ (point)))
+                                   (t (point-min)))))
+                    (unless coding
+                      ;; Decide the coding system as `insert-file-contents'
+                      ;; would, from the complete lines of the first chunk.
+                      (let ((format-alist nil)
+                            (after-insert-file-functions nil))
+                        (with-temp-buffer
+                          (insert-file-contents filename nil 0
+                                                (if (> end 1) (1- end)
+                                                  offset))))
+                      (setq coding last-coding-system-used)
+                      ;; Only an ASCII-compatible text can be cut at its
+                      ;; newlines; read any other one all at once.
+                      (unless (coding-system-get coding :ascii-compatible-p)
+                        (setq lines nil)
+                        (setq chunk-size (max chunk-size
+                                              (1+ (- size offset))))
+                        (unless eof
+                          (setq end (point-min)))))
+                    (setq carry (buffer-substring end (point-max)))
+                    (setq text (decode-coding-region (point-min) end
+                                                     coding t))))
+                (with-current-buffer buffer
+                  (save-excursion
+                    (goto-char marker)
+                    (insert text)))
+                eof))))
+      ;; Insert the first chunk now, signaling any error.
+      (if (funcall step)
+          (progn
+            (set-marker marker nil)
+            (when callback
+              (funcall callback offset size 'done))
+            nil)
+        (when callback
+          (funcall callback offset size nil))
+        ;; Insert each of the other chunks from a one-shot timer, which
+        ;; is activated again after the chunk is inserted, so that
+        ;; Emacs handles the events that arrive in between.
+        (setq timer
+              (run-at-time
+               0 nil
+               (lambda ()
+                 (when (buffer-live-p buffer)
+                   (let ((status
+                          (condition-case err
+                              (and (funcall step) 'done)
+                            (error err))))
+                     (if status
+                         (set-marker marker nil)
+                       (timer-set-time timer (current-time))
+                       (timer-activate timer))
+                     (when callback
+                       (with-current-buffer buffer
+                         (funcall callback offset size status))))))))))))
+
 (defun insert-file-1 (filename insert-func)
   (if (file-directory-p filename)
       (signal 'file-error (list "Opening input file" "Is a directory"
@@ -0,0 +1,34 @@
+;; Copyright © 1991-2020 Unicode, Inc.
+;; Generated from Unicode data files by unidata-gen.el.
+;; The sources for this file are found in the admin/unidata/ directory in
+;; the Emacs sources.  The Unicode data files are used under the
+;; Unicode Terms of Use, as contained in the file copyright.html in that
+;; same directory.
+(define-char-code-property 'special-uppercase
+  #^[nil nil char-code-property-table nil #^^[1 0 #^^[2 0 nil 
+#^^[3 128 nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil "SS" nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil] 
+#^^[3 256 nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil "ʼN" nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil] 
+#^^[3 384 nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil "J̌" nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil] nil nil nil 
+#^^[3 896 nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil "Ϊ́" nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil "Ϋ́" nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil] nil nil nil 
+#^^[3 1408 nil nil nil nil nil nil nil "ԵՒ" nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil] nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil] #^^[2 4096 nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil 
+#^^[3 7808 nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil "H̱" "T̈" "W̊" "Y̊" "Aʾ" nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil] 
+#^^[3 7936 nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil "Υ̓" nil "Υ̓̀" nil "Υ̓́" nil "Υ̓͂" nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil] 
+#^^[3 8064 "ἈΙ" "ἉΙ" "ἊΙ" "ἋΙ" "ἌΙ" "ἍΙ" "ἎΙ" "ἏΙ" "ἈΙ" "ἉΙ" "ἊΙ" "ἋΙ" "ἌΙ" "ἍΙ" "ἎΙ" "ἏΙ" "ἨΙ" "ἩΙ" "ἪΙ" "ἫΙ" "ἬΙ" "ἭΙ" "ἮΙ" "ἯΙ" "ἨΙ" "ἩΙ" "ἪΙ" "ἫΙ" "ἬΙ" "ἭΙ" "ἮΙ" "ἯΙ" "ὨΙ" "ὩΙ" "ὪΙ" "ὫΙ" "ὬΙ" "ὭΙ" "ὮΙ" "ὯΙ" "ὨΙ" "ὩΙ" "ὪΙ" "ὫΙ" "ὬΙ" "ὭΙ" "ὮΙ" "ὯΙ" nil nil "ᾺΙ" "ΑΙ" "ΆΙ" nil "Α͂" "Α͂Ι" nil nil nil nil "ΑΙ" nil nil nil nil nil "ῊΙ" "ΗΙ" "ΉΙ" nil "Η͂" "Η͂Ι" nil nil nil nil "ΗΙ" nil nil nil nil nil "Ϊ̀" "Ϊ́" nil nil "Ι͂" "Ϊ͂" nil nil nil nil nil nil nil nil nil nil "Ϋ̀" "Ϋ́" "Ρ̓" nil "Υ͂" "Ϋ͂" nil nil nil nil nil nil nil nil nil nil "ῺΙ" "ΩΙ" "ΏΙ" nil "Ω͂" "Ω͂Ι" nil nil nil nil "ΩΙ" nil nil nil]] nil nil nil nil nil nil nil nil nil nil nil nil nil #^^[2 61440 nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil 
+#^^[3 64256 "FF" "FI" "FL" "FFI" "FFL" "ST" "ST" nil nil nil nil nil nil nil nil nil nil nil nil "ՄՆ" "ՄԵ" "ՄԻ" "ՎՆ" "ՄԽ" nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil] nil nil nil nil nil nil nil nil nil]] nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil nil special-uppercase nil nil nil nil]
+  "Unicode unconditional special casing mapping.
+
+Property value is (possibly empty) string or nil.  The value nil denotes that
+`uppercase' property should be consulted instead.  A string denotes what
+sequence of characters given character maps into.
+
+This mapping includes language- and context-independent special casing rules
+defined by Unicode only.  It also does not include association which would
+duplicate information from `uppercase' property.")
+;; Local Variables:
+;; coding: utf-8
+;; version-control: never
+;; no-byte-compile: t
+;; no-update-autoloads: t
+;; End:
+
+;; uni-special-uppercase.el ends here
@@ -3329,28 +3329,36 @@ isearch-search-fun-default
           ;; can break all sorts of regexp searches.  In particular,
           ;; calling `isearch-regexp-function' can trigger autoloading
           ;; (Bug#35802).
-          (regexp
-           (cond (isearch-regexp-function
-                  (let ((lax (and (not bound)
-                                  (isearch--lax-regexp-function-p))))
-                    (when lax
-                      (setq isearch-adjusted t))
-                    (if (functionp isearch-regexp-function)
-                        (funcall isearch-regexp-function string lax)
-                      (word-search-regexp string lax))))
-                 (isearch-regexp string)
-                 (t (regexp-quote string))))
-          ;; Use lax versions to not fail at the end of the word while
-          ;; the user adds and removes characters in the search string
-          ;; (or when using nonincremental word isearch)
-          (search-spaces-regexp (when (if isearch-regexp
-                                          isearch-regexp-lax-whitespace
-                                        isearch-lax-whitespace)
-                                  search-whitespace-regexp)))
+          (regexp (isearch--search-regexp string bound))
+          (search-spaces-regexp (isearch--search-spaces-regexp)))
       (funcall
        (if isearch-forward #'re-search-forward #'re-search-backward)
        regexp bound noerror count))))
 
+(defun isearch--search-regexp (string bound)
+  "Return the regexp that `isearch-search-fun-default' searches for STRING.
+BOUND is the bound of the search, nil if there is none."
+  (cond (isearch-regexp-function
+         (let ((lax (and (not bound)
+                         (isearch--lax-regexp-function-p))))
+           (when lax
+             (setq isearch-adjusted t))
+           (if (functionp isearch-regexp-function)
+               (funcall isearch-regexp-function string lax)
+             (word-search-regexp string lax))))
+        (isearch-regexp string)
+        (t (regexp-quote string))))
+
+(defun isearch--search-spaces-regexp ()
+  "Return the value of `search-spaces-regexp' for the current search."
+  ;; Use lax versions to not fail at the end of the word while
+  ;; the user adds and removes characters in the search string
+  ;; (or when using nonincremental word isearch)
+  (when (if isearch-regexp
+            isearch-regexp-lax-whitespace
+          isearch-lax-whitespace)
+    search-whitespace-regexp))
+
 (defun isearch-search-string (string bound noerror)
   "Search for the first occurrence of STRING or its translation.
 STRING's characters are translated using `translation-table-for-input'
@@ -3721,6 +3729,17 @@ 'isearch-lazy-highlight-word
 (defvar isearch-lazy-highlight-regexp-function nil)
 (defvar isearch-lazy-highlight-forward nil)
 (defvar isearch-lazy-highlight-error nil)
+(defvar isearch-lazy-highlight-matches nil
+  "Matches found ahead by `isearch-lazy-highlight-search'.
+This is nil, or a list (KEY RESUME MATCHES INDEX) where MATCHES is a
+vector of positions returned by `search-all-matches', INDEX is that of
+the next match to return, KEY is a list of what the search depends on,
+and RESUME is where point is expected to be for the next search.")
+(defvar isearch-lazy-highlight-batch-size 64
+  "Number of matches that lazy highlighting finds in one call.
+Forward searches that use `isearch-search-fun-default' find this many
+matches at once with `search-all-matches', instead of calling the search
+function for each of them.")
 (defvar isearch-lazy-count-current nil)
 (defvar isearch-lazy-count-total nil)
 (defvar isearch-lazy-count-hash (make-hash-table))
@@ -3826,6 +3845,7 @@ isearch-lazy-highlight-new-loop
 	  isearch-lazy-highlight-start        (or isearch-other-end (point))
 	  isearch-lazy-highlight-end          (or isearch-other-end (point))
 	  isearch-lazy-highlight-wrapped      nil
+	  isearch-lazy-highlight-matches      nil
 	  isearch-lazy-highlight-last-string  isearch-string
 	  isearch-lazy-highlight-case-fold-search isearch-case-fold-search
 	  isearch-lazy-highlight-regexp       isearch-regexp
@@ -3875,20 +3895,83 @@ isearch-lazy-highlight-search
 				  (and isearch-lazy-count search-invisible)))
 	    (retry t)
 	    (success nil))
-	;; Use a loop like in `isearch-search'.
-	(while retry
-	  (setq success (isearch-search-string string bound t))
-	  ;; Clear RETRY unless the search predicate says
-	  ;; to skip this search hit.
-	  (if (or (not success)
-		  (= (point) bound) ; like (bobp) (eobp) in `isearch-search'.
-		  (= (match-beginning 0) (match-end 0))
-		  (funcall isearch-filter-predicate
-			   (match-beginning 0) (match-end 0)))
-	      (setq retry nil)))
+	(if (isearch-lazy-highlight-batch-p string)
+	    (setq success (isearch-lazy-highlight-next-match string bound))
+	  ;; Use a loop like in `isearch-search'.
+	  (while retry
+	    (setq success (isearch-search-string string bound t))
+	    ;; Clear RETRY unless the search predicate says
+	    ;; to skip this search hit.
+	    (if (or (not success)
+		    (= (point) bound) ; like (bobp) (eobp) in `isearch-search'.
+		    (= (match-beginning 0) (match-end 0))
+		    (funcall isearch-filter-predicate
+			     (match-beginning 0) (match-end 0)))
+		(setq retry nil))))
 	success)
     (error nil)))
 
+(defun isearch-lazy-highlight-batch-p (string)
+  "Return non-nil if lazy highlighting can find STRING in batches.
+This is the case for forward searches done by `isearch-search-fun-default'
+in the current buffer, when STRING needs no translation."
+  (and isearch-forward
+       (> isearch-lazy-highlight-batch-size 0)
+       (eq isearch-search-fun-function 'isearch-search-fun-default)
+       (null multi-isearch-next-buffer-current-function)
+       (not (and
+	     ;; Avoid "obsolete" warnings for translation-table-for-input.
+	     (with-no-warnings
+	       (char-table-p translation-table-for-input))
+	     (multibyte-string-p string)
+	     (string-match-p "[^[:ascii:]]" string)))))
+
+(defun isearch-lazy-highlight-next-match (string bound)
+  "Move to the end of the next match for STRING before BOUND, and return it.
+Set the match data to that of the match.  Like the loop in
+`isearch-lazy-highlight-search', skip matches that the filter predicate
+rejects.  Return nil if there is none.  Use the matches found ahead in
+`isearch-lazy-highlight-matches' while they are valid."
+  (let ((key (list (current-buffer) (buffer-chars-modified-tick)
+                   string bound case-fold-search isearch-regexp
+                   isearch-regexp-function isearch-lax-whitespace
+                   isearch-regexp-lax-whitespace))
+        (matches isearch-lazy-highlight-matches)
+        (found nil))
+    (while (not found)
+      (unless (and matches
+                   (equal (nth 0 matches) key)
+                   (eql (nth 1 matches) (point))
+                   (< (nth 3 matches) (length (nth 2 matches))))
+        (setq matches
+              (list key (point)
+                    (let ((regexp (isearch--search-regexp string bound))
+                          (search-spaces-regexp
+                           (isearch--search-spaces-regexp)))
+                      (if (> (point) bound)
+                          []
+                        (search-all-matches regexp (point) bound
+                                            isearch-lazy-highlight-batch-size)))
+                    0)))
+      (let ((positions (nth 2 matches))
+            (i (nth 3 matches)))
+        (if (>= i (length positions))
+            (setq found 'none)
+          (let ((mb (aref positions i))
+                (me (aref positions (1+ i))))
+            (set-match-data (list mb me))
+            (goto-char me)
+            (setf (nth 3 matches) (+ i 2))
+            ;; After an empty match, the caller moves one character
+            ;; further, as `search-all-matches' does.
+            (setf (nth 1 matches) (if (= mb me) (1+ me) me))
+            (when (or (= me bound)
+                      (= mb me)
+                      (funcall isearch-filter-predicate mb me))
+              (setq found me))))))
+    (setq isearch-lazy-highlight-matches matches)
+    (and (not (eq found 'none)) found)))
+
 (defun isearch-lazy-highlight-match (mb me)
   (let ((ov (make-overlay mb me)))
     (push ov isearch-lazy-highlight-overlays)
@@ -0,0 +1,2 @@
+;;; ja-dic.el --- stub  -*- lexical-binding:t -*-
+(provide (quote ja-dic))
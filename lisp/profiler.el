@@ -898,6 +898,58 @@ profiler-find-profile-other-frame
    (list (read-file-name "Find profile: " default-directory)))
   (profiler-report-profile-other-frame(profiler-read-profile filename)))
 
+
+;;; Regexp profile
+
+(define-derived-mode regexp-profile-mode tabulated-list-mode "Regexp-Profile"
+  "Major mode for the report of `regexp-profile-report'.
+The report lists the regexps used while `regexp-profile' was
+non-nil, with what they cost: the time they took in seconds, the
+number of searches and matches, the number of bytes of text they
+went over, how many failure points they pushed to backtrack to,
+and the largest size of their failure stack."
+  (setq tabulated-list-format
+        [("Time" 10 regexp-profile--sort-time :right-align t)
+         ("Calls" 8 regexp-profile--sort-calls :right-align t)
+         ("Bytes" 10 regexp-profile--sort-bytes :right-align t)
+         ("Pushes" 10 regexp-profile--sort-pushes :right-align t)
+         ("Stack" 7 regexp-profile--sort-stack :right-align t)
+         ("Regexp" 0 t)])
+  (setq tabulated-list-sort-key '("Time" . t))
+  (tabulated-list-init-header))
+
+(defun regexp-profile--sorter (n)
+  (lambda (a b) (< (nth n (car a)) (nth n (car b)))))
+
+(defalias 'regexp-profile--sort-time (regexp-profile--sorter 5))
+(defalias 'regexp-profile--sort-calls (regexp-profile--sorter 1))
+(defalias 'regexp-profile--sort-bytes (regexp-profile--sorter 2))
+(defalias 'regexp-profile--sort-pushes (regexp-profile--sorter 3))
+(defalias 'regexp-profile--sort-stack (regexp-profile--sorter 4))
+
+;;;###autoload
+(defun regexp-profile-report (&optional reset)
+  "Show what the regexps used while `regexp-profile' was non-nil cost.
+With a prefix argument RESET, restart counting from zero afterwards."
+  (interactive "P")
+  (let ((data (regexp-profile-data reset)))
+    (with-current-buffer (get-buffer-create "*Regexp Profile*")
+      (regexp-profile-mode)
+      (setq tabulated-list-entries
+            (mapcar (lambda (entry)
+                      (pcase-let ((`(,regexp ,calls ,bytes ,pushes ,stack ,time)
+                                   entry))
+                        (list entry
+                              (vector (format "%.6f" time)
+                                      (number-to-string calls)
+                                      (number-to-string bytes)
+                                      (number-to-string pushes)
+                                      (number-to-string stack)
+                                      (prin1-to-string regexp)))))
+                    data))
+      (tabulated-list-print)
+      (pop-to-buffer (current-buffer)))))
+
 
 ;;; Profiling helpers
 
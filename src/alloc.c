@@ -436,6 +436,8 @@ no_sanitize_memcpy (void *dest, void const *src, size_t size)
 static void gc_sweep (void);
 static Lisp_Object make_pure_vector (ptrdiff_t);
 static void mark_buffer (struct buffer *);
+static bool mark_stack_empty_p (void);
+static void finish_cons_sweep (void);
 
 #if !defined REL_ALLOC || defined SYSTEM_MALLOC || defined HYBRID_MALLOC
 static void refill_memory_reserve (void);
@@ -2661,11 +2663,44 @@ #define XUNMARK_CONS(fptr) \
 
 static struct Lisp_Cons *cons_free_list;
 
+/* The cons blocks are swept lazily: instead of sweeping them all at
+   the end of each GC, sweep_conses only arranges for Fcons to sweep
+   one more block whenever the free list runs dry, and any blocks left
+   over are swept at the start of the next GC.  Until then, the
+   unswept blocks keep the mark bits of the last GC.
+
+   CONS_SWEEP_PREV points to the link to the next block to sweep, or
+   is null if there is none.  CONS_SWEEP_LIM is the number of conses
+   in use in that block, and CONS_SWEEP_FREE the number of free conses
+   found so far.  */
+
+static struct cons_block **cons_sweep_prev;
+static int cons_sweep_lim;
+static object_ct cons_sweep_free;
+
+/* Number of conses marked by the current GC, outside of the dump.  */
+
+static object_ct conses_marked;
+
+static void sweep_cons_block (void);
+
 /* Explicitly free a cons cell by putting it on the free-list.  */
 
 void
 free_cons (struct Lisp_Cons *ptr)
 {
+  /* A cons still marked by the last GC is in a block that has not
+     been swept yet.  Sweep up to that block first, which clears the
+     mark; otherwise Fcons could hand out a marked cons, or clearing
+     the mark here would let the sweep free the cons a second time.  */
+  if (cons_sweep_prev && !pdumper_object_p (ptr))
+    {
+      MALLOC_BLOCK_INPUT;
+      while (cons_sweep_prev && XCONS_MARKED_P (ptr))
+	sweep_cons_block ();
+      MALLOC_UNBLOCK_INPUT;
+    }
+
   ptr->u.s.u.chain = cons_free_list;
   ptr->u.s.car = dead_object ();
   cons_free_list = ptr;
@@ -2681,6 +2716,9 @@ DEFUN ("cons", Fcons, Scons, 2, 2, 0,
 
   MALLOC_BLOCK_INPUT;
 
+  while (!cons_free_list && cons_sweep_prev)
+    sweep_cons_block ();
+
   if (cons_free_list)
     {
       XSETCONS (val, cons_free_list);
@@ -3134,6 +3172,14 @@ cleanup_vector (struct Lisp_Vector *vector)
       /* sweep_buffer should already have unchained this from its buffer.  */
       eassert (! PSEUDOVEC_STRUCT (vector, Lisp_Marker)->buffer);
     }
+  else if (PSEUDOVECTOR_TYPEP (&vector->header, PVEC_OVERLAY))
+    {
+      struct Lisp_Overlay *ol = PSEUDOVEC_STRUCT (vector, Lisp_Overlay);
+      /* Overlays of live buffers are reachable from them, so this one
+	 must already have been removed from its buffer.  */
+      eassert (! ol->buffer);
+      xfree (ol->interval);
+    }
   else if (PSEUDOVECTOR_TYPEP (&vector->header, PVEC_USER_PTR))
     {
       struct Lisp_User_Ptr *uptr = PSEUDOVEC_STRUCT (vector, Lisp_User_Ptr);
@@ -3603,18 +3649,21 @@ make_misc_ptr (void *a)
   return make_lisp_ptr (p, Lisp_Vectorlike);
 }
 
-/* Return a new overlay with specified START, END and PLIST.  */
+/* Return a new overlay with specified FRONT_ADVANCE, REAR_ADVANCE and
+   PLIST.  The overlay does not belong to any buffer yet.  */
 
 Lisp_Object
-build_overlay (Lisp_Object start, Lisp_Object end, Lisp_Object plist)
+build_overlay (bool front_advance, bool rear_advance,
+               Lisp_Object plist)
 {
   struct Lisp_Overlay *p = ALLOCATE_PSEUDOVECTOR (struct Lisp_Overlay, plist,
 						  PVEC_OVERLAY);
   Lisp_Object overlay = make_lisp_ptr (p, Lisp_Vectorlike);
-  OVERLAY_START (overlay) = start;
-  OVERLAY_END (overlay) = end;
+  struct itree_node *node = xmalloc (sizeof (*node));
+  itree_node_init (node, front_advance, rear_advance, overlay);
+  p->interval = node;
+  p->buffer = NULL;
   set_overlay_plist (overlay, plist);
-  p->next = NULL;
   return overlay;
 }
 
@@ -3627,7 +3676,9 @@ DEFUN ("make-marker", Fmake_marker, Smake_marker, 0, 0, 0,
   p->buffer = 0;
   p->bytepos = 0;
   p->charpos = 0;
-  p->next = NULL;
+  p->parent = p->left = p->right = NULL;
+  p->offset = p->offset_byte = 0;
+  p->otick = 0;
   p->insertion_type = 0;
   p->need_adjustment = 0;
   return make_lisp_ptr (p, Lisp_Vectorlike);
@@ -3647,13 +3698,10 @@ build_marker (struct buffer *buf, ptrdiff_t charpos, ptrdiff_t bytepos)
 
   struct Lisp_Marker *m = ALLOCATE_PLAIN_PSEUDOVECTOR (struct Lisp_Marker,
 						       PVEC_MARKER);
-  m->buffer = buf;
-  m->charpos = charpos;
-  m->bytepos = bytepos;
+  m->buffer = NULL;
   m->insertion_type = 0;
   m->need_adjustment = 0;
-  m->next = BUF_MARKERS (buf);
-  BUF_MARKERS (buf) = m;
+  attach_marker (m, buf, charpos, bytepos);
   return make_lisp_ptr (m, Lisp_Vectorlike);
 }
 
@@ -3897,7 +3945,10 @@ set_cons_marked (struct Lisp_Cons *c)
   if (pdumper_object_p (c))
     pdumper_set_marked (c);
   else
-    XMARK_CONS (c);
+    {
+      XMARK_CONS (c);
+      conses_marked++;
+    }
 }
 
 static bool
@@ -5823,8 +5874,7 @@ visit_buffer_root (struct gc_root_visitor visitor,
   /* Buffers that are roots don't have intervals, an undo list, or
      other constructs that real buffers have.  */
   eassert (buffer->base_buffer == NULL);
-  eassert (buffer->overlays_before == NULL);
-  eassert (buffer->overlays_after == NULL);
+  eassert (buffer->overlays == NULL);
 
   /* Visit the buffer-locals.  */
   visit_vectorlike_root (visitor, (struct Lisp_Vector *) buffer, type);
@@ -5975,6 +6025,35 @@ maybe_garbage_collect (void)
     garbage_collect ();
 }
 
+/* Number of buckets in `gc-pause-histogram'.  */
+enum { GC_PAUSE_BUCKETS = 16 };
+
+/* Account for a garbage collection that took SECONDS in
+   `gc-max-pause' and `gc-pause-histogram'.  Bucket 0 of the histogram
+   counts pauses shorter than a millisecond, bucket I counts pauses of
+   at least 2**(I-1) and less than 2**I milliseconds, and the last
+   bucket counts all the longer ones.  */
+
+static void
+record_gc_pause (double seconds)
+{
+  if (! (FLOATP (Vgc_max_pause) && XFLOAT_DATA (Vgc_max_pause) >= seconds))
+    Vgc_max_pause = make_float (seconds);
+
+  if (! (VECTORP (Vgc_pause_histogram)
+	 && ASIZE (Vgc_pause_histogram) == GC_PAUSE_BUCKETS))
+    return;
+
+  int bucket = 0;
+  for (double ms = seconds * 1000; 1 <= ms && bucket < GC_PAUSE_BUCKETS - 1;
+       ms /= 2)
+    bucket++;
+
+  Lisp_Object count = AREF (Vgc_pause_histogram, bucket);
+  if (FIXNATP (count) && XFIXNAT (count) < MOST_POSITIVE_FIXNUM)
+    ASET (Vgc_pause_histogram, bucket, make_fixnum (XFIXNAT (count) + 1));
+}
+
 /* Subroutine of Fgarbage_collect that does most of the work.  */
 void
 garbage_collect (void)
@@ -5993,6 +6072,11 @@ garbage_collect (void)
   /* Record this function, so it appears on the profiler's backtraces.  */
   record_in_backtrace (QAutomatic_GC, 0, 0);
 
+  /* Finish sweeping the conses left over by the previous GC, so that
+     their mark bits are clear and dead conses are recognizable as
+     such by the conservative stack scan.  */
+  finish_cons_sweep ();
+
   /* Don't keep undo information around forever.
      Do this early on, so it is no problem if the user quits.  */
   FOR_EACH_LIVE_BUFFER (tail, buffer)
@@ -6055,6 +6139,7 @@ garbage_collect (void)
   shrink_regexp_cache ();
 
   gc_in_progress = 1;
+  conses_marked = 0;
 
   /* Mark all the special slots that serve as the roots of accessibility.  */
 
@@ -6066,6 +6151,7 @@ garbage_collect (void)
   mark_terminals ();
   mark_kboards ();
   mark_threads ();
+  mark_regexp_cache ();
 
 #ifdef USE_GTK
   xg_mark_data ();
@@ -6108,8 +6194,11 @@ garbage_collect (void)
   /* Must happen after all other marking and before gc_sweep.  */
   mark_and_sweep_weak_table_contents ();
   eassert (weak_hash_tables == NULL);
+  eassert (mark_stack_empty_p ());
 
+  struct timespec sweep_start = current_timespec ();
   gc_sweep ();
+  struct timespec sweep_time = timespec_sub (current_timespec (), sweep_start);
 
   unmark_main_thread ();
 
@@ -6141,13 +6230,20 @@ garbage_collect (void)
     }
 
   /* Accumulate statistics.  */
+  struct timespec pause = timespec_sub (current_timespec (), start);
   if (FLOATP (Vgc_elapsed))
     {
       static struct timespec gc_elapsed;
-      gc_elapsed = timespec_add (gc_elapsed,
-				 timespec_sub (current_timespec (), start));
+      gc_elapsed = timespec_add (gc_elapsed, pause);
       Vgc_elapsed = make_float (timespectod (gc_elapsed));
     }
+  if (FLOATP (Vgc_elapsed_sweep))
+    {
+      static struct timespec gc_elapsed_sweep;
+      gc_elapsed_sweep = timespec_add (gc_elapsed_sweep, sweep_time);
+      Vgc_elapsed_sweep = make_float (timespectod (gc_elapsed_sweep));
+    }
+  record_gc_pause (timespectod (pause));
 
   gcs_done++;
 
@@ -6182,6 +6278,8 @@ DEFUN ("garbage-collect", Fgarbage_collect, Sgarbage_collect, 0, 0, "",
     return Qnil;
 
   garbage_collect ();
+  /* Get exact counts of the free conses.  */
+  finish_cons_sweep ();
   struct gcstat gcst = gcstat;
 
   Lisp_Object total[] = {
@@ -6256,12 +6354,105 @@ mark_glyph_matrix (struct glyph_matrix *matrix)
    Normally this is zero and the check never goes off.  */
 ptrdiff_t mark_object_loop_halt EXTERNALLY_VISIBLE;
 
+/* Entry of the mark stack.  */
+struct mark_entry
+{
+  ptrdiff_t n;			/* number of values, or 0 if a single value */
+  union {
+    Lisp_Object value;		/* when n = 0 */
+    Lisp_Object *values;	/* when n > 0 */
+  } u;
+};
+
+/* This stack holds the objects which have been found reachable but
+   whose contents have not been marked yet, the ``grey'' objects of
+   the tricolor abstraction.  Pushing a whole array of values as a
+   single entry keeps the stack small for large vectors.  Marking from
+   this stack instead of recursing in mark_object means that deeply
+   nested data structures do not exhaust the C stack.  */
+struct mark_stack
+{
+  struct mark_entry *stack;	/* base of stack */
+  ptrdiff_t size;		/* allocated size in entries */
+  ptrdiff_t sp;			/* current number of entries */
+};
+
+static struct mark_stack mark_stk = {NULL, 0, 0};
+
+static inline bool
+mark_stack_empty_p (void)
+{
+  return mark_stk.sp <= 0;
+}
+
+/* Pop and return a value from the mark stack (which must be nonempty).  */
+static inline Lisp_Object
+mark_stack_pop (void)
+{
+  eassume (!mark_stack_empty_p ());
+  struct mark_entry *e = &mark_stk.stack[mark_stk.sp - 1];
+  if (e->n == 0)		/* single value */
+    {
+      --mark_stk.sp;
+      return e->u.value;
+    }
+  /* Array of values: pop them left to right, which seems to be slightly
+     faster than right to left.  */
+  e->n--;
+  if (e->n == 0)
+    --mark_stk.sp;		/* last value consumed */
+  return (++e->u.values)[-1];
+}
+
+NO_INLINE static void
+grow_mark_stack (void)
+{
+  struct mark_stack *ms = &mark_stk;
+  eassert (ms->sp == ms->size);
+  ptrdiff_t min_incr = ms->sp == 0 ? 8192 : 1;
+  ms->stack = xpalloc (ms->stack, &ms->size, min_incr, -1, sizeof *ms->stack);
+  eassert (ms->sp < ms->size);
+}
+
+/* Push VALUE onto the mark stack.  */
+static inline void
+mark_stack_push_value (Lisp_Object value)
+{
+  if (mark_stk.sp >= mark_stk.size)
+    grow_mark_stack ();
+  mark_stk.stack[mark_stk.sp++] = (struct mark_entry){.n = 0, .u.value = value};
+}
+
+/* Push the N values at VALUES onto the mark stack.  */
+static inline void
+mark_stack_push_values (Lisp_Object *values, ptrdiff_t n)
+{
+  eassume (n >= 0);
+  if (n == 0)
+    return;
+  if (mark_stk.sp >= mark_stk.size)
+    grow_mark_stack ();
+  mark_stk.stack[mark_stk.sp++] = (struct mark_entry){.n = n,
+						      .u.values = values};
+}
+
+static void process_mark_stack (ptrdiff_t);
+
+/* Mark the N objects at OBJS.  */
+
+static void
+mark_objects (Lisp_Object *objs, ptrdiff_t n)
+{
+  ptrdiff_t sp = mark_stk.sp;
+  mark_stack_push_values (objs, n);
+  process_mark_stack (sp);
+}
+
 static void
 mark_vectorlike (union vectorlike_header *header)
 {
   struct Lisp_Vector *ptr = (struct Lisp_Vector *) header;
   ptrdiff_t size = ptr->header.size;
-  ptrdiff_t i;
 
   eassert (!vector_marked_p (ptr));
 
@@ -6276,8 +6467,7 @@ mark_vectorlike (union vectorlike_header *header)
      the number of Lisp_Object fields that we should trace.
      The distinction is used e.g. by Lisp_Process which places extra
      non-Lisp_Object fields at the end of the structure...  */
-  for (i = 0; i < size; i++) /* ...and then mark its elements.  */
-    mark_object (ptr->contents[i]);
+  mark_objects (ptr->contents, size);
 }
 
 /* Like mark_vectorlike but optimized for char-tables (and
@@ -6310,31 +6500,28 @@ mark_char_table (struct Lisp_Vector *ptr, enum pvec_type pvectype)
     }
 }
 
-NO_INLINE /* To reduce stack depth in mark_object.  */
-static Lisp_Object
-mark_compiled (struct Lisp_Vector *ptr)
-{
-  int i, size = ptr->header.size & PSEUDOVECTOR_SIZE_MASK;
+/* Mark the overlay OV.  */
 
-  set_vector_marked (ptr);
-  for (i = 0; i < size; i++)
-    if (i != COMPILED_CONSTANTS)
-      mark_object (ptr->contents[i]);
-  return size > COMPILED_CONSTANTS ? ptr->contents[COMPILED_CONSTANTS] : Qnil;
+static void
+mark_overlay (struct Lisp_Overlay *ov)
+{
+  /* We don't mark the `itree_node` object, because it is managed manually
+     rather than by the GC.  */
+  eassert (EQ (ov->interval->data, make_lisp_ptr (ov, Lisp_Vectorlike)));
+  set_vectorlike_marked (&ov->header);
+  mark_object (ov->plist);
 }
 
-/* Mark the chain of overlays starting at PTR.  */
+/* Mark the overlays in the subtree of the overlay tree rooted at NODE.  */
 
 static void
-mark_overlay (struct Lisp_Overlay *ptr)
+mark_overlays (struct itree_node *node)
 {
-  for (; ptr && !vectorlike_marked_p (&ptr->header); ptr = ptr->next)
+  while (node)
     {
-      set_vectorlike_marked (&ptr->header);
-      /* These two are always markers and can be marked fast.  */
-      set_vectorlike_marked (&XMARKER (ptr->start)->header);
-      set_vectorlike_marked (&XMARKER (ptr->end)->header);
-      mark_object (ptr->plist);
+      mark_overlays (node->left);
+      mark_overlay (XOVERLAY (node->data));
+      node = node->right;
     }
 }
 
@@ -6359,8 +6546,11 @@ mark_buffer (struct buffer *buffer)
   if (!BUFFER_LIVE_P (buffer))
       mark_object (BVAR (buffer, undo_list));
 
-  mark_overlay (buffer->overlays_before);
-  mark_overlay (buffer->overlays_after);
+  if (buffer->overlays)
+    mark_overlays (buffer->overlays->root);
+
+  if (buffer->parse_state_cache)
+    mark_parse_state_cache (buffer->parse_state_cache);
 
   /* If this is an indirect buffer, mark its base buffer.  */
   if (buffer->base_buffer &&
@@ -6500,33 +6690,23 @@ mark_hash_table (struct Lisp_Vector *ptr)
     }
 }
 
-/* Determine type of generic Lisp_Object and mark it accordingly.
+/* Mark the objects on the mark stack until it is back down to
+   BASE_SP entries.
 
-   This function implements a straightforward depth-first marking
-   algorithm and so the recursion depth may be very high (a few
-   tens of thousands is not uncommon).  To minimize stack usage,
-   a few cold paths are moved out to NO_INLINE functions above.
-   In general, inlining them doesn't help you to gain more speed.  */
+   Objects found inside the object being marked are pushed on the mark
+   stack rather than marked recursively, so that the C stack depth does
+   not depend on the shape of the data.  A few cold paths still call
+   mark_object recursively, but only to a bounded depth.  */
 
-void
-mark_object (Lisp_Object arg)
+static void
+process_mark_stack (ptrdiff_t base_sp)
 {
-  register Lisp_Object obj;
-  void *po;
 #if GC_CHECK_MARKED_OBJECTS
   struct mem_node *m = NULL;
 #endif
   ptrdiff_t cdr_count = 0;
 
-  obj = arg;
- loop:
-
-  po = XPNTR (obj);
-  if (PURE_P (po))
-    return;
-
-  last_marked[last_marked_index++] = obj;
-  last_marked_index &= LAST_MARKED_SIZE - 1;
+  eassume (mark_stk.sp >= base_sp && base_sp >= 0);
 
   /* Perform some sanity checks on the objects marked here.  Abort if
      we encounter an object we know is bogus.  This increases GC time
@@ -6582,188 +6762,199 @@ #define CHECK_ALLOCATED_AND_LIVE_SYMBOL()		((void) 0)
 
 #endif /* not GC_CHECK_MARKED_OBJECTS */
 
-  switch (XTYPE (obj))
+  while (mark_stk.sp > base_sp)
     {
-    case Lisp_String:
-      {
-	register struct Lisp_String *ptr = XSTRING (obj);
-        if (string_marked_p (ptr))
-          break;
-	CHECK_ALLOCATED_AND_LIVE (live_string_p, MEM_TYPE_STRING);
-        set_string_marked (ptr);
-        mark_interval_tree (ptr->u.s.intervals);
+      Lisp_Object obj = mark_stack_pop ();
+     mark_obj: ;
+      void *po = XPNTR (obj);
+      if (PURE_P (po))
+	continue;
+
+      last_marked[last_marked_index++] = obj;
+      last_marked_index &= LAST_MARKED_SIZE - 1;
+
+      switch (XTYPE (obj))
+	{
+	case Lisp_String:
+	  {
+	    register struct Lisp_String *ptr = XSTRING (obj);
+	    if (string_marked_p (ptr))
+	      break;
+	    CHECK_ALLOCATED_AND_LIVE (live_string_p, MEM_TYPE_STRING);
+	    set_string_marked (ptr);
+	    mark_interval_tree (ptr->u.s.intervals);
 #ifdef GC_CHECK_STRING_BYTES
-	/* Check that the string size recorded in the string is the
-	   same as the one recorded in the sdata structure.  */
-	string_bytes (ptr);
+	    /* Check that the string size recorded in the string is the
+	       same as the one recorded in the sdata structure.  */
+	    string_bytes (ptr);
 #endif /* GC_CHECK_STRING_BYTES */
-      }
-      break;
+	  }
+	  break;
 
-    case Lisp_Vectorlike:
-      {
-	register struct Lisp_Vector *ptr = XVECTOR (obj);
+	case Lisp_Vectorlike:
+	  {
+	    register struct Lisp_Vector *ptr = XVECTOR (obj);
 
-	if (vector_marked_p (ptr))
-	  break;
+	    if (vector_marked_p (ptr))
+	      break;
 
-        enum pvec_type pvectype
-          = PSEUDOVECTOR_TYPE (ptr);
+	    enum pvec_type pvectype
+	      = PSEUDOVECTOR_TYPE (ptr);
 
 #ifdef GC_CHECK_MARKED_OBJECTS
-        if (!pdumper_object_p (po) && !SUBRP (obj) && !main_thread_p (po))
-          {
-	    m = mem_find (po);
-	    if (m == MEM_NIL)
-	      emacs_abort ();
-	    if (m->type == MEM_TYPE_VECTORLIKE)
-	      CHECK_LIVE (live_large_vector_p, MEM_TYPE_VECTORLIKE);
-	    else
-	      CHECK_LIVE (live_small_vector_p, MEM_TYPE_VECTOR_BLOCK);
-          }
+	    if (!pdumper_object_p (po) && !SUBRP (obj) && !main_thread_p (po))
+	      {
+		m = mem_find (po);
+		if (m == MEM_NIL)
+		  emacs_abort ();
+		if (m->type == MEM_TYPE_VECTORLIKE)
+		  CHECK_LIVE (live_large_vector_p, MEM_TYPE_VECTORLIKE);
+		else
+		  CHECK_LIVE (live_small_vector_p, MEM_TYPE_VECTOR_BLOCK);
+	      }
 #endif
 
-	switch (pvectype)
-	  {
-	  case PVEC_BUFFER:
-	    mark_buffer ((struct buffer *) ptr);
-            break;
-
-          case PVEC_COMPILED:
-            /* Although we could treat this just like a vector, mark_compiled
-               returns the COMPILED_CONSTANTS element, which is marked at the
-               next iteration of goto-loop here.  This is done to avoid a few
-               recursive calls to mark_object.  */
-            obj = mark_compiled (ptr);
-            if (!NILP (obj))
-              goto loop;
-            break;
-
-          case PVEC_FRAME:
-            mark_frame (ptr);
-            break;
-
-          case PVEC_WINDOW:
-            mark_window (ptr);
-            break;
-
-	  case PVEC_HASH_TABLE:
-            mark_hash_table (ptr);
-	    break;
-
-	  case PVEC_CHAR_TABLE:
-	  case PVEC_SUB_CHAR_TABLE:
-	    mark_char_table (ptr, (enum pvec_type) pvectype);
-	    break;
-
-          case PVEC_BOOL_VECTOR:
-            /* bool vectors in a dump are permanently "marked", since
-               they're in the old section and don't have mark bits.
-               If we're looking at a dumped bool vector, we should
-               have aborted above when we called vector_marked_p, so
-               we should never get here.  */
-            eassert (!pdumper_object_p (ptr));
-            set_vector_marked (ptr);
-            break;
-
-          case PVEC_OVERLAY:
-	    mark_overlay (XOVERLAY (obj));
-	    break;
-
-	  case PVEC_SUBR:
-	    break;
-
-	  case PVEC_FREE:
-	    emacs_abort ();
-
-	  default:
-	    /* A regular vector, or a pseudovector needing no special
-	       treatment.  */
-	    mark_vectorlike (&ptr->header);
+	    switch (pvectype)
+	      {
+	      case PVEC_BUFFER:
+		mark_buffer ((struct buffer *) ptr);
+		break;
+
+	      case PVEC_FRAME:
+		mark_frame (ptr);
+		break;
+
+	      case PVEC_WINDOW:
+		mark_window (ptr);
+		break;
+
+	      case PVEC_HASH_TABLE:
+		mark_hash_table (ptr);
+		break;
+
+	      case PVEC_CHAR_TABLE:
+	      case PVEC_SUB_CHAR_TABLE:
+		mark_char_table (ptr, (enum pvec_type) pvectype);
+		break;
+
+	      case PVEC_BOOL_VECTOR:
+		/* bool vectors in a dump are permanently "marked", since
+		   they're in the old section and don't have mark bits.
+		   If we're looking at a dumped bool vector, we should
+		   have aborted above when we called vector_marked_p, so
+		   we should never get here.  */
+		eassert (!pdumper_object_p (ptr));
+		set_vector_marked (ptr);
+		break;
+
+	      case PVEC_OVERLAY:
+		mark_overlay (XOVERLAY (obj));
+		break;
+
+	      case PVEC_SUBR:
+		break;
+
+	      case PVEC_FREE:
+		emacs_abort ();
+
+	      default:
+		{
+		  /* A regular vector, or a pseudovector needing no
+		     special treatment.  */
+		  ptrdiff_t size = ptr->header.size;
+		  if (size & PSEUDOVECTOR_FLAG)
+		    size &= PSEUDOVECTOR_SIZE_MASK;
+		  set_vector_marked (ptr);
+		  mark_stack_push_values (ptr->contents, size);
+		}
+		break;
+	      }
 	  }
-      }
-      break;
+	  break;
 
-    case Lisp_Symbol:
-      {
-	struct Lisp_Symbol *ptr = XSYMBOL (obj);
-      nextsym:
-        if (symbol_marked_p (ptr))
-          break;
-        CHECK_ALLOCATED_AND_LIVE_SYMBOL ();
-        set_symbol_marked (ptr);
-	/* Attempt to catch bogus objects.  */
-	eassert (valid_lisp_object_p (ptr->u.s.function));
-	mark_object (ptr->u.s.function);
-	mark_object (ptr->u.s.plist);
-	switch (ptr->u.s.redirect)
+	case Lisp_Symbol:
 	  {
-	  case SYMBOL_PLAINVAL: mark_object (SYMBOL_VAL (ptr)); break;
-	  case SYMBOL_VARALIAS:
-	    {
-	      Lisp_Object tem;
-	      XSETSYMBOL (tem, SYMBOL_ALIAS (ptr));
-	      mark_object (tem);
+	    struct Lisp_Symbol *ptr = XSYMBOL (obj);
+	  nextsym:
+	    if (symbol_marked_p (ptr))
 	      break;
-	    }
-	  case SYMBOL_LOCALIZED:
-	    mark_localized_symbol (ptr);
-	    break;
-	  case SYMBOL_FORWARDED:
-	    /* If the value is forwarded to a buffer or keyboard field,
-	       these are marked when we see the corresponding object.
-	       And if it's forwarded to a C variable, either it's not
-	       a Lisp_Object var, or it's staticpro'd already.  */
-	    break;
-	  default: emacs_abort ();
+	    CHECK_ALLOCATED_AND_LIVE_SYMBOL ();
+	    set_symbol_marked (ptr);
+	    /* Attempt to catch bogus objects.  */
+	    eassert (valid_lisp_object_p (ptr->u.s.function));
+	    mark_stack_push_value (ptr->u.s.function);
+	    mark_stack_push_value (ptr->u.s.plist);
+	    switch (ptr->u.s.redirect)
+	      {
+	      case SYMBOL_PLAINVAL:
+		mark_stack_push_value (SYMBOL_VAL (ptr));
+		break;
+	      case SYMBOL_VARALIAS:
+		{
+		  Lisp_Object tem;
+		  XSETSYMBOL (tem, SYMBOL_ALIAS (ptr));
+		  mark_stack_push_value (tem);
+		  break;
+		}
+	      case SYMBOL_LOCALIZED:
+		mark_localized_symbol (ptr);
+		break;
+	      case SYMBOL_FORWARDED:
+		/* If the value is forwarded to a buffer or keyboard field,
+		   these are marked when we see the corresponding object.
+		   And if it's forwarded to a C variable, either it's not
+		   a Lisp_Object var, or it's staticpro'd already.  */
+		break;
+	      default: emacs_abort ();
+	      }
+	    if (!PURE_P (XSTRING (ptr->u.s.name)))
+	      set_string_marked (XSTRING (ptr->u.s.name));
+	    mark_interval_tree (string_intervals (ptr->u.s.name));
+	    /* Inner loop to mark next symbol in this bucket, if any.  */
+	    po = ptr = ptr->u.s.next;
+	    if (ptr)
+	      goto nextsym;
 	  }
-	if (!PURE_P (XSTRING (ptr->u.s.name)))
-          set_string_marked (XSTRING (ptr->u.s.name));
-        mark_interval_tree (string_intervals (ptr->u.s.name));
-	/* Inner loop to mark next symbol in this bucket, if any.  */
-	po = ptr = ptr->u.s.next;
-	if (ptr)
-	  goto nextsym;
-      }
-      break;
-
-    case Lisp_Cons:
-      {
-	struct Lisp_Cons *ptr = XCONS (obj);
-	if (cons_marked_p (ptr))
 	  break;
-	CHECK_ALLOCATED_AND_LIVE (live_cons_p, MEM_TYPE_CONS);
-        set_cons_marked (ptr);
-	/* If the cdr is nil, avoid recursion for the car.  */
-	if (NILP (ptr->u.s.u.cdr))
+
+	case Lisp_Cons:
 	  {
+	    struct Lisp_Cons *ptr = XCONS (obj);
+	    if (cons_marked_p (ptr))
+	      break;
+	    CHECK_ALLOCATED_AND_LIVE (live_cons_p, MEM_TYPE_CONS);
+	    set_cons_marked (ptr);
+	    /* Leave the cdr on the stack and go on with the car, so that
+	       the stack does not grow while marking a long list.  */
+	    if (NILP (ptr->u.s.u.cdr))
+	      cdr_count = 0;
+	    else
+	      {
+		mark_stack_push_value (ptr->u.s.u.cdr);
+		cdr_count++;
+		if (cdr_count == mark_object_loop_halt)
+		  emacs_abort ();
+	      }
 	    obj = ptr->u.s.car;
-	    cdr_count = 0;
-	    goto loop;
+	    goto mark_obj;
 	  }
-	mark_object (ptr->u.s.car);
-	obj = ptr->u.s.u.cdr;
-	cdr_count++;
-	if (cdr_count == mark_object_loop_halt)
-	  emacs_abort ();
-	goto loop;
-      }
 
-    case Lisp_Float:
-      CHECK_ALLOCATED_AND_LIVE (live_float_p, MEM_TYPE_FLOAT);
-      /* Do not mark floats stored in a dump image: these floats are
-         "cold" and do not have mark bits.  */
-      if (pdumper_object_p (XFLOAT (obj)))
-        eassert (pdumper_cold_object_p (XFLOAT (obj)));
-      else if (!XFLOAT_MARKED_P (XFLOAT (obj)))
-        XFLOAT_MARK (XFLOAT (obj));
-      break;
+	case Lisp_Float:
+	  CHECK_ALLOCATED_AND_LIVE (live_float_p, MEM_TYPE_FLOAT);
+	  /* Do not mark floats stored in a dump image: these floats are
+	     "cold" and do not have mark bits.  */
+	  if (pdumper_object_p (XFLOAT (obj)))
+	    eassert (pdumper_cold_object_p (XFLOAT (obj)));
+	  else if (!XFLOAT_MARKED_P (XFLOAT (obj)))
+	    XFLOAT_MARK (XFLOAT (obj));
+	  break;
 
-    case_Lisp_Int:
-      break;
+	case_Lisp_Int:
+	  break;
 
-    default:
-      emacs_abort ();
+	default:
+	  emacs_abort ();
+	}
     }
 
 #undef CHECK_LIVE
@@ -6771,6 +6962,16 @@ #define CHECK_ALLOCATED_AND_LIVE_SYMBOL()		((void) 0)
 #undef CHECK_ALLOCATED_AND_LIVE
 }
 
+/* Mark OBJ and everything reachable from it.  */
+
+void
+mark_object (Lisp_Object obj)
+{
+  ptrdiff_t sp = mark_stk.sp;
+  mark_stack_push_value (obj);
+  process_mark_stack (sp);
+}
+
 /* Mark the Lisp pointers in the terminal objects.
    Called by Fgarbage_collect.  */
 
@@ -6838,81 +7039,103 @@ survives_gc_p (Lisp_Object obj)
 
 
 
-NO_INLINE /* For better stack traces */
+/* Sweep the cons block at *CONS_SWEEP_PREV, putting its free conses
+   on the free list, and advance to the next block.  */
+
 static void
-sweep_conses (void)
+sweep_cons_block (void)
 {
-  struct cons_block **cprev = &cons_block;
-  int lim = cons_block_index;
-  object_ct num_free = 0, num_used = 0;
-
-  cons_free_list = 0;
+  struct cons_block *cblk = *cons_sweep_prev;
+  int lim = cons_sweep_lim;
 
-  for (struct cons_block *cblk; (cblk = *cprev); )
+  if (!cblk)
     {
-      int i = 0;
-      int this_free = 0;
-      int ilim = (lim + BITS_PER_BITS_WORD - 1) / BITS_PER_BITS_WORD;
+      /* All blocks have been swept.  */
+      gcstat.total_free_conses = cons_sweep_free;
+      cons_sweep_prev = NULL;
+      return;
+    }
 
-      /* Scan the mark bits an int at a time.  */
-      for (i = 0; i < ilim; i++)
-        {
-          if (cblk->gcmarkbits[i] == BITS_WORD_MAX)
-            {
-              /* Fast path - all cons cells for this int are marked.  */
-              cblk->gcmarkbits[i] = 0;
-              num_used += BITS_PER_BITS_WORD;
-            }
-          else
-            {
-              /* Some cons cells for this int are not marked.
-                 Find which ones, and free them.  */
-              int start, pos, stop;
+  int this_free = 0;
+  int ilim = (lim + BITS_PER_BITS_WORD - 1) / BITS_PER_BITS_WORD;
 
-              start = i * BITS_PER_BITS_WORD;
-              stop = lim - start;
-              if (stop > BITS_PER_BITS_WORD)
-                stop = BITS_PER_BITS_WORD;
-              stop += start;
+  /* Scan the mark bits an int at a time.  */
+  for (int i = 0; i < ilim; i++)
+    {
+      if (cblk->gcmarkbits[i] == BITS_WORD_MAX)
+	{
+	  /* Fast path - all cons cells for this int are marked.  */
+	  cblk->gcmarkbits[i] = 0;
+	}
+      else
+	{
+	  /* Some cons cells for this int are not marked.
+	     Find which ones, and free them.  */
+	  int start, pos, stop;
 
-              for (pos = start; pos < stop; pos++)
-                {
-		  struct Lisp_Cons *acons = &cblk->conses[pos];
-		  if (!XCONS_MARKED_P (acons))
-                    {
-                      this_free++;
-                      cblk->conses[pos].u.s.u.chain = cons_free_list;
-                      cons_free_list = &cblk->conses[pos];
-                      cons_free_list->u.s.car = dead_object ();
-                    }
-                  else
-                    {
-                      num_used++;
-		      XUNMARK_CONS (acons);
-                    }
-                }
-            }
-        }
+	  start = i * BITS_PER_BITS_WORD;
+	  stop = lim - start;
+	  if (stop > BITS_PER_BITS_WORD)
+	    stop = BITS_PER_BITS_WORD;
+	  stop += start;
 
-      lim = CONS_BLOCK_SIZE;
-      /* If this block contains only free conses and we have already
-         seen more than two blocks worth of free conses then deallocate
-         this block.  */
-      if (this_free == CONS_BLOCK_SIZE && num_free > CONS_BLOCK_SIZE)
-        {
-          *cprev = cblk->next;
-          /* Unhook from the free list.  */
-          cons_free_list = cblk->conses[0].u.s.u.chain;
-          lisp_align_free (cblk);
-        }
-      else
-        {
-          num_free += this_free;
-          cprev = &cblk->next;
-        }
+	  for (pos = start; pos < stop; pos++)
+	    {
+	      struct Lisp_Cons *acons = &cblk->conses[pos];
+	      if (!XCONS_MARKED_P (acons))
+		{
+		  this_free++;
+		  cblk->conses[pos].u.s.u.chain = cons_free_list;
+		  cons_free_list = &cblk->conses[pos];
+		  cons_free_list->u.s.car = dead_object ();
+		}
+	      else
+		XUNMARK_CONS (acons);
+	    }
+	}
+    }
+
+  cons_sweep_lim = CONS_BLOCK_SIZE;
+  /* If this block contains only free conses and we have already
+     seen more than two blocks worth of free conses then deallocate
+     this block.  */
+  if (this_free == CONS_BLOCK_SIZE && cons_sweep_free > CONS_BLOCK_SIZE)
+    {
+      *cons_sweep_prev = cblk->next;
+      /* Unhook from the free list.  */
+      cons_free_list = cblk->conses[0].u.s.u.chain;
+      lisp_align_free (cblk);
+    }
+  else
+    {
+      cons_sweep_free += this_free;
+      cons_sweep_prev = &cblk->next;
     }
-  gcstat.total_conses = num_used;
-  gcstat.total_free_conses = num_free;
+}
+
+/* Sweep the cons blocks that have not been swept yet since the last
+   GC.  */
+
+static void
+finish_cons_sweep (void)
+{
+  while (cons_sweep_prev)
+    sweep_cons_block ();
+}
+
+/* Start sweeping the cons blocks.  The conses in use are known from
+   the marking already; the free ones are put on the free list lazily,
+   by Fcons.  */
+
+static void
+sweep_conses (void)
+{
+  eassert (!cons_sweep_prev);
+  cons_free_list = 0;
+  cons_sweep_prev = &cons_block;
+  cons_sweep_lim = cons_block_index;
+  cons_sweep_free = 0;
+  gcstat.total_conses = conses_marked;
 }
 
 NO_INLINE /* For better stack traces */
@@ -7083,20 +7306,22 @@ sweep_symbols (void)
 }
 
 /* Remove BUFFER's markers that are due to be swept.  This is needed since
-   we treat BUF_MARKERS and markers's `next' field as weak pointers.  */
+   we treat BUF_MARKERS and the links of the tree of markers as weak
+   pointers.  */
 static void
 unchain_dead_markers (struct buffer *buffer)
 {
-  struct Lisp_Marker *this, **prev = &BUF_MARKERS (buffer);
+  struct Lisp_Marker *m;
+  bool dead = false;
 
-  while ((this = *prev))
-    if (vectorlike_marked_p (&this->header))
-      prev = &this->next;
-    else
+  FOR_EACH_MARKER (buffer, m)
+    if (!vectorlike_marked_p (&m->header))
       {
-        this->buffer = NULL;
-        *prev = this->next;
+	m->buffer = NULL;
+	dead = true;
       }
+  if (dead)
+    prune_markers (buffer);
 }
 
 NO_INLINE /* For better stack traces */
@@ -7426,6 +7651,9 @@ init_alloc_once_for_pdumper (void)
 init_alloc (void)
 {
   Vgc_elapsed = make_float (0.0);
+  Vgc_elapsed_sweep = make_float (0.0);
+  Vgc_max_pause = make_float (0.0);
+  Vgc_pause_histogram = make_vector (GC_PAUSE_BUCKETS, make_fixnum (0));
   gcs_done = 0;
 }
 
@@ -7522,10 +7750,26 @@ syms_of_alloc (void)
 
   DEFVAR_LISP ("gc-elapsed", Vgc_elapsed,
 	       doc: /* Accumulated time elapsed in garbage collections.
+The time is in seconds as a floating point value.  */);
+  DEFVAR_LISP ("gc-elapsed-sweep", Vgc_elapsed_sweep,
+	       doc: /* Accumulated time elapsed in the sweep phase of garbage collections.
+This is part of `gc-elapsed'.  It does not include the time taken by
+sweeping cons cells, which is deferred until they are allocated.
 The time is in seconds as a floating point value.  */);
   DEFVAR_INT ("gcs-done", gcs_done,
               doc: /* Accumulated number of garbage collections done.  */);
 
+  DEFVAR_LISP ("gc-max-pause", Vgc_max_pause,
+	       doc: /* Longest time elapsed in a single garbage collection.
+The time is in seconds as a floating point value.  */);
+
+  DEFVAR_LISP ("gc-pause-histogram", Vgc_pause_histogram,
+	       doc: /* Histogram of the times elapsed in garbage collections.
+This is a vector of 16 counts.  Element 0 counts the collections that
+took less than a millisecond, element N counts those that took at least
+2**(N-1) and less than 2**N milliseconds, and the last element counts
+all the longer ones.  Set an element to zero to restart its count.  */);
+
   DEFVAR_INT ("integer-width", integer_width,
 	      doc: /* Maximum number N of bits in safely-calculated integers.
 Integers with absolute values less than 2**N do not signal a range error.
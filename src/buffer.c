@@ -24,12 +24,18 @@ Copyright (C) 1985-1989, 1993-1995, 1997-2020 Free Software Foundation,
 #include <sys/stat.h>
 #include <sys/param.h>
 #include <errno.h>
+#include <fcntl.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <unistd.h>
 
+#include <stat-time.h>
 #include <verify.h>
 
+#if defined HAVE_MMAP && !defined WINDOWSNT
+# include <sys/mman.h>
+#endif
+
 #include "lisp.h"
 #include "intervals.h"
 #include "process.h"
@@ -46,6 +52,19 @@ Copyright (C) 1985-1989, 1993-1995, 1997-2020 Free Software Foundation,
 #include "frame.h"
 #include "xwidget.h"
 #include "pdumper.h"
+#include "syssignal.h"
+#include "keyboard.h"
+
+/* Whether the text of buffers can be mapped from files.  This needs a
+   SIGBUS handler, and a thread to help it, to survive the truncation
+   of a mapped file; see handle_mapped_text_fault.  */
+#if (defined HAVE_MMAP && defined MAP_ANON && !defined WINDOWSNT \
+     && !defined REL_ALLOC && defined SIGBUS && defined SA_SIGINFO \
+     && defined HAVE_PTHREAD)
+# define MAP_BUFFER_TEXT true
+#else
+# define MAP_BUFFER_TEXT false
+#endif
 
 #ifdef WINDOWSNT
 #include "w32heap.h"		/* for mmap_* */
@@ -115,8 +134,12 @@ #define OVERLAY_COUNT_MAX						\
 static Lisp_Object QSFundamental;	/* A string "Fundamental".  */
 
 static void alloc_buffer_text (struct buffer *, ptrdiff_t);
+static void free_buffer_text_1 (struct buffer *);
 static void free_buffer_text (struct buffer *b);
-static struct Lisp_Overlay * copy_overlays (struct buffer *, struct Lisp_Overlay *);
+#if MAP_BUFFER_TEXT
+static void unmap_mapped_text (struct buffer *, unsigned char *);
+#endif
+static void copy_overlays (struct buffer *, struct buffer *);
 static void modify_overlay (struct buffer *, ptrdiff_t, ptrdiff_t);
 static Lisp_Object buffer_lisp_local_variables (struct buffer *, bool);
 static Lisp_Object buffer_local_variables_1 (struct buffer *buf, int offset, Lisp_Object sym);
@@ -552,6 +575,7 @@ DEFUN ("get-buffer-create", Fget_buffer_create, Sget_buffer_create, 1, 1, 0,
   memset (&b->local_flags, 0, sizeof (b->local_flags));
 
   BUF_GAP_SIZE (b) = 20;
+  BUF_TAIL_SIZE (b) = 0;
   block_input ();
   /* We allocate extra 1-byte at the tail and keep it always '\0' for
      anchoring a search.  */
@@ -585,10 +609,14 @@ DEFUN ("get-buffer-create", Fget_buffer_create, Sget_buffer_create, 1, 1, 0,
   *(BUF_GPT_ADDR (b)) = *(BUF_Z_ADDR (b)) = 0; /* Put an anchor '\0'.  */
   b->text->inhibit_shrinking = false;
   b->text->redisplay = false;
+  b->text->mapped = false;
+  b->text->line_index = NULL;
+  b->text->char_index = NULL;
 
   b->newline_cache = 0;
   b->width_run_cache = 0;
   b->bidi_paragraph_cache = 0;
+  b->parse_state_cache = 0;
   bset_width_table (b, Qnil);
   b->prevent_redisplay_optimizations_p = 1;
 
@@ -614,6 +642,8 @@ DEFUN ("get-buffer-create", Fget_buffer_create, Sget_buffer_create, 1, 1, 0,
 
   bset_mark (b, Fmake_marker ());
   BUF_MARKERS (b) = NULL;
+  b->text->markers_count = b->text->markers_max_count = 0;
+  b->text->markers_otick = 1;
 
   /* Put this in the alist of all live buffers.  */
   XSETBUFFER (buffer, b);
@@ -626,51 +656,51 @@ DEFUN ("get-buffer-create", Fget_buffer_create, Sget_buffer_create, 1, 1, 0,
 }
 
 
-/* Return a list of overlays which is a copy of the overlay list
-   LIST, but for buffer B.  */
+/* Add OV, which must not belong to any buffer yet, to the overlays of
+   B, spanning BEGIN to END.  */
 
-static struct Lisp_Overlay *
-copy_overlays (struct buffer *b, struct Lisp_Overlay *list)
+static void
+add_buffer_overlay (struct buffer *b, struct Lisp_Overlay *ov,
+		    ptrdiff_t begin, ptrdiff_t end)
 {
-  struct Lisp_Overlay *result = NULL, *tail = NULL;
-
-  for (; list; list = list->next)
-    {
-      Lisp_Object overlay, start, end;
-      struct Lisp_Marker *m;
-
-      eassert (MARKERP (list->start));
-      m = XMARKER (list->start);
-      start = build_marker (b, m->charpos, m->bytepos);
-      XMARKER (start)->insertion_type = m->insertion_type;
-
-      eassert (MARKERP (list->end));
-      m = XMARKER (list->end);
-      end = build_marker (b, m->charpos, m->bytepos);
-      XMARKER (end)->insertion_type = m->insertion_type;
-
-      overlay = build_overlay (start, end, Fcopy_sequence (list->plist));
-      if (tail)
-	tail = tail->next = XOVERLAY (overlay);
-      else
-	result = tail = XOVERLAY (overlay);
-    }
-
-  return result;
+  eassert (! ov->buffer);
+  if (! b->overlays)
+    b->overlays = itree_create ();
+  ov->buffer = b;
+  itree_insert (b->overlays, ov->interval, begin, end);
 }
 
-/* Set an appropriate overlay of B.  */
+/* Remove OV from the overlays of its buffer, leaving it detached.  */
 
 static void
-set_buffer_overlays_before (struct buffer *b, struct Lisp_Overlay *o)
+remove_buffer_overlay (struct buffer *b, struct Lisp_Overlay *ov)
 {
-  b->overlays_before = o;
+  eassert (b->overlays);
+  eassert (ov->buffer == b);
+  itree_remove (ov->buffer->overlays, ov->interval);
+  ov->buffer = NULL;
 }
 
+/* Copy all the overlays of buffer FROM into buffer TO, which must not
+   have any overlays yet.  */
+
 static void
-set_buffer_overlays_after (struct buffer *b, struct Lisp_Overlay *o)
+copy_overlays (struct buffer *from, struct buffer *to)
 {
-  b->overlays_after = o;
+  eassert (to && ! to->overlays);
+  struct itree_node *node;
+
+  if (! from->overlays)
+    return;
+
+  ITREE_FOREACH (node, from->overlays, PTRDIFF_MIN, PTRDIFF_MAX, ASCENDING)
+    {
+      Lisp_Object ov = node->data;
+      Lisp_Object copy = build_overlay (node->front_advance,
+					node->rear_advance,
+					Fcopy_sequence (OVERLAY_PLIST (ov)));
+      add_buffer_overlay (to, XOVERLAY (copy), node->begin, node->end);
+    }
 }
 
 bool
@@ -704,7 +734,7 @@ clone_per_buffer_values (struct buffer *from, struct buffer *to)
 	{
 	  struct Lisp_Marker *m = XMARKER (obj);
 
-	  obj = build_marker (to, m->charpos, m->bytepos);
+	  obj = build_marker (to, marker_charpos (m), marker_bytepos (m));
 	  XMARKER (obj)->insertion_type = m->insertion_type;
 	}
 
@@ -713,8 +743,7 @@ clone_per_buffer_values (struct buffer *from, struct buffer *to)
 
   memcpy (to->local_flags, from->local_flags, sizeof to->local_flags);
 
-  set_buffer_overlays_before (to, copy_overlays (to, from->overlays_before));
-  set_buffer_overlays_after (to, copy_overlays (to, from->overlays_after));
+  copy_overlays (from, to);
 
   /* Get (a copy of) the alist of Lisp-level local variables of FROM
      and install that in TO.  */
@@ -826,6 +855,7 @@ DEFUN ("make-indirect-buffer", Fmake_indirect_buffer, Smake_indirect_buffer,
   b->newline_cache = 0;
   b->width_run_cache = 0;
   b->bidi_paragraph_cache = 0;
+  b->parse_state_cache = 0;
   bset_width_table (b, Qnil);
 
   name = Fcopy_sequence (name);
@@ -901,44 +931,124 @@ DEFUN ("make-indirect-buffer", Fmake_indirect_buffer, Smake_indirect_buffer,
   return buf;
 }
 
-/* Mark OV as no longer associated with B.  */
+/* Mark OV as no longer associated with its buffer.  */
 
 static void
-drop_overlay (struct buffer *b, struct Lisp_Overlay *ov)
+drop_overlay (struct Lisp_Overlay *ov)
 {
-  eassert (b == XBUFFER (Fmarker_buffer (ov->start)));
-  modify_overlay (b, marker_position (ov->start),
-		  marker_position (ov->end));
-  unchain_marker (XMARKER (ov->start));
-  unchain_marker (XMARKER (ov->end));
+  if (! ov->buffer)
+    return;
 
+  modify_overlay (ov->buffer, overlay_start (ov), overlay_end (ov));
+  remove_buffer_overlay (ov->buffer, ov);
 }
 
-/* Delete all overlays of B and reset its overlay lists.  */
+/* Delete all overlays of B and reset its overlay tree.  */
 
 void
 delete_all_overlays (struct buffer *b)
 {
-  struct Lisp_Overlay *ov, *next;
+  struct itree_node *node, **nodes;
+  intmax_t i = 0;
+
+  if (! b->overlays || ! b->overlays->root)
+    return;
+
+  /* The nodes can't be unlinked while the iterator walks over them,
+     so collect them first.  */
+  USE_SAFE_ALLOCA;
+  SAFE_NALLOCA (nodes, 1, itree_size (b->overlays));
+  ITREE_FOREACH (node, b->overlays, PTRDIFF_MIN, PTRDIFF_MAX, ASCENDING)
+    {
+      modify_overlay (b, node->begin, node->end);
+      XOVERLAY (node->data)->buffer = NULL;
+      nodes[i++] = node;
+    }
+  while (i > 0)
+    {
+      node = nodes[--i];
+      node->parent = node->left = node->right = NULL;
+    }
+  itree_clear (b->overlays);
+  SAFE_FREE ();
+}
 
-  /* FIXME: Since each drop_overlay will scan BUF_MARKERS to unlink its
-     markers, we have an unneeded O(N^2) behavior here.  */
-  for (ov = b->overlays_before; ov; ov = next)
+/* Free the overlay tree of B, which must be empty.  */
+
+static void
+free_buffer_overlays (struct buffer *b)
+{
+  eassert (! b->overlays || 0 == itree_size (b->overlays));
+  if (b->overlays)
     {
-      drop_overlay (b, ov);
-      next = ov->next;
-      ov->next = NULL;
+      itree_destroy (b->overlays);
+      b->overlays = NULL;
     }
+}
+
+/* Adjust the multibyteness of all overlays of B, after the text of
+   B changed between unibyte (if MULTIBYTE is false) and multibyte.  */
+
+static void
+set_overlays_multibyte (bool multibyte)
+{
+  if (! current_buffer->overlays || Z == Z_BYTE)
+    return;
+
+  struct itree_tree *tree = current_buffer->overlays;
+  const intmax_t size = itree_size (tree);
+  struct itree_node **nodes;
+  ptrdiff_t *begins, *ends;
 
-  for (ov = b->overlays_after; ov; ov = next)
+  /* The nodes are removed from the tree and reinserted at their new
+     positions, since the tree would be out of order while only some
+     of them are converted.  */
+  USE_SAFE_ALLOCA;
+  SAFE_NALLOCA (nodes, 1, size);
+  SAFE_NALLOCA (begins, 1, size);
+  SAFE_NALLOCA (ends, 1, size);
+  {
+    struct itree_node *node;
+    intmax_t i = 0;
+    ITREE_FOREACH (node, tree, PTRDIFF_MIN, PTRDIFF_MAX, ASCENDING)
+      {
+	nodes[i] = node;
+	begins[i] = node->begin;
+	ends[i] = node->end;
+	i++;
+      }
+  }
+
+  for (intmax_t i = 0; i < size; ++i)
     {
-      drop_overlay (b, ov);
-      next = ov->next;
-      ov->next = NULL;
+      ptrdiff_t begin = begins[i];
+      ptrdiff_t end = ends[i];
+
+      if (multibyte)
+        {
+          /* This models the behavior of markers.  (The behavior of
+             text-intervals differs slightly.)  */
+          while (begin < Z_BYTE
+                 && !CHAR_HEAD_P (FETCH_BYTE (begin)))
+            begin++;
+          while (end < Z_BYTE
+                 && !CHAR_HEAD_P (FETCH_BYTE (end)))
+            end++;
+          begins[i] = BYTE_TO_CHAR (begin);
+          ends[i] = BYTE_TO_CHAR (end);
+        }
+      else
+        {
+          begins[i] = CHAR_TO_BYTE (begin);
+          ends[i] = CHAR_TO_BYTE (end);
+        }
     }
 
-  set_buffer_overlays_before (b, NULL);
-  set_buffer_overlays_after (b, NULL);
+  for (intmax_t i = 0; i < size; ++i)
+    itree_remove (tree, nodes[i]);
+  for (intmax_t i = 0; i < size; ++i)
+    itree_insert (tree, nodes[i], begins[i], ends[i]);
+  SAFE_FREE ();
 }
 
 /* Reinitialize everything about a buffer except its name and contents
@@ -966,9 +1076,7 @@ reset_buffer (register struct buffer *b)
   b->auto_save_failure_time = 0;
   bset_auto_save_file_name (b, Qnil);
   bset_read_only (b, Qnil);
-  set_buffer_overlays_before (b, NULL);
-  set_buffer_overlays_after (b, NULL);
-  b->overlay_center = BEG;
+  b->overlays = NULL;
   bset_mark_active (b, Qnil);
   bset_point_before_scroll (b, Qnil);
   bset_file_format (b, Qnil);
@@ -1691,8 +1799,9 @@ compact_buffer (struct buffer *buffer)
       if (!EQ (BVAR(buffer, undo_list), Qt))
 	truncate_undo_list (buffer);
 
-      /* Shrink buffer gaps.  */
-      if (!buffer->text->inhibit_shrinking)
+      /* Shrink buffer gaps, but not those of mapped files, which
+	 would have to be copied into memory for that.  */
+      if (!buffer->text->inhibit_shrinking && !buffer->text->mapped)
 	{
 	  /* If a buffer's gap size is more than 10% of the buffer
 	     size, or larger than GAP_BYTES_DFL bytes, then shrink it
@@ -1893,17 +2002,10 @@ DEFUN ("kill-buffer", Fkill_buffer, Skill_buffer, 0, 1, "bKill buffer: ",
       /* Unchain all markers that belong to this indirect buffer.
 	 Don't unchain the markers that belong to the base buffer
 	 or its other indirect buffers.  */
-      struct Lisp_Marker **mp = &BUF_MARKERS (b);
-      while ((m = *mp))
-	{
-	  if (m->buffer == b)
-	    {
-	      m->buffer = NULL;
-	      *mp = m->next;
-	    }
-	  else
-	    mp = &m->next;
-	}
+      FOR_EACH_MARKER (b, m)
+	if (m->buffer == b)
+	  m->buffer = NULL;
+      prune_markers (b);
       /* Intervals should be owned by the base buffer (Bug#16502).  */
       i = buffer_intervals (b);
       if (i)
@@ -1917,22 +2019,17 @@ DEFUN ("kill-buffer", Fkill_buffer, Skill_buffer, 0, 1, "bKill buffer: ",
     {
       /* Unchain all markers of this buffer and its indirect buffers.
 	 and leave them pointing nowhere.  */
-      for (m = BUF_MARKERS (b); m; )
-	{
-	  struct Lisp_Marker *next = m->next;
-	  m->buffer = 0;
-	  m->next = NULL;
-	  m = next;
-	}
-      BUF_MARKERS (b) = NULL;
+      FOR_EACH_MARKER (b, m)
+	m->buffer = 0;
+      prune_markers (b);
       set_buffer_intervals (b, NULL);
 
       /* Perhaps we should explicitly free the interval tree here...  */
     }
   /* Since we've unlinked the markers, the overlays can't be here any more
      either.  */
-  b->overlays_before = NULL;
-  b->overlays_after = NULL;
+  delete_all_overlays (b);
+  free_buffer_overlays (b);
 
   /* Reset the local variables, so that this buffer's local values
      won't be protected from GC.  They would be protected
@@ -1975,6 +2072,11 @@ DEFUN ("kill-buffer", Fkill_buffer, Skill_buffer, 0, 1, "bKill buffer: ",
       free_region_cache (b->bidi_paragraph_cache);
       b->bidi_paragraph_cache = 0;
     }
+  if (b->parse_state_cache)
+    {
+      free_parse_state_cache (b->parse_state_cache);
+      b->parse_state_cache = 0;
+    }
   bset_width_table (b, Qnil);
   unblock_input ();
 
@@ -2407,11 +2509,10 @@ #define swapfield_(field, type) \
   swapfield (newline_cache, struct region_cache *);
   swapfield (width_run_cache, struct region_cache *);
   swapfield (bidi_paragraph_cache, struct region_cache *);
+  swapfield (parse_state_cache, struct parse_state_cache *);
   current_buffer->prevent_redisplay_optimizations_p = 1;
   other_buffer->prevent_redisplay_optimizations_p = 1;
-  swapfield (overlays_before, struct Lisp_Overlay *);
-  swapfield (overlays_after, struct Lisp_Overlay *);
-  swapfield (overlay_center, ptrdiff_t);
+  swapfield (overlays, struct itree_tree *);
   swapfield_ (undo_list, Lisp_Object);
   swapfield_ (mark, Lisp_Object);
   swapfield_ (enable_multibyte_characters, Lisp_Object);
@@ -2439,14 +2540,14 @@ #define swapfield_(field, type) \
   other_buffer->text->end_unchanged = other_buffer->text->gpt;
   {
     struct Lisp_Marker *m;
-    for (m = BUF_MARKERS (current_buffer); m; m = m->next)
+    FOR_EACH_MARKER (current_buffer, m)
       if (m->buffer == other_buffer)
 	m->buffer = current_buffer;
       else
 	/* Since there's no indirect buffer in sight, markers on
 	   BUF_MARKERS(buf) should either be for `buf' or dead.  */
 	eassert (!m->buffer);
-    for (m = BUF_MARKERS (other_buffer); m; m = m->next)
+    FOR_EACH_MARKER (other_buffer, m)
       if (m->buffer == current_buffer)
 	m->buffer = other_buffer;
       else
@@ -2454,6 +2555,18 @@ #define swapfield_(field, type) \
 	   BUF_MARKERS(buf) should either be for `buf' or dead.  */
 	eassert (!m->buffer);
   }
+  { /* The overlay trees were swapped as well, so make the overlays
+       point back to the buffer that now owns them.  */
+    struct itree_node *node;
+    if (current_buffer->overlays)
+      ITREE_FOREACH (node, current_buffer->overlays,
+		     PTRDIFF_MIN, PTRDIFF_MAX, ASCENDING)
+	XOVERLAY (node->data)->buffer = current_buffer;
+    if (other_buffer->overlays)
+      ITREE_FOREACH (node, other_buffer->overlays,
+		     PTRDIFF_MIN, PTRDIFF_MAX, ASCENDING)
+	XOVERLAY (node->data)->buffer = other_buffer;
+  }
   { /* Some of the C code expects that both window markers of a
        live window points to that window's buffer.  So since we
        just swapped the markers between the two buffers, we need
@@ -2532,8 +2645,10 @@ DEFUN ("set-buffer-multibyte", Fset_buffer_multibyte, Sset_buffer_multibyte,
      instead.  */
   bset_undo_list (current_buffer, Qt);
 
-  /* If the cached position is for this buffer, clear it out.  */
+  /* If the cached position is for this buffer, clear it out, and
+     forget the index of positions, which is about to go stale.  */
   clear_charpos_cache (current_buffer);
+  clear_char_index (current_buffer);
 
   if (NILP (flag))
     begv = BEGV_BYTE, zv = ZV_BYTE;
@@ -2553,6 +2668,8 @@ DEFUN ("set-buffer-multibyte", Fset_buffer_multibyte, Sset_buffer_multibyte,
       /* Do this first, so it can use CHAR_TO_BYTE
 	 to calculate the old correspondences.  */
       set_intervals_multibyte (0);
+      set_overlays_multibyte (0);
+      clear_char_index (current_buffer);
 
       bset_enable_multibyte_characters (current_buffer, Qnil);
 
@@ -2563,7 +2680,7 @@ DEFUN ("set-buffer-multibyte", Fset_buffer_multibyte, Sset_buffer_multibyte,
       TEMP_SET_PT_BOTH (PT_BYTE, PT_BYTE);
 
 
-      for (tail = BUF_MARKERS (current_buffer); tail; tail = tail->next)
+      FOR_EACH_MARKER (current_buffer, tail)
 	tail->charpos = tail->bytepos;
 
       /* Convert multibyte form of 8-bit characters to unibyte.  */
@@ -2613,6 +2730,9 @@ DEFUN ("set-buffer-multibyte", Fset_buffer_multibyte, Sset_buffer_multibyte,
       ptrdiff_t pos, stop;
       unsigned char *p, *pend;
 
+      /* Multibyte text must not change behind our back.  */
+      unmap_buffer_text (current_buffer);
+
       /* Be sure not to have a multibyte sequence striding over the GAP.
 	 Ex: We change this: "...abc\302 _GAP_ \241def..."
 	     to: "...abc _GAP_ \302\241def..."  */
@@ -2719,14 +2839,16 @@ DEFUN ("set-buffer-multibyte", Fset_buffer_multibyte, Sset_buffer_multibyte,
 	TEMP_SET_PT_BOTH (position, byte);
       }
 
-      tail = markers = BUF_MARKERS (current_buffer);
+      tail = marker_tree_first (current_buffer, BEG);
+      markers = BUF_MARKERS (current_buffer);
 
       /* This prevents BYTE_TO_CHAR (that is, buf_bytepos_to_charpos) from
-	 getting confused by the markers that have not yet been updated.
-	 It is also a signal that it should never create a marker.  */
+	 getting confused by the markers that have not yet been updated.  */
       BUF_MARKERS (current_buffer) = NULL;
 
-      for (; tail; tail = tail->next)
+      /* Both positions only grow along the tree, so updating them in
+	 order keeps it sorted.  */
+      for (; tail; tail = marker_tree_next (current_buffer, tail))
 	{
 	  tail->bytepos = advance_to_char_boundary (tail->bytepos);
 	  tail->charpos = BYTE_TO_CHAR (tail->bytepos);
@@ -2745,6 +2867,7 @@ DEFUN ("set-buffer-multibyte", Fset_buffer_multibyte, Sset_buffer_multibyte,
          away all the text-properties instead of trying to guess how
          to adjust them?  AFAICT the result is not reliable anyway.  */
       set_intervals_multibyte (1);
+      set_overlays_multibyte (1);
     }
 
   if (!EQ (old_undo, Qt))
@@ -2825,15 +2948,32 @@ DEFUN ("kill-all-local-variables", Fkill_all_local_variables,
 }
 
 
+/* Store OVERLAY as element IDX of the vector *VEC_PTR of size
+   *LEN_PTR.  If IDX is past its end, make it bigger if EXTEND, or else
+   don't store anything.  */
+
+static void
+record_overlay (Lisp_Object overlay, ptrdiff_t idx, bool extend,
+		Lisp_Object **vec_ptr, ptrdiff_t *len_ptr)
+{
+  if (idx >= *len_ptr)
+    {
+      /* The supplied vector is full.
+	 Either make it bigger, or don't store any more in it.  */
+      if (!extend)
+	return;
+      *vec_ptr = xpalloc (*vec_ptr, len_ptr, 1, OVERLAY_COUNT_MAX,
+			  sizeof **vec_ptr);
+    }
+  (*vec_ptr)[idx] = overlay;
+}
+
 /* Find all the overlays in the current buffer that contain position POS.
    Return the number found, and store them in a vector in *VEC_PTR.
    Store in *LEN_PTR the size allocated for the vector.
    Store in *NEXT_PTR the next position after POS where an overlay starts,
      or ZV if there are no more overlays between POS and ZV.
-   Store in *PREV_PTR the previous position before POS where an overlay ends,
-     or where an overlay starts which ends at or after POS;
-     or BEGV if there are no such overlays from BEGV to POS.
-   NEXT_PTR and/or PREV_PTR may be 0, meaning don't store that info.
+   NEXT_PTR may be 0, meaning don't store that info.
 
    *VEC_PTR and *LEN_PTR should contain a valid vector and size
    when this function is called.
@@ -2841,131 +2981,45 @@ DEFUN ("kill-all-local-variables", Fkill_all_local_variables,
    If EXTEND, make the vector bigger if necessary.
    If not, never extend the vector,
    and store only as many overlays as will fit.
-   But still return the total number of overlays.
-
-   If CHANGE_REQ, any position written into *PREV_PTR or
-   *NEXT_PTR is guaranteed to be not equal to POS, unless it is the
-   default (BEGV or ZV).  */
+   But still return the total number of overlays.  */
 
 ptrdiff_t
 overlays_at (EMACS_INT pos, bool extend, Lisp_Object **vec_ptr,
-	     ptrdiff_t *len_ptr,
-	     ptrdiff_t *next_ptr, ptrdiff_t *prev_ptr, bool change_req)
+	     ptrdiff_t *len_ptr, ptrdiff_t *next_ptr)
 {
   ptrdiff_t idx = 0;
-  ptrdiff_t len = *len_ptr;
-  Lisp_Object *vec = *vec_ptr;
   ptrdiff_t next = ZV;
-  ptrdiff_t prev = BEGV;
-  bool inhibit_storing = 0;
+  struct itree_node *node;
 
-  for (struct Lisp_Overlay *tail = current_buffer->overlays_before;
-       tail; tail = tail->next)
+  ITREE_FOREACH (node, current_buffer->overlays, pos, next, ASCENDING)
     {
-      Lisp_Object overlay = make_lisp_ptr (tail, Lisp_Vectorlike);
-      Lisp_Object start = OVERLAY_START (overlay);
-      Lisp_Object end = OVERLAY_END (overlay);
-      ptrdiff_t endpos = OVERLAY_POSITION (end);
-      if (endpos < pos)
+      if (node->begin > pos)
 	{
-	  if (prev < endpos)
-	    prev = endpos;
+	  /* The nodes come in order of their start, so this is the
+	     next overlay start and no other overlay can contain POS.  */
+	  eassert (node->begin <= next);
+	  next = node->begin;
 	  break;
 	}
-      ptrdiff_t startpos = OVERLAY_POSITION (start);
-      /* This one ends at or after POS
-	 so its start counts for PREV_PTR if it's before POS.  */
-      if (prev < startpos && startpos < pos)
-	prev = startpos;
-      if (endpos == pos)
-	continue;
-      if (startpos <= pos)
+      if (pos < node->end)
 	{
-	  if (idx == len)
-	    {
-	      /* The supplied vector is full.
-		 Either make it bigger, or don't store any more in it.  */
-	      if (extend)
-		{
-		  vec = xpalloc (vec, len_ptr, 1, OVERLAY_COUNT_MAX,
-				 sizeof *vec);
-		  *vec_ptr = vec;
-		  len = *len_ptr;
-		}
-	      else
-		inhibit_storing = 1;
-	    }
-
-	  if (!inhibit_storing)
-	    vec[idx] = overlay;
+	  record_overlay (node->data, idx, extend, vec_ptr, len_ptr);
 	  /* Keep counting overlays even if we can't return them all.  */
 	  idx++;
 	}
-      else if (startpos < next)
-	next = startpos;
-    }
-
-  for (struct Lisp_Overlay *tail = current_buffer->overlays_after;
-       tail; tail = tail->next)
-    {
-      Lisp_Object overlay = make_lisp_ptr (tail, Lisp_Vectorlike);
-      Lisp_Object start = OVERLAY_START (overlay);
-      Lisp_Object end = OVERLAY_END (overlay);
-      ptrdiff_t startpos = OVERLAY_POSITION (start);
-      if (pos < startpos)
-	{
-	  if (startpos < next)
-	    next = startpos;
-	  break;
-	}
-      ptrdiff_t endpos = OVERLAY_POSITION (end);
-      if (pos < endpos)
-	{
-	  if (idx == len)
-	    {
-	      if (extend)
-		{
-		  vec = xpalloc (vec, len_ptr, 1, OVERLAY_COUNT_MAX,
-				 sizeof *vec);
-		  *vec_ptr = vec;
-		  len = *len_ptr;
-		}
-	      else
-		inhibit_storing = 1;
-	    }
-
-	  if (!inhibit_storing)
-	    vec[idx] = overlay;
-	  idx++;
-
-	  if (startpos < pos && startpos > prev)
-	    prev = startpos;
-	}
-      else if (endpos < pos && endpos > prev)
-	prev = endpos;
-      else if (endpos == pos && startpos > prev
-	       && (!change_req || startpos < pos))
-	prev = startpos;
     }
 
   if (next_ptr)
     *next_ptr = next;
-  if (prev_ptr)
-    *prev_ptr = prev;
   return idx;
 }
-
+
 /* Find all the overlays in the current buffer that overlap the range
    BEG-END, or are empty at BEG, or are empty at END provided END
    denotes the position at the end of the current buffer.
 
    Return the number found, and store them in a vector in *VEC_PTR.
    Store in *LEN_PTR the size allocated for the vector.
-   Store in *NEXT_PTR the next position after POS where an overlay starts,
-     or ZV if there are no more overlays.
-   Store in *PREV_PTR the previous position before POS where an overlay ends,
-     or BEGV if there are no previous overlays.
-   NEXT_PTR and/or PREV_PTR may be 0, meaning don't store that info.
 
    *VEC_PTR and *LEN_PTR should contain a valid vector and size
    when this function is called.
@@ -2977,109 +3031,79 @@ overlays_at (EMACS_INT pos, bool extend, Lisp_Object **vec_ptr,
 
 static ptrdiff_t
 overlays_in (EMACS_INT beg, EMACS_INT end, bool extend,
-	     Lisp_Object **vec_ptr, ptrdiff_t *len_ptr,
-	     ptrdiff_t *next_ptr, ptrdiff_t *prev_ptr)
+	     Lisp_Object **vec_ptr, ptrdiff_t *len_ptr)
 {
   ptrdiff_t idx = 0;
-  ptrdiff_t len = *len_ptr;
-  Lisp_Object *vec = *vec_ptr;
-  ptrdiff_t next = ZV;
-  ptrdiff_t prev = BEGV;
-  bool inhibit_storing = 0;
   bool end_is_Z = end == Z;
+  struct itree_node *node;
 
-  for (struct Lisp_Overlay *tail = current_buffer->overlays_before;
-       tail; tail = tail->next)
+  ITREE_FOREACH (node, current_buffer->overlays, beg, end, ASCENDING)
     {
-      Lisp_Object overlay = make_lisp_ptr (tail, Lisp_Vectorlike);
-      Lisp_Object ostart = OVERLAY_START (overlay);
-      Lisp_Object oend = OVERLAY_END (overlay);
-      ptrdiff_t endpos = OVERLAY_POSITION (oend);
-      if (endpos < beg)
-	{
-	  if (prev < endpos)
-	    prev = endpos;
-	  break;
-	}
-      ptrdiff_t startpos = OVERLAY_POSITION (ostart);
       /* Count an interval if it overlaps the range, is empty at the
 	 start of the range, or is empty at END provided END denotes the
 	 end of the buffer.  */
-      if ((beg < endpos && startpos < end)
-	  || (startpos == endpos
-	      && (beg == endpos || (end_is_Z && endpos == end))))
+      if ((beg < node->end && node->begin < end)
+	  || (node->begin == node->end
+	      && (beg == node->end || (end_is_Z && node->end == end))))
 	{
-	  if (idx == len)
-	    {
-	      /* The supplied vector is full.
-		 Either make it bigger, or don't store any more in it.  */
-	      if (extend)
-		{
-		  vec = xpalloc (vec, len_ptr, 1, OVERLAY_COUNT_MAX,
-				 sizeof *vec);
-		  *vec_ptr = vec;
-		  len = *len_ptr;
-		}
-	      else
-		inhibit_storing = 1;
-	    }
-
-	  if (!inhibit_storing)
-	    vec[idx] = overlay;
+	  record_overlay (node->data, idx, extend, vec_ptr, len_ptr);
 	  /* Keep counting overlays even if we can't return them all.  */
 	  idx++;
 	}
-      else if (startpos < next)
-	next = startpos;
     }
 
-  for (struct Lisp_Overlay *tail = current_buffer->overlays_after;
-       tail; tail = tail->next)
+  return idx;
+}
+
+/* Return the next position after POS where an overlay of the current
+   buffer starts or ends, or ZV if there is none.  */
+
+ptrdiff_t
+next_overlay_change (ptrdiff_t pos)
+{
+  ptrdiff_t next = ZV;
+  struct itree_node *node;
+
+  ITREE_FOREACH (node, current_buffer->overlays, pos, next, ASCENDING)
     {
-      Lisp_Object overlay = make_lisp_ptr (tail, Lisp_Vectorlike);
-      Lisp_Object ostart = OVERLAY_START (overlay);
-      Lisp_Object oend = OVERLAY_END (overlay);
-      ptrdiff_t startpos = OVERLAY_POSITION (ostart);
-      if (end < startpos)
+      if (node->begin > pos)
 	{
-	  if (startpos < next)
-	    next = startpos;
+	  /* No later node can start or end before this one starts.  */
+	  if (node->begin < next)
+	    next = node->begin;
 	  break;
 	}
-      ptrdiff_t endpos = OVERLAY_POSITION (oend);
-      /* Count an interval if it overlaps the range, is empty at the
-	 start of the range, or is empty at END provided END denotes the
-	 end of the buffer.  */
-      if ((beg < endpos && startpos < end)
-	  || (startpos == endpos
-	      && (beg == endpos || (end_is_Z && endpos == end))))
+      else if (pos < node->end && node->end < next)
 	{
-	  if (idx == len)
-	    {
-	      if (extend)
-		{
-		  vec = xpalloc (vec, len_ptr, 1, OVERLAY_COUNT_MAX,
-				 sizeof *vec);
-		  *vec_ptr = vec;
-		  len = *len_ptr;
-		}
-	      else
-		inhibit_storing = 1;
-	    }
-
-	  if (!inhibit_storing)
-	    vec[idx] = overlay;
-	  idx++;
+	  next = node->end;
+	  ITREE_FOREACH_NARROW (pos, next);
 	}
-      else if (endpos < beg && endpos > prev)
-	prev = endpos;
     }
 
-  if (next_ptr)
-    *next_ptr = next;
-  if (prev_ptr)
-    *prev_ptr = prev;
-  return idx;
+  return next;
+}
+
+/* Return the previous position before POS where an overlay of the
+   current buffer starts or ends, or BEGV if there is none.  */
+
+ptrdiff_t
+previous_overlay_change (ptrdiff_t pos)
+{
+  ptrdiff_t prev = BEGV;
+  struct itree_node *node;
+
+  ITREE_FOREACH (node, current_buffer->overlays, prev, pos, DESCENDING)
+    {
+      if (node->end < pos && prev < node->end)
+	prev = node->end;
+      else if (node->begin < pos && prev < node->begin)
+	prev = node->begin;
+      else
+	continue;
+      ITREE_FOREACH_NARROW (prev, pos);
+    }
+
+  return prev;
 }
 
 
@@ -3089,8 +3113,8 @@ overlays_in (EMACS_INT beg, EMACS_INT end, bool extend,
 bool
 mouse_face_overlay_overlaps (Lisp_Object overlay)
 {
-  ptrdiff_t start = OVERLAY_POSITION (OVERLAY_START (overlay));
-  ptrdiff_t end = OVERLAY_POSITION (OVERLAY_END (overlay));
+  ptrdiff_t start = OVERLAY_START (overlay);
+  ptrdiff_t end = OVERLAY_END (overlay);
   ptrdiff_t n, i, size;
   Lisp_Object *v, tem;
   Lisp_Object vbuf[10];
@@ -3098,11 +3122,11 @@ mouse_face_overlay_overlaps (Lisp_Object overlay)
 
   size = ARRAYELTS (vbuf);
   v = vbuf;
-  n = overlays_in (start, end, 0, &v, &size, NULL, NULL);
+  n = overlays_in (start, end, 0, &v, &size);
   if (n > size)
     {
       SAFE_NALLOCA (v, 1, n);
-      overlays_in (start, end, 0, &v, &n, NULL, NULL);
+      overlays_in (start, end, 0, &v, &n);
     }
 
   for (i = 0; i < n; ++i)
@@ -3127,11 +3151,11 @@ disable_line_numbers_overlay_at_eob (void)
 
   size = ARRAYELTS (vbuf);
   v = vbuf;
-  n = overlays_in (ZV, ZV, 0, &v, &size, NULL, NULL);
+  n = overlays_in (ZV, ZV, 0, &v, &size);
   if (n > size)
     {
       SAFE_NALLOCA (v, 1, n);
-      overlays_in (ZV, ZV, 0, &v, &n, NULL, NULL);
+      overlays_in (ZV, ZV, 0, &v, &n);
     }
 
   for (i = 0; i < n; ++i)
@@ -3148,34 +3172,14 @@ disable_line_numbers_overlay_at_eob (void)
 bool
 overlay_touches_p (ptrdiff_t pos)
 {
-  for (struct Lisp_Overlay *tail = current_buffer->overlays_before;
-       tail; tail = tail->next)
-    {
-      Lisp_Object overlay = make_lisp_ptr (tail, Lisp_Vectorlike);
-      eassert (OVERLAYP (overlay));
-
-      ptrdiff_t endpos = OVERLAY_POSITION (OVERLAY_END (overlay));
-      if (endpos < pos)
-	break;
-      if (endpos == pos || OVERLAY_POSITION (OVERLAY_START (overlay)) == pos)
-	return 1;
-    }
-
-  for (struct Lisp_Overlay *tail = current_buffer->overlays_after;
-       tail; tail = tail->next)
-    {
-      Lisp_Object overlay = make_lisp_ptr (tail, Lisp_Vectorlike);
-      eassert (OVERLAYP (overlay));
+  struct itree_node *node;
 
-      ptrdiff_t startpos = OVERLAY_POSITION (OVERLAY_START (overlay));
-      if (pos < startpos)
-	break;
-      if (startpos == pos || OVERLAY_POSITION (OVERLAY_END (overlay)) == pos)
-	return 1;
-    }
-  return 0;
+  ITREE_FOREACH (node, current_buffer->overlays, pos, pos, ASCENDING)
+    if (node->begin == pos || node->end == pos)
+      return true;
+  return false;
 }
-
+
 struct sortvec
 {
   Lisp_Object overlay;
@@ -3234,8 +3238,8 @@ sort_overlays (Lisp_Object *overlay_vec, ptrdiff_t noverlays, struct window *w)
 
       overlay = overlay_vec[i];
       if (OVERLAYP (overlay)
-	  && OVERLAY_POSITION (OVERLAY_START (overlay)) > 0
-	  && OVERLAY_POSITION (OVERLAY_END (overlay)) > 0)
+	  && OVERLAY_START (overlay) > 0
+	  && OVERLAY_END (overlay) > 0)
 	{
 	  /* If we're interested in a specific window, then ignore
 	     overlays that are limited to some other window.  */
@@ -3250,8 +3254,8 @@ sort_overlays (Lisp_Object *overlay_vec, ptrdiff_t noverlays, struct window *w)
 
 	  /* This overlay is good and counts: put it into sortvec.  */
 	  sortvec[j].overlay = overlay;
-	  sortvec[j].beg = OVERLAY_POSITION (OVERLAY_START (overlay));
-	  sortvec[j].end = OVERLAY_POSITION (OVERLAY_END (overlay));
+	  sortvec[j].beg = OVERLAY_START (overlay);
+	  sortvec[j].end = OVERLAY_END (overlay);
 	  tem = Foverlay_get (overlay, Qpriority);
 	  if (NILP (tem))
 	    {
@@ -3387,46 +3391,14 @@ overlay_strings (ptrdiff_t pos, struct window *w, unsigned char **pstr)
 
   overlay_heads.used = overlay_heads.bytes = 0;
   overlay_tails.used = overlay_tails.bytes = 0;
-  for (struct Lisp_Overlay *ov = current_buffer->overlays_before;
-       ov; ov = ov->next)
-    {
-      Lisp_Object overlay = make_lisp_ptr (ov, Lisp_Vectorlike);
-      eassert (OVERLAYP (overlay));
-
-      ptrdiff_t startpos = OVERLAY_POSITION (OVERLAY_START (overlay));
-      ptrdiff_t endpos = OVERLAY_POSITION (OVERLAY_END (overlay));
-      if (endpos < pos)
-	break;
-      if (endpos != pos && startpos != pos)
-	continue;
-      Lisp_Object window = Foverlay_get (overlay, Qwindow);
-      if (WINDOWP (window) && XWINDOW (window) != w)
-	continue;
-      Lisp_Object str;
-      if (startpos == pos
-	  && (str = Foverlay_get (overlay, Qbefore_string), STRINGP (str)))
-	record_overlay_string (&overlay_heads, str,
-			       (startpos == endpos
-				? Foverlay_get (overlay, Qafter_string)
-				: Qnil),
-			       Foverlay_get (overlay, Qpriority),
-			       endpos - startpos);
-      else if (endpos == pos
-	  && (str = Foverlay_get (overlay, Qafter_string), STRINGP (str)))
-	record_overlay_string (&overlay_tails, str, Qnil,
-			       Foverlay_get (overlay, Qpriority),
-			       endpos - startpos);
-    }
-  for (struct Lisp_Overlay *ov = current_buffer->overlays_after;
-       ov; ov = ov->next)
+  struct itree_node *node;
+  ITREE_FOREACH (node, current_buffer->overlays, pos, pos, ASCENDING)
     {
-      Lisp_Object overlay = make_lisp_ptr (ov, Lisp_Vectorlike);
+      Lisp_Object overlay = node->data;
       eassert (OVERLAYP (overlay));
 
-      ptrdiff_t startpos = OVERLAY_POSITION (OVERLAY_START (overlay));
-      ptrdiff_t endpos = OVERLAY_POSITION (OVERLAY_END (overlay));
-      if (startpos > pos)
-	break;
+      ptrdiff_t startpos = node->begin;
+      ptrdiff_t endpos = node->end;
       if (endpos != pos && startpos != pos)
 	continue;
       Lisp_Object window = Foverlay_get (overlay, Qwindow);
@@ -3502,379 +3474,130 @@ overlay_strings (ptrdiff_t pos, struct window *w, unsigned char **pstr)
   return 0;
 }
 
-/* Shift overlays in BUF's overlay lists, to center the lists at POS.  */
+/* Adjust the overlays of the current buffer, and of all the buffers
+   sharing its text, for an insertion of LENGTH characters at POS.
+   BEFORE_MARKERS says to treat all overlay ends at POS as advancing,
+   as for `insert-before-markers'.  */
 
 void
-recenter_overlay_lists (struct buffer *buf, ptrdiff_t pos)
+adjust_overlays_for_insert (ptrdiff_t pos, ptrdiff_t length,
+			    bool before_markers)
 {
-  struct Lisp_Overlay *prev, *next;
-
-  /* See if anything in overlays_before should move to overlays_after.  */
-
-  /* We don't strictly need prev in this loop; it should always be nil.
-     But we use it for symmetry and in case that should cease to be true
-     with some future change.  */
-  prev = NULL;
-  for (struct Lisp_Overlay *tail = buf->overlays_before;
-       tail; prev = tail, tail = next)
-    {
-      next = tail->next;
-      Lisp_Object overlay = make_lisp_ptr (tail, Lisp_Vectorlike);
-      eassert (OVERLAYP (overlay));
-
-      Lisp_Object beg = OVERLAY_START (overlay);
-      Lisp_Object end = OVERLAY_END (overlay);
-
-      if (OVERLAY_POSITION (end) > pos)
-	{
-	  /* OVERLAY needs to be moved.  */
-	  ptrdiff_t where = OVERLAY_POSITION (beg);
-	  struct Lisp_Overlay *other, *other_prev;
-
-	  /* Splice the cons cell TAIL out of overlays_before.  */
-	  if (prev)
-	    prev->next = next;
-	  else
-	    set_buffer_overlays_before (buf, next);
-
-	  /* Search thru overlays_after for where to put it.  */
-	  other_prev = NULL;
-	  for (other = buf->overlays_after; other;
-	       other_prev = other, other = other->next)
-	    {
-	      Lisp_Object otheroverlay = make_lisp_ptr (other, Lisp_Vectorlike);
-	      eassert (OVERLAYP (otheroverlay));
-
-	      Lisp_Object otherbeg = OVERLAY_START (otheroverlay);
-	      if (OVERLAY_POSITION (otherbeg) >= where)
-		break;
-	    }
-
-	  /* Add TAIL to overlays_after before OTHER.  */
-	  tail->next = other;
-	  if (other_prev)
-	    other_prev->next = tail;
-	  else
-	    set_buffer_overlays_after (buf, tail);
-	  tail = prev;
-	}
-      else
-	/* We've reached the things that should stay in overlays_before.
-	   All the rest of overlays_before must end even earlier,
-	   so stop now.  */
-	break;
-    }
-
-  /* See if anything in overlays_after should be in overlays_before.  */
-  prev = NULL;
-  for (struct Lisp_Overlay *tail = buf->overlays_after;
-       tail; prev = tail, tail = next)
+  if (!current_buffer->indirections)
+    itree_insert_gap (current_buffer->overlays, pos, length, before_markers);
+  else
     {
-      next = tail->next;
-      Lisp_Object overlay = make_lisp_ptr (tail, Lisp_Vectorlike);
-      eassert (OVERLAYP (overlay));
-
-      Lisp_Object beg = OVERLAY_START (overlay);
-      Lisp_Object end = OVERLAY_END (overlay);
-
-      /* Stop looking, when we know that nothing further
-	 can possibly end before POS.  */
-      if (OVERLAY_POSITION (beg) > pos)
-	break;
-
-      if (OVERLAY_POSITION (end) <= pos)
-	{
-	  /* OVERLAY needs to be moved.  */
-	  ptrdiff_t where = OVERLAY_POSITION (end);
-	  struct Lisp_Overlay *other, *other_prev;
-
-	  /* Splice the cons cell TAIL out of overlays_after.  */
-	  if (prev)
-	    prev->next = next;
-	  else
-	    set_buffer_overlays_after (buf, next);
-
-	  /* Search thru overlays_before for where to put it.  */
-	  other_prev = NULL;
-	  for (other = buf->overlays_before; other;
-	       other_prev = other, other = other->next)
-	    {
-	      Lisp_Object otheroverlay = make_lisp_ptr (other, Lisp_Vectorlike);
-	      eassert (OVERLAYP (otheroverlay));
-
-	      Lisp_Object otherend = OVERLAY_END (otheroverlay);
-	      if (OVERLAY_POSITION (otherend) <= where)
-		break;
-	    }
-
-	  /* Add TAIL to overlays_before before OTHER.  */
-	  tail->next = other;
-	  if (other_prev)
-	    other_prev->next = tail;
-	  else
-	    set_buffer_overlays_before (buf, tail);
-	  tail = prev;
-	}
+      struct buffer *base = (current_buffer->base_buffer
+			     ? current_buffer->base_buffer
+			     : current_buffer);
+      Lisp_Object tail, other;
+      itree_insert_gap (base->overlays, pos, length, before_markers);
+      FOR_EACH_LIVE_BUFFER (tail, other)
+	if (XBUFFER (other)->base_buffer == base)
+	  itree_insert_gap (XBUFFER (other)->overlays, pos, length,
+			    before_markers);
     }
-
-  buf->overlay_center = pos;
 }
 
-void
-adjust_overlays_for_insert (ptrdiff_t pos, ptrdiff_t length)
-{
-  /* After an insertion, the lists are still sorted properly,
-     but we may need to update the value of the overlay center.  */
-  if (current_buffer->overlay_center >= pos)
-    current_buffer->overlay_center += length;
-}
+/* Adjust the overlays of the current buffer, and of all the buffers
+   sharing its text, for a deletion of LENGTH characters at POS.  */
 
 void
 adjust_overlays_for_delete (ptrdiff_t pos, ptrdiff_t length)
 {
-  if (current_buffer->overlay_center < pos)
-    /* The deletion was to our right.  No change needed; the before- and
-       after-lists are still consistent.  */
-    ;
-  else if (current_buffer->overlay_center - pos > length)
-    /* The deletion was to our left.  We need to adjust the center value
-       to account for the change in position, but the lists are consistent
-       given the new value.  */
-    current_buffer->overlay_center -= length;
+  if (!current_buffer->indirections)
+    itree_delete_gap (current_buffer->overlays, pos, length);
   else
-    /* We're right in the middle.  There might be things on the after-list
-       that now belong on the before-list.  Recentering will move them,
-       and also update the center point.  */
-    recenter_overlay_lists (current_buffer, pos);
-}
-
-/* Fix up overlays that were garbled as a result of permuting markers
-   in the range START through END.  Any overlay with at least one
-   endpoint in this range will need to be unlinked from the overlay
-   list and reinserted in its proper place.
-   Such an overlay might even have negative size at this point.
-   If so, we'll make the overlay empty. */
-void
-fix_start_end_in_overlays (register ptrdiff_t start, register ptrdiff_t end)
-{
-  struct Lisp_Overlay *before_list UNINIT;
-  struct Lisp_Overlay *after_list UNINIT;
-  /* These are either nil, indicating that before_list or after_list
-     should be assigned, or the cons cell the cdr of which should be
-     assigned.  */
-  struct Lisp_Overlay *beforep = NULL, *afterp = NULL;
-  /* 'Parent', likewise, indicates a cons cell or
-     current_buffer->overlays_before or overlays_after, depending
-     which loop we're in.  */
-  struct Lisp_Overlay *parent;
-
-  /* This algorithm shifts links around instead of consing and GCing.
-     The loop invariant is that before_list (resp. after_list) is a
-     well-formed list except that its last element, the CDR of beforep
-     (resp. afterp) if beforep (afterp) isn't nil or before_list
-     (after_list) if it is, is still uninitialized.  So it's not a bug
-     that before_list isn't initialized, although it may look
-     strange.  */
-  parent = NULL;
-  for (struct Lisp_Overlay *tail = current_buffer->overlays_before;
-       tail; tail = tail->next)
     {
-      Lisp_Object overlay = make_lisp_ptr (tail, Lisp_Vectorlike);
-
-      ptrdiff_t endpos = OVERLAY_POSITION (OVERLAY_END (overlay));
-      ptrdiff_t startpos = OVERLAY_POSITION (OVERLAY_START (overlay));
-
-      /* If the overlay is backwards, make it empty.  */
-      if (endpos < startpos)
-	{
-	  startpos = endpos;
-	  Fset_marker (OVERLAY_START (overlay), make_fixnum (startpos),
-		       Qnil);
-	}
-
-      if (endpos < start)
-	break;
-
-      if (endpos < end
-	  || (startpos >= start && startpos < end))
-	{
-	  /* Add it to the end of the wrong list.  Later on,
-	     recenter_overlay_lists will move it to the right place.  */
-	  if (endpos < current_buffer->overlay_center)
-	    {
-	      if (!afterp)
-		after_list = tail;
-	      else
-		afterp->next = tail;
-	      afterp = tail;
-	    }
-	  else
-	    {
-	      if (!beforep)
-		before_list = tail;
-	      else
-		beforep->next = tail;
-	      beforep = tail;
-	    }
-	  if (!parent)
-	    set_buffer_overlays_before (current_buffer, tail->next);
-	  else
-	    parent->next = tail->next;
-	}
-      else
-	parent = tail;
+      struct buffer *base = (current_buffer->base_buffer
+			     ? current_buffer->base_buffer
+			     : current_buffer);
+      Lisp_Object tail, other;
+      itree_delete_gap (base->overlays, pos, length);
+      FOR_EACH_LIVE_BUFFER (tail, other)
+	if (XBUFFER (other)->base_buffer == base)
+	  itree_delete_gap (XBUFFER (other)->overlays, pos, length);
     }
-  parent = NULL;
-  for (struct Lisp_Overlay *tail = current_buffer->overlays_after;
-       tail; tail = tail->next)
-    {
-      Lisp_Object overlay = make_lisp_ptr (tail, Lisp_Vectorlike);
-
-      ptrdiff_t startpos = OVERLAY_POSITION (OVERLAY_START (overlay));
-      ptrdiff_t endpos = OVERLAY_POSITION (OVERLAY_END (overlay));
+}
 
-      /* If the overlay is backwards, make it empty.  */
-      if (endpos < startpos)
-	{
-	  startpos = endpos;
-	  Fset_marker (OVERLAY_START (overlay), make_fixnum (startpos),
-		       Qnil);
-	}
+/* Move the overlay ends of buffer B lying in the region START1..END2
+   the way `transpose-regions' moves the text of START1..END1 and
+   START2..END2, END1 <= START2.  An overlay whose ends get out of
+   order is made empty.  */
 
-      if (startpos >= end)
-	break;
+static void
+transpose_buffer_overlays (struct buffer *b, ptrdiff_t start1,
+			   ptrdiff_t end1, ptrdiff_t start2, ptrdiff_t end2)
+{
+  if (! b->overlays)
+    return;
 
-      if (startpos >= start
-	  || (endpos >= start && endpos < end))
-	{
-	  if (endpos < current_buffer->overlay_center)
-	    {
-	      if (!afterp)
-		after_list = tail;
-	      else
-		afterp->next = tail;
-	      afterp = tail;
-	    }
-	  else
-	    {
-	      if (!beforep)
-		before_list = tail;
-	      else
-		beforep->next = tail;
-	      beforep = tail;
-	    }
-	  if (!parent)
-	    set_buffer_overlays_after (current_buffer, tail->next);
-	  else
-	    parent->next = tail->next;
-	}
-      else
-	parent = tail;
-    }
+  ptrdiff_t amt1 = (end2 - start2) + (start2 - end1);
+  ptrdiff_t amt2 = (end1 - start1) + (start2 - end1);
+  ptrdiff_t diff = (end2 - start2) - (end1 - start1);
+  struct itree_node *node;
+  intmax_t n = 0;
+  USE_SAFE_ALLOCA;
+  struct itree_node **nodes;
 
-  /* Splice the constructed (wrong) lists into the buffer's lists,
-     and let the recenter function make it sane again.  */
-  if (beforep)
+  ITREE_FOREACH (node, b->overlays, start1, end2, ASCENDING)
+    n++;
+  if (n == 0)
     {
-      beforep->next = current_buffer->overlays_before;
-      set_buffer_overlays_before (current_buffer, before_list);
+      SAFE_FREE ();
+      return;
     }
+  SAFE_NALLOCA (nodes, 1, n);
+  n = 0;
+  ITREE_FOREACH (node, b->overlays, start1, end2, ASCENDING)
+    nodes[n++] = node;
 
-  if (afterp)
+  for (intmax_t i = 0; i < n; i++)
     {
-      afterp->next = current_buffer->overlays_after;
-      set_buffer_overlays_after (current_buffer, after_list);
+      ptrdiff_t pos[2];
+      node = nodes[i];
+      pos[0] = itree_node_begin (b->overlays, node);
+      pos[1] = itree_node_end (b->overlays, node);
+      /* This is the same mapping as in transpose_markers.  */
+      for (int j = 0; j < 2; j++)
+	if (start1 <= pos[j] && pos[j] < end2)
+	  {
+	    if (pos[j] < end1)
+	      pos[j] += amt1;
+	    else if (pos[j] < start2)
+	      pos[j] += diff;
+	    else
+	      pos[j] -= amt2;
+	  }
+      /* If the overlay is backwards, make it empty.  */
+      if (pos[1] < pos[0])
+	pos[0] = pos[1];
+      itree_node_set_region (b->overlays, node, pos[0], pos[1]);
     }
-  recenter_overlay_lists (current_buffer, current_buffer->overlay_center);
+  SAFE_FREE ();
 }
 
-/* We have two types of overlay: the one whose ending marker is
-   after-insertion-marker (this is the usual case) and the one whose
-   ending marker is before-insertion-marker.  When `overlays_before'
-   contains overlays of the latter type and the former type in this
-   order and both overlays end at inserting position, inserting a text
-   increases only the ending marker of the latter type, which results
-   in incorrect ordering of `overlays_before'.
-
-   This function fixes ordering of overlays in the slot
-   `overlays_before' of the buffer *BP.  Before the insertion, `point'
-   was at PREV, and now is at POS.  */
+/* Adjust the overlays of the current buffer, and of all the buffers
+   sharing its text, for the transposition of the regions START1..END1
+   and START2..END2, where END1 <= START2.  */
 
 void
-fix_overlays_before (struct buffer *bp, ptrdiff_t prev, ptrdiff_t pos)
+transpose_overlays (ptrdiff_t start1, ptrdiff_t end1,
+		    ptrdiff_t start2, ptrdiff_t end2)
 {
-  /* If parent is nil, replace overlays_before; otherwise, parent->next.  */
-  struct Lisp_Overlay *tail = bp->overlays_before, *parent = NULL, *right_pair;
-  Lisp_Object tem;
-  ptrdiff_t end UNINIT;
-
-  /* After the insertion, the several overlays may be in incorrect
-     order.  The possibility is that, in the list `overlays_before',
-     an overlay which ends at POS appears after an overlay which ends
-     at PREV.  Since POS is greater than PREV, we must fix the
-     ordering of these overlays, by moving overlays ends at POS before
-     the overlays ends at PREV.  */
-
-  /* At first, find a place where disordered overlays should be linked
-     in.  It is where an overlay which end before POS exists. (i.e. an
-     overlay whose ending marker is after-insertion-marker if disorder
-     exists).  */
-  while (tail
-	 && (tem = make_lisp_ptr (tail, Lisp_Vectorlike),
-	     (end = OVERLAY_POSITION (OVERLAY_END (tem))) >= pos))
-    {
-      parent = tail;
-      tail = tail->next;
-    }
-
-  /* If we don't find such an overlay,
-     or the found one ends before PREV,
-     or the found one is the last one in the list,
-     we don't have to fix anything.  */
-  if (!tail || end < prev || !tail->next)
-    return;
-
-  right_pair = parent;
-  parent = tail;
-  tail = tail->next;
-
-  /* Now, end position of overlays in the list TAIL should be before
-     or equal to PREV.  In the loop, an overlay which ends at POS is
-     moved ahead to the place indicated by the CDR of RIGHT_PAIR.  If
-     we found an overlay which ends before PREV, the remaining
-     overlays are in correct order.  */
-  while (tail)
+  if (!current_buffer->indirections)
+    transpose_buffer_overlays (current_buffer, start1, end1, start2, end2);
+  else
     {
-      tem = make_lisp_ptr (tail, Lisp_Vectorlike);
-      end = OVERLAY_POSITION (OVERLAY_END (tem));
-
-      if (end == pos)
-	{			/* This overlay is disordered. */
-	  struct Lisp_Overlay *found = tail;
-
-	  /* Unlink the found overlay.  */
-	  tail = found->next;
-	  parent->next = tail;
-	  /* Move an overlay at RIGHT_PLACE to the next of the found one,
-	     and link it into the right place.  */
-	  if (!right_pair)
-	    {
-	      found->next = bp->overlays_before;
-	      set_buffer_overlays_before (bp, found);
-	    }
-	  else
-	    {
-	      found->next = right_pair->next;
-	      right_pair->next = found;
-	    }
-	}
-      else if (end == prev)
-	{
-	  parent = tail;
-	  tail = tail->next;
-	}
-      else			/* No more disordered overlay. */
-	break;
+      struct buffer *base = (current_buffer->base_buffer
+			     ? current_buffer->base_buffer
+			     : current_buffer);
+      Lisp_Object tail, other;
+      transpose_buffer_overlays (base, start1, end1, start2, end2);
+      FOR_EACH_LIVE_BUFFER (tail, other)
+	if (XBUFFER (other)->base_buffer == base)
+	  transpose_buffer_overlays (XBUFFER (other), start1, end1,
+				     start2, end2);
     }
 }
 
@@ -3898,8 +3621,9 @@ DEFUN ("make-overlay", Fmake_overlay, Smake_overlay, 2, 5, 0,
   (Lisp_Object beg, Lisp_Object end, Lisp_Object buffer,
    Lisp_Object front_advance, Lisp_Object rear_advance)
 {
-  Lisp_Object overlay;
+  Lisp_Object ov;
   struct buffer *b;
+  ptrdiff_t obeg, oend;
 
   if (NILP (buffer))
     XSETBUFFER (buffer, current_buffer);
@@ -3921,38 +3645,18 @@ DEFUN ("make-overlay", Fmake_overlay, Smake_overlay, 2, 5, 0,
     }
 
   b = XBUFFER (buffer);
+  if (! BUFFER_LIVE_P (b))
+    error ("Attempt to create an overlay in a dead buffer");
 
-  beg = Fset_marker (Fmake_marker (), beg, buffer);
-  end = Fset_marker (Fmake_marker (), end, buffer);
-
-  if (!NILP (front_advance))
-    XMARKER (beg)->insertion_type = 1;
-  if (!NILP (rear_advance))
-    XMARKER (end)->insertion_type = 1;
-
-  overlay = build_overlay (beg, end, Qnil);
-
-  /* Put the new overlay on the wrong list.  */
-  end = OVERLAY_END (overlay);
-  if (OVERLAY_POSITION (end) < b->overlay_center)
-    {
-      eassert (b->overlays_after || (XOVERLAY (overlay)->next == NULL));
-      XOVERLAY (overlay)->next = b->overlays_after;
-      set_buffer_overlays_after (b, XOVERLAY (overlay));
-    }
-  else
-    {
-      eassert (b->overlays_before || (XOVERLAY (overlay)->next == NULL));
-      XOVERLAY (overlay)->next = b->overlays_before;
-      set_buffer_overlays_before (b, XOVERLAY (overlay));
-    }
-  /* This puts it in the right list, and in the right order.  */
-  recenter_overlay_lists (b, b->overlay_center);
+  obeg = clip_to_bounds (BUF_BEG (b), XFIXNUM (beg), BUF_Z (b));
+  oend = clip_to_bounds (obeg, XFIXNUM (end), BUF_Z (b));
+  ov = build_overlay (! NILP (front_advance), ! NILP (rear_advance), Qnil);
+  add_buffer_overlay (b, XOVERLAY (ov), obeg, oend);
 
   /* We don't need to redisplay the region covered by the overlay, because
      the overlay has no properties at the moment.  */
 
-  return overlay;
+  return ov;
 }
 
 /* Mark a section of BUF as needing redisplay because of overlays changes.  */
@@ -3974,35 +3678,6 @@ modify_overlay (struct buffer *buf, ptrdiff_t start, ptrdiff_t end)
   modiff_incr (&BUF_OVERLAY_MODIFF (buf));
 }
 
-/* Remove OVERLAY from LIST.  */
-
-static struct Lisp_Overlay *
-unchain_overlay (struct Lisp_Overlay *list, struct Lisp_Overlay *overlay)
-{
-  register struct Lisp_Overlay *tail, **prev = &list;
-
-  for (tail = list; tail; prev = &tail->next, tail = *prev)
-    if (tail == overlay)
-      {
-	*prev = overlay->next;
-	overlay->next = NULL;
-	break;
-      }
-  return list;
-}
-
-/* Remove OVERLAY from both overlay lists of B.  */
-
-static void
-unchain_both (struct buffer *b, Lisp_Object overlay)
-{
-  struct Lisp_Overlay *ov = XOVERLAY (overlay);
-
-  set_buffer_overlays_before (b, unchain_overlay (b->overlays_before, ov));
-  set_buffer_overlays_after (b, unchain_overlay (b->overlays_after, ov));
-  eassert (XOVERLAY (overlay)->next == NULL);
-}
-
 DEFUN ("move-overlay", Fmove_overlay, Smove_overlay, 3, 4, 0,
        doc: /* Set the endpoints of OVERLAY to BEG and END in BUFFER.
 If BUFFER is omitted, leave OVERLAY in the same buffer it inhabits now.
@@ -4018,7 +3693,7 @@ DEFUN ("move-overlay", Fmove_overlay, Smove_overlay, 3, 4, 0,
 
   CHECK_OVERLAY (overlay);
   if (NILP (buffer))
-    buffer = Fmarker_buffer (OVERLAY_START (overlay));
+    buffer = Foverlay_buffer (overlay);
   if (NILP (buffer))
     XSETBUFFER (buffer, current_buffer);
   CHECK_BUFFER (buffer);
@@ -4042,35 +3717,31 @@ DEFUN ("move-overlay", Fmove_overlay, Smove_overlay, 3, 4, 0,
 
   specbind (Qinhibit_quit, Qt);
 
-  obuffer = Fmarker_buffer (OVERLAY_START (overlay));
+  obuffer = Foverlay_buffer (overlay);
   b = XBUFFER (buffer);
 
   if (!NILP (obuffer))
     {
       ob = XBUFFER (obuffer);
 
-      o_beg = OVERLAY_POSITION (OVERLAY_START (overlay));
-      o_end = OVERLAY_POSITION (OVERLAY_END (overlay));
-
-      unchain_both (ob, overlay);
+      o_beg = OVERLAY_START (overlay);
+      o_end = OVERLAY_END (overlay);
     }
-  else
-    /* An overlay not associated with any buffer will normally have its
-       `next' field set to NULL, but not always: when killing a buffer,
-       we just set its overlays_after and overlays_before to NULL without
-       manually setting each overlay's `next' field to NULL.
-       Let's correct it here, to simplify subsequent assertions.
-       FIXME: Maybe the better fix is to change `kill-buffer'!?  */
-    XOVERLAY (overlay)->next = NULL;
 
-  eassert (XOVERLAY (overlay)->next == NULL);
+  /* Set the overlay boundaries, clipping them to the buffer like
+     markers would.  */
+  n_beg = clip_to_bounds (BUF_BEG (b), XFIXNUM (beg), BUF_Z (b));
+  n_end = clip_to_bounds (n_beg, XFIXNUM (end), BUF_Z (b));
 
-  /* Set the overlay boundaries, which may clip them.  */
-  Fset_marker (OVERLAY_START (overlay), beg, buffer);
-  Fset_marker (OVERLAY_END (overlay), end, buffer);
-
-  n_beg = marker_position (OVERLAY_START (overlay));
-  n_end = marker_position (OVERLAY_END (overlay));
+  if (! EQ (buffer, obuffer))
+    {
+      if (! NILP (obuffer))
+	remove_buffer_overlay (ob, XOVERLAY (overlay));
+      add_buffer_overlay (b, XOVERLAY (overlay), n_beg, n_end);
+    }
+  else
+    itree_node_set_region (b->overlays, XOVERLAY (overlay)->interval,
+			   n_beg, n_end);
 
   /* If the overlay has changed buffers, do a thorough redisplay.  */
   if (!EQ (buffer, obuffer))
@@ -4093,36 +3764,10 @@ DEFUN ("move-overlay", Fmove_overlay, Smove_overlay, 3, 4, 0,
 	modify_overlay (b, min (o_beg, n_beg), max (o_end, n_end));
     }
 
-  eassert (XOVERLAY (overlay)->next == NULL);
-
   /* Delete the overlay if it is empty after clipping and has the
      evaporate property.  */
   if (n_beg == n_end && !NILP (Foverlay_get (overlay, Qevaporate)))
-    { /* We used to call `Fdelete_overlay' here, but it causes problems:
-         - At this stage, `overlay' is not included in its buffer's lists
-           of overlays (the data-structure is in an inconsistent state),
-           contrary to `Fdelete_overlay's assumptions.
-         - Most of the work done by Fdelete_overlay has already been done
-           here for other reasons.  */
-      drop_overlay (XBUFFER (buffer), XOVERLAY (overlay));
-      return unbind_to (count, overlay);
-    }
-
-  /* Put the overlay into the new buffer's overlay lists, first on the
-     wrong list.  */
-  if (n_end < b->overlay_center)
-    {
-      XOVERLAY (overlay)->next = b->overlays_after;
-      set_buffer_overlays_after (b, XOVERLAY (overlay));
-    }
-  else
-    {
-      XOVERLAY (overlay)->next = b->overlays_before;
-      set_buffer_overlays_before (b, XOVERLAY (overlay));
-    }
-
-  /* This puts it in the right list, and in the right order.  */
-  recenter_overlay_lists (b, b->overlay_center);
+    drop_overlay (XOVERLAY (overlay));
 
   return unbind_to (count, overlay);
 }
@@ -4131,21 +3776,18 @@ DEFUN ("delete-overlay", Fdelete_overlay, Sdelete_overlay, 1, 1, 0,
        doc: /* Delete the overlay OVERLAY from its buffer.  */)
   (Lisp_Object overlay)
 {
-  Lisp_Object buffer;
   struct buffer *b;
   ptrdiff_t count = SPECPDL_INDEX ();
 
   CHECK_OVERLAY (overlay);
 
-  buffer = Fmarker_buffer (OVERLAY_START (overlay));
-  if (NILP (buffer))
+  b = OVERLAY_BUFFER (overlay);
+  if (! b)
     return Qnil;
 
-  b = XBUFFER (buffer);
   specbind (Qinhibit_quit, Qt);
 
-  unchain_both (b, overlay);
-  drop_overlay (b, XOVERLAY (overlay));
+  drop_overlay (XOVERLAY (overlay));
 
   /* When deleting an overlay with before or after strings, turn off
      display optimizations for the affected buffer, on the basis that
@@ -4176,8 +3818,10 @@ DEFUN ("overlay-start", Foverlay_start, Soverlay_start, 1, 1, 0,
   (Lisp_Object overlay)
 {
   CHECK_OVERLAY (overlay);
+  if (! OVERLAY_BUFFER (overlay))
+    return Qnil;
 
-  return (Fmarker_position (OVERLAY_START (overlay)));
+  return make_fixnum (OVERLAY_START (overlay));
 }
 
 DEFUN ("overlay-end", Foverlay_end, Soverlay_end, 1, 1, 0,
@@ -4185,8 +3829,10 @@ DEFUN ("overlay-end", Foverlay_end, Soverlay_end, 1, 1, 0,
   (Lisp_Object overlay)
 {
   CHECK_OVERLAY (overlay);
+  if (! OVERLAY_BUFFER (overlay))
+    return Qnil;
 
-  return (Fmarker_position (OVERLAY_END (overlay)));
+  return make_fixnum (OVERLAY_END (overlay));
 }
 
 DEFUN ("overlay-buffer", Foverlay_buffer, Soverlay_buffer, 1, 1, 0,
@@ -4194,9 +3840,16 @@ DEFUN ("overlay-buffer", Foverlay_buffer, Soverlay_buffer, 1, 1, 0,
 Return nil if OVERLAY has been deleted.  */)
   (Lisp_Object overlay)
 {
+  Lisp_Object buffer;
+
   CHECK_OVERLAY (overlay);
 
-  return Fmarker_buffer (OVERLAY_START (overlay));
+  if (! OVERLAY_BUFFER (overlay))
+    return Qnil;
+
+  XSETBUFFER (buffer, OVERLAY_BUFFER (overlay));
+
+  return buffer;
 }
 
 DEFUN ("overlay-properties", Foverlay_properties, Soverlay_properties, 1, 1, 0,
@@ -4231,8 +3884,7 @@ DEFUN ("overlays-at", Foverlays_at, Soverlays_at, 1, 2, 0,
 
   /* Put all the overlays we want in a vector in overlay_vec.
      Store the length in len.  */
-  noverlays = overlays_at (XFIXNUM (pos), 1, &overlay_vec, &len,
-			   NULL, NULL, 0);
+  noverlays = overlays_at (XFIXNUM (pos), 1, &overlay_vec, &len, NULL);
 
   if (!NILP (sorted))
     noverlays = sort_overlays (overlay_vec, noverlays,
@@ -4275,8 +3927,7 @@ DEFUN ("overlays-in", Foverlays_in, Soverlays_in, 2, 2, 0,
 
   /* Put all the overlays we want in a vector in overlay_vec.
      Store the length in len.  */
-  noverlays = overlays_in (XFIXNUM (beg), XFIXNUM (end), 1, &overlay_vec, &len,
-			   NULL, NULL);
+  noverlays = overlays_in (XFIXNUM (beg), XFIXNUM (end), 1, &overlay_vec, &len);
 
   /* Make a list of them all.  */
   result = Flist (noverlays, overlay_vec);
@@ -4292,39 +3943,12 @@ DEFUN ("next-overlay-change", Fnext_overlay_change, Snext_overlay_change,
 the value is (point-max).  */)
   (Lisp_Object pos)
 {
-  ptrdiff_t i, len, noverlays;
-  ptrdiff_t endpos;
-  Lisp_Object *overlay_vec;
-
   CHECK_FIXNUM_COERCE_MARKER (pos);
 
   if (!buffer_has_overlays ())
     return make_fixnum (ZV);
 
-  len = 10;
-  overlay_vec = xmalloc (len * sizeof *overlay_vec);
-
-  /* Put all the overlays we want in a vector in overlay_vec.
-     Store the length in len.
-     endpos gets the position where the next overlay starts.  */
-  noverlays = overlays_at (XFIXNUM (pos), 1, &overlay_vec, &len,
-			   &endpos, 0, 1);
-
-  /* If any of these overlays ends before endpos,
-     use its ending point instead.  */
-  for (i = 0; i < noverlays; i++)
-    {
-      Lisp_Object oend;
-      ptrdiff_t oendpos;
-
-      oend = OVERLAY_END (overlay_vec[i]);
-      oendpos = OVERLAY_POSITION (oend);
-      if (oendpos < endpos)
-	endpos = oendpos;
-    }
-
-  xfree (overlay_vec);
-  return make_fixnum (endpos);
+  return make_fixnum (next_overlay_change (XFIXNUM (pos)));
 }
 
 DEFUN ("previous-overlay-change", Fprevious_overlay_change,
@@ -4334,70 +3958,46 @@ DEFUN ("previous-overlay-change", Fprevious_overlay_change,
 the value is (point-min).  */)
   (Lisp_Object pos)
 {
-  ptrdiff_t prevpos;
-  Lisp_Object *overlay_vec;
-  ptrdiff_t len;
-
   CHECK_FIXNUM_COERCE_MARKER (pos);
 
   if (!buffer_has_overlays ())
     return make_fixnum (BEGV);
 
-  /* At beginning of buffer, we know the answer;
-     avoid bug subtracting 1 below.  */
-  if (XFIXNUM (pos) == BEGV)
-    return pos;
-
-  len = 10;
-  overlay_vec = xmalloc (len * sizeof *overlay_vec);
-
-  /* Put all the overlays we want in a vector in overlay_vec.
-     Store the length in len.
-     prevpos gets the position of the previous change.  */
-  overlays_at (XFIXNUM (pos), 1, &overlay_vec, &len,
-	       0, &prevpos, 1);
-
-  xfree (overlay_vec);
-  return make_fixnum (prevpos);
+  return make_fixnum (previous_overlay_change (XFIXNUM (pos)));
 }
-
+
 /* These functions are for debugging overlays.  */
 
 DEFUN ("overlay-lists", Foverlay_lists, Soverlay_lists, 0, 0, 0,
-       doc: /* Return a pair of lists giving all the overlays of the current buffer.
-The car has all the overlays before the overlay center;
-the cdr has all the overlays after the overlay center.
-Recentering overlays moves overlays between these lists.
-The lists you get are copies, so that changing them has no effect.
-However, the overlays you get are the real objects that the buffer uses.  */)
+       doc: /* Return a list giving all the overlays of the current buffer.
+
+For backward compatibility, the value is actually a list that
+holds another list; the overlays are in the inner list.
+The list you get is a copy, so that changing it has no effect.
+However, the overlays you get are the real objects that the buffer uses. */)
   (void)
 {
-  Lisp_Object before = Qnil, after = Qnil;
+  Lisp_Object overlays = Qnil;
+  struct itree_node *node;
 
-  for (struct Lisp_Overlay *ol = current_buffer->overlays_before;
-       ol; ol = ol->next)
-    before = Fcons (make_lisp_ptr (ol, Lisp_Vectorlike), before);
-  for (struct Lisp_Overlay *ol = current_buffer->overlays_after;
-       ol; ol = ol->next)
-    after = Fcons (make_lisp_ptr (ol, Lisp_Vectorlike), after);
+  ITREE_FOREACH (node, current_buffer->overlays, BEG, Z, DESCENDING)
+    overlays = Fcons (node->data, overlays);
 
-  return Fcons (Fnreverse (before), Fnreverse (after));
+  return NILP (overlays) ? Fcons (Qnil, Qnil) : Fcons (overlays, Qnil);
 }
 
 DEFUN ("overlay-recenter", Foverlay_recenter, Soverlay_recenter, 1, 1, 0,
        doc: /* Recenter the overlays of the current buffer around position POS.
-That makes overlay lookup faster for positions near POS (but perhaps slower
-for positions far away from POS).  */)
+That used to make overlay lookup faster for positions near POS, but
+overlays are now kept in a balanced tree, so this function does
+nothing.  */)
   (Lisp_Object pos)
 {
-  ptrdiff_t p;
   CHECK_FIXNUM_COERCE_MARKER (pos);
-
-  p = clip_to_bounds (PTRDIFF_MIN, XFIXNUM (pos), PTRDIFF_MAX);
-  recenter_overlay_lists (current_buffer, p);
+  /* Overlays are now stored in a tree; there is nothing to recenter.  */
   return Qnil;
 }
-
+
 DEFUN ("overlay-get", Foverlay_get, Soverlay_get, 2, 2, 0,
        doc: /* Get the property of overlay OVERLAY with property name PROP.  */)
   (Lisp_Object overlay, Lisp_Object prop)
@@ -4416,7 +4016,7 @@ DEFUN ("overlay-put", Foverlay_put, Soverlay_put, 3, 3, 0,
 
   CHECK_OVERLAY (overlay);
 
-  buffer = Fmarker_buffer (OVERLAY_START (overlay));
+  buffer = Foverlay_buffer (overlay);
 
   for (tail = XOVERLAY (overlay)->plist;
        CONSP (tail) && CONSP (XCDR (tail));
@@ -4436,11 +4036,10 @@ DEFUN ("overlay-put", Foverlay_put, Soverlay_put, 3, 3, 0,
     {
       if (changed)
 	modify_overlay (XBUFFER (buffer),
-			marker_position (OVERLAY_START (overlay)),
-			marker_position (OVERLAY_END   (overlay)));
+			OVERLAY_START (overlay),
+			OVERLAY_END   (overlay));
       if (EQ (prop, Qevaporate) && ! NILP (value)
-	  && (OVERLAY_POSITION (OVERLAY_START (overlay))
-	      == OVERLAY_POSITION (OVERLAY_END (overlay))))
+	  && (OVERLAY_START (overlay) == OVERLAY_END (overlay)))
 	Fdelete_overlay (overlay);
     }
 
@@ -4514,67 +4113,23 @@ report_overlay_modification (Lisp_Object start, Lisp_Object end, bool after,
       /* We are being called before a change.
 	 Scan the overlays to find the functions to call.  */
       last_overlay_modification_hooks_used = 0;
-      for (struct Lisp_Overlay *tail = current_buffer->overlays_before;
-	   tail; tail = tail->next)
+      ptrdiff_t begin_arg = XFIXNAT (start);
+      ptrdiff_t end_arg = XFIXNAT (end);
+      struct itree_node *node;
+      ITREE_FOREACH (node, current_buffer->overlays, begin_arg, end_arg,
+		     ASCENDING)
 	{
-	  ptrdiff_t startpos, endpos;
-	  Lisp_Object ostart, oend;
-
-	  Lisp_Object overlay = make_lisp_ptr (tail, Lisp_Vectorlike);
-
-	  ostart = OVERLAY_START (overlay);
-	  oend = OVERLAY_END (overlay);
-	  endpos = OVERLAY_POSITION (oend);
-	  if (XFIXNAT (start) > endpos)
-	    break;
-	  startpos = OVERLAY_POSITION (ostart);
-	  if (insertion && (XFIXNAT (start) == startpos
-			    || XFIXNAT (end) == startpos))
-	    {
-	      Lisp_Object prop = Foverlay_get (overlay, Qinsert_in_front_hooks);
-	      if (!NILP (prop))
-		add_overlay_mod_hooklist (prop, overlay);
-	    }
-	  if (insertion && (XFIXNAT (start) == endpos
-			    || XFIXNAT (end) == endpos))
-	    {
-	      Lisp_Object prop = Foverlay_get (overlay, Qinsert_behind_hooks);
-	      if (!NILP (prop))
-		add_overlay_mod_hooklist (prop, overlay);
-	    }
-	  /* Test for intersecting intervals.  This does the right thing
-	     for both insertion and deletion.  */
-	  if (XFIXNAT (end) > startpos && XFIXNAT (start) < endpos)
-	    {
-	      Lisp_Object prop = Foverlay_get (overlay, Qmodification_hooks);
-	      if (!NILP (prop))
-		add_overlay_mod_hooklist (prop, overlay);
-	    }
-	}
+	  Lisp_Object overlay = node->data;
+	  ptrdiff_t startpos = node->begin;
+	  ptrdiff_t endpos = node->end;
 
-      for (struct Lisp_Overlay *tail = current_buffer->overlays_after;
-	   tail; tail = tail->next)
-	{
-	  ptrdiff_t startpos, endpos;
-	  Lisp_Object ostart, oend;
-
-	  Lisp_Object overlay = make_lisp_ptr (tail, Lisp_Vectorlike);
-
-	  ostart = OVERLAY_START (overlay);
-	  oend = OVERLAY_END (overlay);
-	  startpos = OVERLAY_POSITION (ostart);
-	  endpos = OVERLAY_POSITION (oend);
-	  if (XFIXNAT (end) < startpos)
-	    break;
-	  if (insertion && (XFIXNAT (start) == startpos
-			    || XFIXNAT (end) == startpos))
+	  if (insertion && (begin_arg == startpos || end_arg == startpos))
 	    {
 	      Lisp_Object prop = Foverlay_get (overlay, Qinsert_in_front_hooks);
 	      if (!NILP (prop))
 		add_overlay_mod_hooklist (prop, overlay);
 	    }
-	  if (insertion && (XFIXNAT (start) == endpos
-			    || XFIXNAT (end) == endpos))
+	  if (insertion && (begin_arg == endpos || end_arg == endpos))
 	    {
 	      Lisp_Object prop = Foverlay_get (overlay, Qinsert_behind_hooks);
 	      if (!NILP (prop))
@@ -4582,7 +4137,7 @@ report_overlay_modification (Lisp_Object start, Lisp_Object end, bool after,
 	    }
 	  /* Test for intersecting intervals.  This does the right thing
 	     for both insertion and deletion.  */
-	  if (XFIXNAT (end) > startpos && XFIXNAT (start) < endpos)
+	  if (end_arg > startpos && begin_arg < endpos)
 	    {
 	      Lisp_Object prop = Foverlay_get (overlay, Qmodification_hooks);
 	      if (!NILP (prop))
@@ -4613,7 +4168,7 @@ report_overlay_modification (Lisp_Object start, Lisp_Object end, bool after,
 	   (which makes its markers' buffers be nil), or that (due to
 	   some bug) it belongs to a different buffer.  Only run this
 	   hook if the overlay belongs to the current buffer.  */
-	if (XMARKER (OVERLAY_START (overlay_i))->buffer == current_buffer)
+	if (OVERLAY_BUFFER (overlay_i) == current_buffer)
 	  call_overlay_mod_hooks (prop_i, overlay_i, after, arg1, arg2, arg3);
       }
 
@@ -4641,30 +4196,12 @@ call_overlay_mod_hooks (Lisp_Object list, Lisp_Object overlay, bool after,
 evaporate_overlays (ptrdiff_t pos)
 {
   Lisp_Object hit_list = Qnil;
-  if (pos <= current_buffer->overlay_center)
-    for (struct Lisp_Overlay *tail = current_buffer->overlays_before;
-	 tail; tail = tail->next)
-      {
-	Lisp_Object overlay = make_lisp_ptr (tail, Lisp_Vectorlike);
-	ptrdiff_t endpos = OVERLAY_POSITION (OVERLAY_END (overlay));
-	if (endpos < pos)
-	  break;
-	if (endpos == pos && OVERLAY_POSITION (OVERLAY_START (overlay)) == pos
-	    && ! NILP (Foverlay_get (overlay, Qevaporate)))
-	  hit_list = Fcons (overlay, hit_list);
-      }
-  else
-    for (struct Lisp_Overlay *tail = current_buffer->overlays_after;
-	 tail; tail = tail->next)
-      {
-	Lisp_Object overlay = make_lisp_ptr (tail, Lisp_Vectorlike);
-	ptrdiff_t startpos = OVERLAY_POSITION (OVERLAY_START (overlay));
-	if (startpos > pos)
-	  break;
-	if (startpos == pos && OVERLAY_POSITION (OVERLAY_END (overlay)) == pos
-	    && ! NILP (Foverlay_get (overlay, Qevaporate)))
-	  hit_list = Fcons (overlay, hit_list);
-      }
+  struct itree_node *node;
+
+  ITREE_FOREACH (node, current_buffer->overlays, pos, pos, ASCENDING)
+    if (node->begin == pos && node->end == pos
+	&& ! NILP (Foverlay_get (node->data, Qevaporate)))
+      hit_list = Fcons (node->data, hit_list);
   for (; CONSP (hit_list); hit_list = XCDR (hit_list))
     Fdelete_overlay (XCAR (hit_list));
 }
@@ -5068,10 +4605,13 @@ enlarge_buffer_text (struct buffer *b, ptrdiff_t delta)
   void *p;
   unsigned char *old_beg = b->text->beg;
   ptrdiff_t old_nbytes =
-    BUF_Z_BYTE (b) - BUF_BEG_BYTE (b) + BUF_GAP_SIZE (b) + 1;
+    BUF_Z_BYTE (b) - BUF_BEG_BYTE (b) + BUF_GAP_SIZE (b) + 1
+    + BUF_TAIL_SIZE (b);
   ptrdiff_t new_nbytes = old_nbytes + delta;
 
-  if (pdumper_object_p (old_beg))
+  /* Text from the dump or from a mapped file must be copied into
+     newly allocated memory.  */
+  if (pdumper_object_p (old_beg) || b->text->mapped)
     b->text->beg = NULL;
   else
     old_beg = NULL;
@@ -5096,18 +4636,373 @@ enlarge_buffer_text (struct buffer *b, ptrdiff_t delta)
   if (old_beg)
     memcpy (p, old_beg, min (old_nbytes, new_nbytes));
 
+#if MAP_BUFFER_TEXT
+  if (b->text->mapped)
+    unmap_mapped_text (b, old_beg);
+#endif
+
   BUF_BEG_ADDR (b) = p;
   unblock_input ();
 }
 
+#if MAP_BUFFER_TEXT
 
-/* Free buffer B's text buffer.  */
+/* The texts of buffers mapped from files.  handle_mapped_text_fault
+   looks up the faulting address here, so the table has a fixed size
+   and an entry is in use while its BEG is non-null.  BEG is set last
+   when an entry is filled, and cleared first when it is freed.  */
+
+struct mapped_text
+{
+  /* The memory of the text, and its size, including the gap and the
+     room after the text.  */
+  unsigned char *volatile beg;
+  ptrdiff_t size;
+
+  /* The file mapped, and its size and modification time when it was
+     mapped; check_mapped_files compares them with those it has now.  */
+  int fd;
+  off_t file_size;
+  struct timespec mtime;
+
+  /* The buffer whose text this is.  */
+  struct buffer *buffer;
+
+  /* Whether reading the text faulted because the file got shorter,
+     and whether check_mapped_buffer_text reported it.  */
+  volatile bool truncated;
+  bool reported;
+};
+
+enum { MAPPED_TEXTS_MAX = 64 };
+static struct mapped_text mapped_texts[MAPPED_TEXTS_MAX];
+
+/* Whether handle_mapped_text_fault handles SIGBUS, and how it was
+   handled before.  */
+static bool mapped_text_fault_handler_installed;
+static struct sigaction old_sigbus_action;
+static int mapped_text_page_size;
+
+/* Pipes to send the address of a page to mapped_text_fault_thread,
+   and to get back whether it was replaced.  */
+static int mapped_text_fault_request[2];
+static int mapped_text_fault_reply[2];
+
+#endif	/* MAP_BUFFER_TEXT */
+
+/* True if the text of some buffer faulted because its mapped file got
+   shorter, and maybe_quit should call check_mapped_buffer_text.  */
+bool volatile mapped_text_fault_pending;
+
+#if MAP_BUFFER_TEXT
+
+/* Return the entry of mapped_texts for the text at BEG, or NULL.  */
+
+static struct mapped_text *
+find_mapped_text (unsigned char *beg)
+{
+  for (int i = 0; i < MAPPED_TEXTS_MAX; i++)
+    if (mapped_texts[i].beg == beg)
+      return &mapped_texts[i];
+  return NULL;
+}
+
+/* Unmap the text of buffer B, which is mapped at BEG.  */
 
 static void
-free_buffer_text (struct buffer *b)
+unmap_mapped_text (struct buffer *b, unsigned char *beg)
+{
+  struct mapped_text *m = find_mapped_text (beg);
+  eassume (m);
+  m->beg = NULL;
+  munmap (beg, m->size);
+  emacs_close (m->fd);
+  b->text->mapped = false;
+}
+
+/* Replace the pages sent by handle_mapped_text_fault with pages of
+   zeros, outside of the signal handler.  */
+
+static void *
+mapped_text_fault_thread (void *arg)
+{
+  unsigned char *page;
+
+  while (read (mapped_text_fault_request[0], &page, sizeof page)
+	 == sizeof page)
+    {
+      char ok = (mmap (page, mapped_text_page_size,
+		       PROT_READ | PROT_WRITE,
+		       MAP_PRIVATE | MAP_ANON | MAP_FIXED, -1, 0)
+		 != MAP_FAILED);
+      while (write (mapped_text_fault_reply[1], &ok, 1) < 0
+	     && errno == EINTR)
+	continue;
+    }
+  return NULL;
+}
+
+/* Handle SIGBUS.  Reading a page of a mapped file beyond its end
+   raises it, which happens when the file visited in a buffer whose
+   text is mapped is truncated by another program.  Have
+   mapped_text_fault_thread replace the page by a page of zeros, wait
+   for it, and return to read the page again; then maybe_quit signals
+   an error.  This uses only async-signal-safe functions.  Treat any
+   other SIGBUS as before.  */
+
+static void
+handle_mapped_text_fault (int sig, siginfo_t *siginfo, void *arg)
+{
+  unsigned char *addr = siginfo->si_addr;
+
+  for (int i = 0; i < MAPPED_TEXTS_MAX; i++)
+    {
+      struct mapped_text *m = &mapped_texts[i];
+      unsigned char *beg = m->beg;
+      if (beg && beg <= addr && addr < beg + m->size)
+	{
+	  int err = errno;
+	  unsigned char *page = addr - (addr - beg) % mapped_text_page_size;
+	  char ok = false;
+	  ptrdiff_t n;
+
+	  m->truncated = true;
+	  mapped_text_fault_pending = true;
+	  while ((n = write (mapped_text_fault_request[1], &page,
+			     sizeof page)) < 0
+		 && errno == EINTR)
+	    continue;
+	  if (n == sizeof page)
+	    while (read (mapped_text_fault_reply[0], &ok, 1) < 0
+		   && errno == EINTR)
+	      continue;
+	  errno = err;
+	  if (ok)
+	    return;
+	  break;
+	}
+    }
+
+  if (old_sigbus_action.sa_flags & SA_SIGINFO)
+    old_sigbus_action.sa_sigaction (sig, siginfo, arg);
+  else if (old_sigbus_action.sa_handler == SIG_DFL
+	   || old_sigbus_action.sa_handler == SIG_IGN)
+    /* Returning executes the faulting instruction again, which then
+       has the default effect.  */
+    sigaction (SIGBUS, &old_sigbus_action, NULL);
+  else
+    old_sigbus_action.sa_handler (sig);
+}
+
+/* Install handle_mapped_text_fault and start mapped_text_fault_thread,
+   if not done yet.  Return false if that is not possible.  */
+
+static bool
+install_mapped_text_fault_handler (void)
+{
+  static bool tried;
+
+  if (!tried)
+    {
+      pthread_t thread;
+      sigset_t blocked, oldset;
+      struct sigaction action;
+
+      tried = true;
+      mapped_text_page_size = getpagesize ();
+      if (emacs_pipe (mapped_text_fault_request) != 0)
+	return false;
+      if (emacs_pipe (mapped_text_fault_reply) != 0)
+	{
+	  emacs_close (mapped_text_fault_request[0]);
+	  emacs_close (mapped_text_fault_request[1]);
+	  return false;
+	}
+
+      /* Let the thread inherit a mask blocking all signals, so that
+	 they are all handled by the other threads.  */
+      sigfillset (&blocked);
+      pthread_sigmask (SIG_SETMASK, &blocked, &oldset);
+      bool started = pthread_create (&thread, NULL,
+				     mapped_text_fault_thread, NULL) == 0;
+      pthread_sigmask (SIG_SETMASK, &oldset, NULL);
+
+      if (started)
+	{
+	  pthread_detach (thread);
+	  sigfillset (&action.sa_mask);
+	  action.sa_sigaction = handle_mapped_text_fault;
+	  action.sa_flags = SA_SIGINFO;
+	  mapped_text_fault_handler_installed
+	    = sigaction (SIGBUS, &action, &old_sigbus_action) == 0;
+	}
+      /* Without the handler, the thread just waits forever.  */
+    }
+
+  return mapped_text_fault_handler_installed;
+}
+
+#endif	/* MAP_BUFFER_TEXT */
+
+/* Signal an error if the file of a buffer with mapped text was found
+   to be truncated since the last call.  This is called by maybe_quit
+   when mapped_text_fault_pending is set, and postponed like a quit
+   while `inhibit-quit' is non-nil.  */
+
+void
+check_mapped_buffer_text (void)
 {
+#if MAP_BUFFER_TEXT
+  if (!NILP (Vinhibit_quit))
+    return;
+  mapped_text_fault_pending = false;
+  for (int i = 0; i < MAPPED_TEXTS_MAX; i++)
+    {
+      struct mapped_text *m = &mapped_texts[i];
+      if (m->beg && m->truncated && !m->reported)
+	{
+	  /* Report the other buffers next time.  */
+	  mapped_text_fault_pending = true;
+	  m->reported = true;
+	  error ("File of buffer %s was truncated while visited;"
+		 " its text is incomplete",
+		 SDATA (BVAR (m->buffer, name)));
+	}
+    }
+#else
+  mapped_text_fault_pending = false;
+#endif
+}
+
+/* Copy the text of buffers whose mapped files were changed by another
+   program into ordinary memory, so that it does not change any more,
+   and forget what was computed from their text.  Signal an error
+   unless the change was reported already.  Compare the size and
+   modification time of the files with those they had when mapped.
+   This is called by the command loop before each command.  */
+
+void
+check_mapped_files (void)
+{
+#if MAP_BUFFER_TEXT
+  for (int i = 0; i < MAPPED_TEXTS_MAX; i++)
+    {
+      struct mapped_text *m = &mapped_texts[i];
+      struct stat st;
+
+      if (!m->beg
+	  || (!m->truncated
+	      && fstat (m->fd, &st) == 0
+	      && st.st_size == m->file_size
+	      && timespec_cmp (get_stat_mtime (&st), m->mtime) == 0))
+	continue;
+
+      struct buffer *b = m->buffer;
+      bool reported = m->reported;
+      unmap_buffer_text (b);
+      invalidate_buffer_caches (b, BUF_BEG (b), BUF_Z (b));
+      modiff_incr (&BUF_MODIFF (b));
+      BUF_CHARS_MODIFF (b) = BUF_MODIFF (b);
+      bset_redisplay (b);
+      if (!reported)
+	error ("File of buffer %s was changed by another program"
+	       " while visited",
+	       SDATA (BVAR (b, name)));
+    }
+#endif
+}
+
+/* Make the text of buffer B, which must be empty, a private mapping
+   of the first NBYTES bytes of the file open on FD.  These bytes make
+   up the gap, as if they had just been read there, and are followed
+   by some room for editing.  The pages of the file are then read
+   only when the text is looked at, and copied only when it is
+   modified.  Return false if the file cannot be mapped.
+
+   Another program can change the pages of the file while they are
+   mapped, so only the text of unibyte buffers, in which any bytes
+   are valid, should stay mapped; see unmap_buffer_text.  */
+
+bool
+map_buffer_text (struct buffer *b, int fd, ptrdiff_t nbytes)
+{
+#if MAP_BUFFER_TEXT
+  ptrdiff_t tail = GAP_BYTES_DFL + nbytes / 64;
+  ptrdiff_t size;
+  unsigned char *p;
+  struct mapped_text *m;
+  struct stat st;
+
+  eassert (BUF_Z (b) == BEG);
+  if (INT_ADD_WRAPV (nbytes, tail + 1, &size) || BUF_BYTES_MAX < size
+      || !(m = find_mapped_text (NULL))
+      || fstat (fd, &st) != 0
+      || !install_mapped_text_fault_handler ())
+    return false;
+
   block_input ();
 
+  /* Reserve room for the whole text, then map the file over the
+     start of it.  The rest of the last page of the file, and the
+     room after it, read as zeros.  */
+  p = mmap (NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON,
+	    -1, 0);
+  if (p == MAP_FAILED)
+    {
+      unblock_input ();
+      return false;
+    }
+  if (mmap (p, nbytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED,
+	    fd, 0)
+      == MAP_FAILED
+      || (m->fd = fcntl (fd, F_DUPFD_CLOEXEC, 0)) < 0)
+    {
+      munmap (p, size);
+      unblock_input ();
+      return false;
+    }
+
+  free_buffer_text_1 (b);
+  m->size = size;
+  m->file_size = st.st_size;
+  m->mtime = get_stat_mtime (&st);
+  m->buffer = b->base_buffer ? b->base_buffer : b;
+  m->truncated = m->reported = false;
+  m->beg = p;
+  BUF_BEG_ADDR (b) = p;
+  BUF_GAP_SIZE (b) = nbytes;
+  BUF_TAIL_SIZE (b) = tail;
+  b->text->mapped = true;
+  unblock_input ();
+  return true;
+#else
+  return false;
+#endif
+}
+
+/* If the text of buffer B is mapped from a file, copy it into
+   ordinary memory.  This must be done before the text is decoded or
+   made multibyte, since another program changing the file could
+   otherwise make it invalid.  */
+
+void
+unmap_buffer_text (struct buffer *b)
+{
+  if (b->text->mapped)
+    enlarge_buffer_text (b, 0);
+}
+
+
+/* Free the memory of buffer B's text buffer.  */
+
+static void
+free_buffer_text_1 (struct buffer *b)
+{
+#if MAP_BUFFER_TEXT
+  if (b->text->mapped)
+    unmap_mapped_text (b, b->text->beg);
+  else
+#endif
   if (!pdumper_object_p (b->text->beg))
     {
 #if defined USE_MMAP_FOR_BUFFERS
@@ -5120,7 +5015,23 @@ free_buffer_text (struct buffer *b)
     }
 
   BUF_BEG_ADDR (b) = NULL;
+}
+
+/* Free buffer B's text buffer.  */
+
+static void
+free_buffer_text (struct buffer *b)
+{
+  block_input ();
+  free_buffer_text_1 (b);
   unblock_input ();
+
+  if (b->text->line_index)
+    {
+      free_line_index (b->text->line_index);
+      b->text->line_index = NULL;
+    }
+  clear_char_index (b);
 }
 
 
@@ -5290,9 +5201,7 @@ init_buffer_once (void)
   bset_mark_active (&buffer_defaults, Qnil);
   bset_file_format (&buffer_defaults, Qnil);
   bset_auto_save_file_format (&buffer_defaults, Qt);
-  set_buffer_overlays_before (&buffer_defaults, NULL);
-  set_buffer_overlays_after (&buffer_defaults, NULL);
-  buffer_defaults.overlay_center = BEG;
+  buffer_defaults.overlays = NULL;
 
   XSETFASTINT (BVAR (&buffer_defaults, tab_width), 8);
   bset_truncate_lines (&buffer_defaults, Qnil);
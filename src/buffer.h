@@ -26,6 +26,7 @@ #define EMACS_BUFFER_H
 
 #include "character.h"
 #include "lisp.h"
+#include "itree.h"
 
 INLINE_HEADER_BEGIN
 
@@ -84,6 +85,9 @@ #define Z_ADDR (current_buffer->text->beg + current_buffer->text->gap_size + cur
 /* Size of gap.  */
 #define GAP_SIZE (current_buffer->text->gap_size)
 
+/* Size of room after end of buffer.  */
+#define TAIL_SIZE (current_buffer->text->tail_size)
+
 /* Modification count.  */
 #define MODIFF (current_buffer->text->modiff)
 
@@ -111,6 +115,9 @@ #define BUF_BEG_ADDR(buf) ((buf)->text->beg)
 /* Size of gap.  */
 #define BUF_GAP_SIZE(buf) ((buf)->text->gap_size)
 
+/* Size of room after end of buffer.  */
+#define BUF_TAIL_SIZE(buf) ((buf)->text->tail_size)
+
 /* Modification count.  */
 #define BUF_MODIFF(buf) ((buf)->text->modiff)
 
@@ -157,6 +164,11 @@ #define END_UNCHANGED BUF_END_UNCHANGED (current_buffer)
 				 ptrdiff_t, ptrdiff_t);
 extern void set_point_from_marker (Lisp_Object);
 extern void enlarge_buffer_text (struct buffer *, ptrdiff_t);
+extern bool map_buffer_text (struct buffer *, int, ptrdiff_t);
+extern void unmap_buffer_text (struct buffer *);
+extern bool volatile mapped_text_fault_pending;
+extern void check_mapped_buffer_text (void);
+extern void check_mapped_files (void);
 
 INLINE void
 SET_PT (ptrdiff_t position)
@@ -228,6 +240,12 @@ #define FETCH_BYTE(n) *(BYTE_POS_ADDR ((n)))
     ptrdiff_t gpt_byte;		/* Byte pos of gap in buffer.  */
     ptrdiff_t z_byte;		/* Byte pos of end of buffer.  */
     ptrdiff_t gap_size;		/* Size of buffer's gap.  */
+
+    /* Number of unused bytes allocated after the anchor at the end of
+       the text.  Text inserted at the end of the buffer can go there
+       when the gap is far away; see make_room_for_insertion.  */
+    ptrdiff_t tail_size;
+
     modiff_count modiff;	/* This counts buffer-modification events
 				   for this buffer.  It is incremented for
 				   each such event, and never otherwise
@@ -263,14 +281,28 @@ #define FETCH_BYTE(n) *(BYTE_POS_ADDR ((n)))
     INTERVAL intervals;
 
     /* The markers that refer to this buffer.
-       This is actually a single marker ---
-       successive elements in its marker `chain'
-       are the other markers referring to this buffer.
-       This is a singly linked unordered list, which means that it's
-       very cheap to add a marker to the list and it's also very cheap
-       to move a marker within a buffer.  */
+       This is the root of a binary search tree of markers ordered by
+       position, whose nodes are the markers themselves; see marker.c.
+       Pending offsets in the tree make it cheap to relocate all the
+       markers after a position when text is inserted or deleted.  */
     struct Lisp_Marker *markers;
 
+    /* The number of markers in the tree, and the largest number it had
+       since the whole tree was last rebalanced.  */
+    ptrdiff_t markers_count, markers_max_count;
+
+    /* Incremented every time offsets are introduced in the tree of
+       markers; see the 'otick' field of struct Lisp_Marker.  */
+    uintmax_t markers_otick;
+
+    /* The index of the newlines in this text, or NULL if there is
+       none yet.  See line-index.c.  */
+    struct line_index *line_index;
+
+    /* The index of the character positions in this text, or NULL if
+       there is none yet.  See marker.c.  */
+    struct char_index *char_index;
+
     /* Usually false.  Temporarily true in decode_coding_gap to
        prevent Fgarbage_collect from shrinking the gap and losing
        not-yet-decoded bytes.  */
@@ -278,6 +310,12 @@ #define FETCH_BYTE(n) *(BYTE_POS_ADDR ((n)))
 
     /* True if it needs to be redisplayed.  */
     bool_bf redisplay : 1;
+
+    /* True if BEG is a private mapping of a file made by
+       map_buffer_text.  It is then unmapped rather than freed, and
+       copied to ordinary memory when it has to grow or shrink, or
+       when it is to hold multibyte text.  */
+    bool_bf mapped : 1;
   };
 
 /* Most code should use this macro to access Lisp fields in struct buffer.  */
@@ -659,6 +697,12 @@ #define BVAR(buf, field) ((buf)->field ## _)
   struct region_cache *width_run_cache;
   struct region_cache *bidi_paragraph_cache;
 
+  /* Sets of checkpoints of the parse state computed by
+     `parse-partial-sexp' from the beginning of the accessible portion
+     of the buffer, most recently used first, or NULL if there are
+     none.  See syntax.c.  */
+  struct parse_state_cache *parse_state_cache;
+
   /* Non-zero means disable redisplay optimizations when rebuilding the glyph
      matrices (but not when redrawing).  */
   bool_bf prevent_redisplay_optimizations_p : 1;
@@ -673,16 +717,9 @@ #define BVAR(buf, field) ((buf)->field ## _)
      defined.  */
   bool_bf inhibit_buffer_hooks : 1;
 
-  /* List of overlays that end at or before the current center,
-     in order of end-position.  */
-  struct Lisp_Overlay *overlays_before;
-
-  /* List of overlays that end after  the current center,
-     in order of start-position.  */
-  struct Lisp_Overlay *overlays_after;
-
-  /* Position where the overlay lists are centered.  */
-  ptrdiff_t overlay_center;
+  /* The interval tree containing this buffer's overlays, or NULL if
+     the buffer never had any.  */
+  struct itree_tree *overlays;
 
   /* Changes in the buffer are recorded here for undo, and t means
      don't record anything.  This information belongs to the base
@@ -1145,9 +1182,10 @@ #define CHECK_FIXNUM_COERCE_MARKER(x) ((x) = make_fixnum (fix_position (x)))
 extern void compact_buffer (struct buffer *);
 extern void evaporate_overlays (ptrdiff_t);
 extern ptrdiff_t overlays_at (EMACS_INT, bool, Lisp_Object **,
-			      ptrdiff_t *, ptrdiff_t *, ptrdiff_t *, bool);
+			      ptrdiff_t *, ptrdiff_t *);
 extern ptrdiff_t sort_overlays (Lisp_Object *, ptrdiff_t, struct window *);
-extern void recenter_overlay_lists (struct buffer *, ptrdiff_t);
+extern ptrdiff_t next_overlay_change (ptrdiff_t);
+extern ptrdiff_t previous_overlay_change (ptrdiff_t);
 extern ptrdiff_t overlay_strings (ptrdiff_t, struct window *, unsigned char **);
 extern void validate_region (Lisp_Object *, Lisp_Object *);
 extern void set_buffer_internal_1 (struct buffer *);
@@ -1155,7 +1193,7 @@ #define CHECK_FIXNUM_COERCE_MARKER(x) ((x) = make_fixnum (fix_position (x)))
 extern void set_buffer_temp (struct buffer *);
 extern Lisp_Object buffer_local_value (Lisp_Object, Lisp_Object);
 extern void record_buffer (Lisp_Object);
-extern void fix_overlays_before (struct buffer *, ptrdiff_t, ptrdiff_t);
+extern void transpose_overlays (ptrdiff_t, ptrdiff_t, ptrdiff_t, ptrdiff_t);
 extern void mmap_set_vars (bool);
 extern void restore_buffer (Lisp_Object);
 extern void set_buffer_if_live (Lisp_Object);
@@ -1193,24 +1231,54 @@ record_unwind_current_buffer (void)
   record_unwind_protect (set_buffer_if_live, Fcurrent_buffer ());
 }
 
+/* Return the character position of marker M, which must point
+   somewhere.  */
+
+INLINE ptrdiff_t
+marker_charpos (struct Lisp_Marker *m)
+{
+  if (m->otick != m->buffer->text->markers_otick)
+    validate_marker (m);
+  return m->charpos;
+}
+
+/* Return the byte position of marker M, which must point
+   somewhere.  */
+
+INLINE ptrdiff_t
+marker_bytepos (struct Lisp_Marker *m)
+{
+  if (m->otick != m->buffer->text->markers_otick)
+    validate_marker (m);
+  return m->bytepos;
+}
+
+/* FOR_EACH_MARKER (BUF, M) followed by a statement is a `for' loop
+   which iterates over the markers of the text of BUF in order of
+   position.  M's positions can be used directly in the body, which
+   must not change the order of the markers or unchain any of them.  */
+
+#define FOR_EACH_MARKER(buf, m)					\
+  for ((m) = marker_tree_first (buf, BEG); (m);			\
+       (m) = marker_tree_next (buf, m))
+
 /* Get overlays at POSN into array OVERLAYS with NOVERLAYS elements.
    If NEXTP is non-NULL, return next overlay there.
-   See overlay_at arg CHANGE_REQ for meaning of CHRQ arg.
    This macro might evaluate its args multiple times,
    and it treat some args as lvalues.  */
 
-#define GET_OVERLAYS_AT(posn, overlays, noverlays, nextp, chrq)		\
+#define GET_OVERLAYS_AT(posn, overlays, noverlays, nextp)		\
   do {									\
     ptrdiff_t maxlen = 40;						\
     SAFE_NALLOCA (overlays, 1, maxlen);					\
     (noverlays) = overlays_at (posn, false, &(overlays), &maxlen,	\
-			       nextp, NULL, chrq);			\
+			       nextp);					\
     if ((noverlays) > maxlen)						\
       {									\
 	maxlen = noverlays;						\
 	SAFE_NALLOCA (overlays, 1, maxlen);				\
 	(noverlays) = overlays_at (posn, false, &(overlays), &maxlen,	\
-				   nextp, NULL, chrq);			\
+				   nextp);				\
       }									\
   } while (false)
 
@@ -1245,7 +1313,7 @@ set_buffer_intervals (struct buffer *b, INTERVAL i)
 INLINE bool
 buffer_has_overlays (void)
 {
-  return current_buffer->overlays_before || current_buffer->overlays_after;
+  return current_buffer->overlays && current_buffer->overlays->root != NULL;
 }
 
 /* Functions for accessing a character or byte,
@@ -1363,25 +1431,75 @@ buffer_window_count (struct buffer *b)
 
 /* Overlays */
 
-/* Return the marker that stands for where OV starts in the buffer.  */
+/* Return the start of OV in its buffer, or -1 if OV is not associated
+   with any buffer.  */
 
-#define OVERLAY_START(OV) XOVERLAY (OV)->start
+INLINE ptrdiff_t
+overlay_start (struct Lisp_Overlay *ov)
+{
+  if (! ov->buffer)
+    return -1;
+  return itree_node_begin (ov->buffer->overlays, ov->interval);
+}
 
-/* Return the marker that stands for where OV ends in the buffer.  */
+/* Return the end of OV in its buffer, or -1.  */
 
-#define OVERLAY_END(OV) XOVERLAY (OV)->end
+INLINE ptrdiff_t
+overlay_end (struct Lisp_Overlay *ov)
+{
+  if (! ov->buffer)
+    return -1;
+  return itree_node_end (ov->buffer->overlays, ov->interval);
+}
 
-/* Return the plist of overlay OV.  */
+/* Return the position where OV starts in its buffer, or -1 if OV has
+   been deleted.  */
 
-#define OVERLAY_PLIST(OV) XOVERLAY (OV)->plist
+INLINE ptrdiff_t
+OVERLAY_START (Lisp_Object ov)
+{
+  return overlay_start (XOVERLAY (ov));
+}
 
-/* Return the actual buffer position for the marker P.
-   We assume you know which buffer it's pointing into.  */
+/* Return the position where OV ends in its buffer, or -1.  */
 
 INLINE ptrdiff_t
-OVERLAY_POSITION (Lisp_Object p)
+OVERLAY_END (Lisp_Object ov)
+{
+  return overlay_end (XOVERLAY (ov));
+}
+
+/* Return the plist of overlay OV.  */
+
+INLINE Lisp_Object
+OVERLAY_PLIST (Lisp_Object ov)
+{
+  return XOVERLAY (ov)->plist;
+}
+
+/* Return the buffer of overlay OV, or NULL if it has been deleted.  */
+
+INLINE struct buffer *
+OVERLAY_BUFFER (Lisp_Object ov)
+{
+  return XOVERLAY (ov)->buffer;
+}
+
+/* Return true if text inserted at the start of OV is excluded from it,
+   like a marker with insertion type t.  */
+
+INLINE bool
+OVERLAY_FRONT_ADVANCE_P (Lisp_Object ov)
+{
+  return XOVERLAY (ov)->interval->front_advance;
+}
+
+/* Return true if text inserted at the end of OV is included in it.  */
+
+INLINE bool
+OVERLAY_REAR_ADVANCE_P (Lisp_Object ov)
 {
-  return marker_position (p);
+  return XOVERLAY (ov)->interval->rear_advance;
 }
 
 
@@ -8029,6 +8029,61 @@ decode_coding_gap (struct coding_system *coding, ptrdiff_t bytes)
 }
 
 
+/* Set the need_adjustment flag of the markers of the current buffer
+   that will have to be put back at either end of the text between FROM
+   and TO once it is converted in place: those at FROM whose insertion
+   type is t, and those at TO whose insertion type is nil.  Return true
+   if there are any.  */
+
+static bool
+flag_markers_for_adjustment (ptrdiff_t from, ptrdiff_t to)
+{
+  struct Lisp_Marker *tail;
+  bool need_marker_adjustment = false;
+
+  FOR_EACH_MARKER (current_buffer, tail)
+    {
+      tail->need_adjustment
+	= tail->charpos == (tail->insertion_type ? from : to);
+      need_marker_adjustment |= tail->need_adjustment;
+    }
+  return need_marker_adjustment;
+}
+
+/* Put the markers flagged by flag_markers_for_adjustment back at the
+   ends of the converted text, which is between FROM (FROM_BYTE) and
+   TO (TO_BYTE).  */
+
+static void
+adjust_flagged_markers (ptrdiff_t from, ptrdiff_t from_byte,
+			ptrdiff_t to, ptrdiff_t to_byte)
+{
+  struct Lisp_Marker *tail, **markers;
+  ptrdiff_t nmarkers = 0, i;
+  USE_SAFE_ALLOCA;
+
+  /* Moving a marker can change its place in the tree of markers, so
+     collect them all first.  */
+  FOR_EACH_MARKER (current_buffer, tail)
+    nmarkers += tail->need_adjustment;
+  SAFE_NALLOCA (markers, 1, nmarkers);
+  i = 0;
+  FOR_EACH_MARKER (current_buffer, tail)
+    if (tail->need_adjustment)
+      markers[i++] = tail;
+
+  for (i = 0; i < nmarkers; i++)
+    {
+      tail = markers[i];
+      tail->need_adjustment = 0;
+      if (tail->insertion_type)
+	attach_marker (tail, tail->buffer, from, from_byte);
+      else
+	attach_marker (tail, tail->buffer, to, to_byte);
+    }
+  SAFE_FREE ();
+}
+
 /* Decode the text in the range FROM/FROM_BYTE and TO/TO_BYTE in
    SRC_OBJECT into DST_OBJECT by coding context CODING.
 
@@ -8100,14 +8155,7 @@ decode_coding_object (struct coding_system *coding,
 	move_gap_both (from, from_byte);
       if (EQ (src_object, dst_object))
 	{
-	  struct Lisp_Marker *tail;
-
-	  for (tail = BUF_MARKERS (current_buffer); tail; tail = tail->next)
-	    {
-	      tail->need_adjustment
-		= tail->charpos == (tail->insertion_type ? from : to);
-	      need_marker_adjustment |= tail->need_adjustment;
-	    }
+	  need_marker_adjustment = flag_markers_for_adjustment (from, to);
 	  saved_pt = PT, saved_pt_byte = PT_BYTE;
 	  TEMP_SET_PT_BOTH (from, from_byte);
 	  current_buffer->text->inhibit_shrinking = 1;
@@ -8216,27 +8264,11 @@ decode_coding_object (struct coding_system *coding,
 			  saved_pt_byte + (coding->produced - bytes));
 
       if (need_marker_adjustment)
-	{
-	  struct Lisp_Marker *tail;
-
-	  for (tail = BUF_MARKERS (current_buffer); tail; tail = tail->next)
-	    if (tail->need_adjustment)
-	      {
-		tail->need_adjustment = 0;
-		if (tail->insertion_type)
-		  {
-		    tail->bytepos = from_byte;
-		    tail->charpos = from;
-		  }
-		else
-		  {
-		    tail->bytepos = from_byte + coding->produced;
-		    tail->charpos
-		      = (NILP (BVAR (current_buffer, enable_multibyte_characters))
-			 ? tail->bytepos : from + coding->produced_char);
-		  }
-	      }
-	}
+	adjust_flagged_markers
+	  (from, from_byte,
+	   (NILP (BVAR (current_buffer, enable_multibyte_characters))
+	    ? from_byte + coding->produced : from + coding->produced_char),
+	   from_byte + coding->produced);
     }
 
   Vdeactivate_mark = old_deactivate_mark;
@@ -8270,16 +8302,7 @@ encode_coding_object (struct coding_system *coding,
   attrs = CODING_ID_ATTRS (coding->id);
 
   if (EQ (src_object, dst_object))
-    {
-      struct Lisp_Marker *tail;
-
-      for (tail = BUF_MARKERS (current_buffer); tail; tail = tail->next)
-	{
-	  tail->need_adjustment
-	    = tail->charpos == (tail->insertion_type ? from : to);
-	  need_marker_adjustment |= tail->need_adjustment;
-	}
-    }
+    need_marker_adjustment = flag_markers_for_adjustment (from, to);
 
   if (! NILP (CODING_ATTR_PRE_WRITE (attrs)))
     {
@@ -8419,27 +8442,11 @@ encode_coding_object (struct coding_system *coding,
 			  saved_pt_byte + (coding->produced - bytes));
 
       if (need_marker_adjustment)
-	{
-	  struct Lisp_Marker *tail;
-
-	  for (tail = BUF_MARKERS (current_buffer); tail; tail = tail->next)
-	    if (tail->need_adjustment)
-	      {
-		tail->need_adjustment = 0;
-		if (tail->insertion_type)
-		  {
-		    tail->bytepos = from_byte;
-		    tail->charpos = from;
-		  }
-		else
-		  {
-		    tail->bytepos = from_byte + coding->produced;
-		    tail->charpos
-		      = (NILP (BVAR (current_buffer, enable_multibyte_characters))
-			 ? tail->bytepos : from + coding->produced_char);
-		  }
-	      }
-	}
+	adjust_flagged_markers
+	  (from, from_byte,
+	   (NILP (BVAR (current_buffer, enable_multibyte_characters))
+	    ? from_byte + coding->produced : from + coding->produced_char),
+	   from_byte + coding->produced);
     }
 
   if (kill_src_buffer)
@@ -262,41 +262,14 @@ overlays_around (EMACS_INT pos, Lisp_Object *vec, ptrdiff_t len)
 {
   ptrdiff_t idx = 0;
 
-  for (struct Lisp_Overlay *tail = current_buffer->overlays_before;
-       tail; tail = tail->next)
-    {
-      Lisp_Object overlay = make_lisp_ptr (tail, Lisp_Vectorlike);
-      Lisp_Object end = OVERLAY_END (overlay);
-      ptrdiff_t endpos = OVERLAY_POSITION (end);
-      if (endpos < pos)
-	  break;
-      Lisp_Object start = OVERLAY_START (overlay);
-      ptrdiff_t startpos = OVERLAY_POSITION (start);
-      if (startpos <= pos)
-	{
-	  if (idx < len)
-	    vec[idx] = overlay;
-	  /* Keep counting overlays even if we can't return them all.  */
-	  idx++;
-	}
-    }
+  struct itree_node *node;
 
-  for (struct Lisp_Overlay *tail = current_buffer->overlays_after;
-       tail; tail = tail->next)
+  ITREE_FOREACH (node, current_buffer->overlays, pos, pos, ASCENDING)
     {
-      Lisp_Object overlay = make_lisp_ptr (tail, Lisp_Vectorlike);
-      Lisp_Object start = OVERLAY_START (overlay);
-      ptrdiff_t startpos = OVERLAY_POSITION (start);
-      if (pos < startpos)
-	break;
-      Lisp_Object end = OVERLAY_END (overlay);
-      ptrdiff_t endpos = OVERLAY_POSITION (end);
-      if (pos <= endpos)
-	{
-	  if (idx < len)
-	    vec[idx] = overlay;
-	  idx++;
-	}
+      if (idx < len)
+	vec[idx] = node->data;
+      /* Keep counting overlays even if we can't return them all.  */
+      idx++;
     }
 
   return idx;
@@ -359,11 +332,10 @@ DEFUN ("get-pos-property", Fget_pos_property, Sget_pos_property, 2, 3, 0,
 	  if (!NILP (tem))
 	    {
 	      /* Check the overlay is indeed active at point.  */
-	      Lisp_Object start = OVERLAY_START (ol), finish = OVERLAY_END (ol);
-	      if ((OVERLAY_POSITION (start) == posn
-		   && XMARKER (start)->insertion_type == 1)
-		  || (OVERLAY_POSITION (finish) == posn
-		      && XMARKER (finish)->insertion_type == 0))
+	      if ((OVERLAY_START (ol) == posn
+		   && OVERLAY_FRONT_ADVANCE_P (ol))
+		  || (OVERLAY_END (ol) == posn
+		      && ! OVERLAY_REAR_ADVANCE_P (ol)))
 		; /* The overlay will not cover a char inserted at point.  */
 	      else
 		{
@@ -2729,21 +2701,26 @@ save_restriction_restore (Lisp_Object data)
       eassert (buf == end->buffer);
 
       if (buf /* Verify marker still points to a buffer.  */
-	  && (beg->charpos != BUF_BEGV (buf) || end->charpos != BUF_ZV (buf)))
+	  && (marker_charpos (beg) != BUF_BEGV (buf)
+	      || marker_charpos (end) != BUF_ZV (buf)))
 	/* The restriction has changed from the saved one, so restore
 	   the saved restriction.  */
 	{
 	  ptrdiff_t pt = BUF_PT (buf);
+	  ptrdiff_t beg_charpos = marker_charpos (beg);
+	  ptrdiff_t beg_bytepos = marker_bytepos (beg);
+	  ptrdiff_t end_charpos = marker_charpos (end);
+	  ptrdiff_t end_bytepos = marker_bytepos (end);
 
-	  SET_BUF_BEGV_BOTH (buf, beg->charpos, beg->bytepos);
-	  SET_BUF_ZV_BOTH (buf, end->charpos, end->bytepos);
+	  SET_BUF_BEGV_BOTH (buf, beg_charpos, beg_bytepos);
+	  SET_BUF_ZV_BOTH (buf, end_charpos, end_bytepos);
 
-	  if (pt < beg->charpos || pt > end->charpos)
+	  if (pt < beg_charpos || pt > end_charpos)
 	    /* The point is outside the new visible range, move it inside. */
 	    SET_BUF_PT_BOTH (buf,
-			     clip_to_bounds (beg->charpos, pt, end->charpos),
-			     clip_to_bounds (beg->bytepos, BUF_PT_BYTE (buf),
-					     end->bytepos));
+			     clip_to_bounds (beg_charpos, pt, end_charpos),
+			     clip_to_bounds (beg_bytepos, BUF_PT_BYTE (buf),
+					     end_bytepos));
 
 	  buf->clip_changed = 1; /* Remember that the narrowing changed. */
 	}
@@ -4038,6 +4015,9 @@ transpose_markers (ptrdiff_t start1, ptrdiff_t end1,
 {
   register ptrdiff_t amt1, amt1_byte, amt2, amt2_byte, diff, diff_byte, mpos;
   register struct Lisp_Marker *marker;
+  struct Lisp_Marker **markers;
+  ptrdiff_t nmarkers = 0, i;
+  USE_SAFE_ALLOCA;
 
   /* Update point as if it were a marker.  */
   if (PT < start1)
@@ -4072,31 +4052,40 @@ transpose_markers (ptrdiff_t start1, ptrdiff_t end1,
   amt1_byte = (end2_byte - start2_byte) + (start2_byte - end1_byte);
   amt2_byte = (end1_byte - start1_byte) + (start2_byte - end1_byte);
 
-  for (marker = BUF_MARKERS (current_buffer); marker; marker = marker->next)
+  /* The markers between START1 and END2 change their order, and so
+     their place in the tree of markers: collect them first.  */
+  for (marker = marker_tree_first (current_buffer, start1);
+       marker && marker->charpos < end2;
+       marker = marker_tree_next (current_buffer, marker))
+    nmarkers++;
+  SAFE_NALLOCA (markers, 1, nmarkers);
+  for (i = 0, marker = marker_tree_first (current_buffer, start1);
+       i < nmarkers;
+       i++, marker = marker_tree_next (current_buffer, marker))
+    markers[i] = marker;
+
+  for (i = 0; i < nmarkers; i++)
     {
-      mpos = marker->bytepos;
-      if (mpos >= start1_byte && mpos < end2_byte)
-	{
-	  if (mpos < end1_byte)
-	    mpos += amt1_byte;
-	  else if (mpos < start2_byte)
-	    mpos += diff_byte;
-	  else
-	    mpos -= amt2_byte;
-	  marker->bytepos = mpos;
-	}
-      mpos = marker->charpos;
-      if (mpos >= start1 && mpos < end2)
-	{
-	  if (mpos < end1)
-	    mpos += amt1;
-	  else if (mpos < start2)
-	    mpos += diff;
-	  else
-	    mpos -= amt2;
-	}
-      marker->charpos = mpos;
+      ptrdiff_t mpos_byte;
+
+      marker = markers[i];
+      mpos_byte = marker_bytepos (marker);
+      if (mpos_byte < end1_byte)
+	mpos_byte += amt1_byte;
+      else if (mpos_byte < start2_byte)
+	mpos_byte += diff_byte;
+      else
+	mpos_byte -= amt2_byte;
+      mpos = marker_charpos (marker);
+      if (mpos < end1)
+	mpos += amt1;
+      else if (mpos < start2)
+	mpos += diff;
+      else
+	mpos -= amt2;
+      attach_marker (marker, marker->buffer, mpos, mpos_byte);
     }
+  SAFE_FREE ();
 }
 
 DEFUN ("transpose-regions", Ftranspose_regions, Stranspose_regions, 4, 5,
@@ -4283,6 +4272,11 @@ DEFUN ("transpose-regions", Ftranspose_regions, Stranspose_regions, 4, 5,
                                    len1, current_buffer, 0);
       graft_intervals_into_buffer (tmp_interval2, start1,
                                    len2, current_buffer, 0);
+      /* Make the index of character positions forget its chunk
+	 boundaries inside the transposed text.  */
+      adjust_char_index (current_buffer, start1, start1_byte,
+			 end2 - start1, end2_byte - start1_byte,
+			 end2 - start1, end2_byte - start1_byte);
       update_compositions (start1, start1 + len2, CHECK_BORDER);
       update_compositions (start1 + len2, end2, CHECK_TAIL);
     }
@@ -4390,6 +4384,11 @@ DEFUN ("transpose-regions", Ftranspose_regions, Stranspose_regions, 4, 5,
                                        len2, current_buffer, 0);
         }
 
+      /* Make the index of character positions forget its chunk
+	 boundaries inside the transposed text.  */
+      adjust_char_index (current_buffer, start1, start1_byte,
+			 end2 - start1, end2_byte - start1_byte,
+			 end2 - start1, end2_byte - start1_byte);
       update_compositions (start1, start1 + len2, CHECK_BORDER);
       update_compositions (end2 - len1, end2, CHECK_BORDER);
     }
@@ -4402,7 +4401,7 @@ DEFUN ("transpose-regions", Ftranspose_regions, Stranspose_regions, 4, 5,
       transpose_markers (start1, end1, start2, end2,
 			 start1_byte, start1_byte + len1_byte,
 			 start2_byte, start2_byte + len2_byte);
-      fix_start_end_in_overlays (start1, end2);
+      transpose_overlays (start1, end1, start2, end2);
     }
   else
     {
@@ -1829,6 +1829,7 @@ main (int argc, char **argv)
       syms_of_minibuf ();
       syms_of_process ();
       syms_of_search ();
+      syms_of_line_index ();
       syms_of_sysdep ();
       syms_of_timefns ();
       syms_of_frame ();
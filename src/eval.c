@@ -1535,15 +1535,21 @@ process_quit_flag (void)
    If quit-flag is set to `kill-emacs' the SIGINT handler has received
    a request to exit Emacs when it is safe to do.
 
-   When not quitting, process any pending signals.  */
+   When not quitting, process any pending signals, and report any
+   mapped file found to be truncated by handle_mapped_text_fault.  */
 
 void
 maybe_quit (void)
 {
   if (!NILP (Vquit_flag) && NILP (Vinhibit_quit))
     process_quit_flag ();
-  else if (pending_signals)
-    process_pending_signals ();
+  else
+    {
+      if (pending_signals)
+	process_pending_signals ();
+      if (mapped_text_fault_pending)
+	check_mapped_buffer_text ();
+    }
 }
 
 DEFUN ("signal", Fsignal, Ssignal, 2, 2, 0,
@@ -3549,7 +3549,6 @@ decide_coding_unwind (Lisp_Object unwind_data)
      So move markers that set-auto-coding might have created to BEG,
      just in case.  */
   adjust_markers_for_delete (BEG, BEG_BYTE, Z, Z_BYTE);
-  adjust_overlays_for_delete (BEG, Z - BEG);
   set_buffer_intervals (current_buffer, NULL);
   TEMP_SET_PT_BOTH (BEG, BEG_BYTE);
 
@@ -3985,8 +3984,7 @@ because (1) it preserves some marker positions and (2) it puts less data
 		  bset_read_only (buf, Qnil);
 		  bset_filename (buf, Qnil);
 		  bset_undo_list (buf, Qt);
-		  eassert (buf->overlays_before == NULL);
-		  eassert (buf->overlays_after == NULL);
+		  eassert (!buf->overlays || !buf->overlays->root);
 
 		  set_buffer_internal (buf);
 		  Ferase_buffer ();
@@ -4419,16 +4417,6 @@ because (1) it preserves some marker positions and (2) it puts less data
       prepare_to_modify_buffer (PT, PT, NULL);
     }
 
-  move_gap_both (PT, PT_BYTE);
-  if (GAP_SIZE < total)
-    make_gap (total - GAP_SIZE);
-
-  if (beg_offset != 0 || !NILP (replace))
-    {
-      if (lseek (fd, beg_offset, SEEK_SET) < 0)
-	report_file_error ("Setting file position", orig_filename);
-    }
-
   /* In the following loop, HOW_MUCH contains the total bytes read so
      far for a regular file, and not changed for a special file.  But,
      before exiting the loop, it is set to a negative value if I/O
@@ -4438,6 +4426,29 @@ because (1) it preserves some marker positions and (2) it puts less data
   /* Total bytes inserted.  */
   inserted = 0;
 
+  /* A large enough file inserted whole into an empty buffer can be
+     mapped into memory as the gap, instead of being read there.  */
+  if (! not_regular && NILP (replace) && Z == BEG
+      && buffer_intervals (current_buffer) == NULL
+      && beg_offset == 0 && total == st.st_size && total > 0
+      && FIXNUMP (Vlarge_file_mapping_threshold)
+      && 0 <= XFIXNUM (Vlarge_file_mapping_threshold)
+      && XFIXNUM (Vlarge_file_mapping_threshold) <= total
+      && map_buffer_text (current_buffer, fd, total))
+    how_much = inserted = total;
+  else
+    {
+      move_gap_both (PT, PT_BYTE);
+      if (GAP_SIZE < total)
+	make_gap (total - GAP_SIZE);
+
+      if (beg_offset != 0 || !NILP (replace))
+	{
+	  if (lseek (fd, beg_offset, SEEK_SET) < 0)
+	    report_file_error ("Setting file position", orig_filename);
+	}
+    }
+
   /* Here, we don't do code conversion in the loop.  It is done by
      decode_coding_gap after all data are read into the buffer.  */
   {
@@ -4619,10 +4630,18 @@ because (1) it preserves some marker positions and (2) it puts less data
   if (CODING_MAY_REQUIRE_DECODING (&coding)
       && (inserted > 0 || CODING_REQUIRE_FLUSHING (&coding)))
     {
+      /* Decode multibyte text from a copy of a mapped file, as the
+	 file could be changed by another program while its pages are
+	 decoded, or afterwards, leaving invalid text in the buffer.  */
+      if (coding.dst_multibyte)
+	unmap_buffer_text (current_buffer);
+
       /* Now we have all the new bytes at the beginning of the gap,
          but `decode_coding_gap` can't have them at the beginning of the gap,
-         so we need to move them.  */
-      memmove (GAP_END_ADDR - inserted, GPT_ADDR, inserted);
+         so we need to move them.  They fill the gap of a mapped file,
+         whose pages should not be written needlessly.  */
+      if (GAP_SIZE != inserted)
+	memmove (GAP_END_ADDR - inserted, GPT_ADDR, inserted);
       decode_coding_gap (&coding, inserted);
       inserted = coding.produced_char;
       coding_system = CODING_ID_NAME (coding.id);
@@ -6328,6 +6347,28 @@ do (file-exists-p FILENAME) and FILENAME is handled by HANDLER, then
 or local variable spec of the tailing lines with `coding:' tag.  */);
   Vset_auto_coding_function = Qnil;
 
+  DEFVAR_LISP ("large-file-mapping-threshold", Vlarge_file_mapping_threshold,
+	       doc: /* Size in bytes from which `insert-file-contents' maps files.
+When a regular file at least this large is inserted whole into an
+empty buffer, the text of the buffer becomes a private mapping of the
+file in memory, instead of a copy of it read into memory.  Parts of
+the file are then read only when they are looked at, and copied only
+when they are modified.  This makes visiting very large files
+literally, for instance with `find-file-literally', faster and lighter.
+Only the text of unibyte buffers stays mapped: text decoded into a
+multibyte buffer is copied first, since a change of the file by
+another program could make it invalid.
+
+A file visited that way should not be modified by other programs.  If
+it is, the buffer shows the changes, and Emacs signals an error before
+the next command; the text of the buffer then stops following the
+file.  If the file is truncated, the part of the text that is gone
+reads as null characters, and Emacs signals an error the next time it
+checks for a quit.
+
+nil, the default, means never to map files into memory.  */);
+  Vlarge_file_mapping_threshold = Qnil;
+
   DEFVAR_LISP ("after-insert-file-functions", Vafter_insert_file_functions,
 	       doc: /* A list of functions to be called at the end of `insert-file-contents'.
 Each is passed one argument, the number of characters inserted,
@@ -2440,10 +2440,9 @@ internal_equal (Lisp_Object o1, Lisp_Object o2, enum equal_kind equal_kind,
 	  return mpz_cmp (*xbignum_val (o1), *xbignum_val (o2)) == 0;
 	if (OVERLAYP (o1))
 	  {
-	    if (!internal_equal (OVERLAY_START (o1), OVERLAY_START (o2),
-				 equal_kind, depth + 1, ht)
-		|| !internal_equal (OVERLAY_END (o1), OVERLAY_END (o2),
-				    equal_kind, depth + 1, ht))
+	    if (OVERLAY_BUFFER (o1) != OVERLAY_BUFFER (o2)
+		|| OVERLAY_START (o1) != OVERLAY_START (o2)
+		|| OVERLAY_END (o1) != OVERLAY_END (o2))
 	      return false;
 	    o1 = XOVERLAY (o1)->plist;
 	    o2 = XOVERLAY (o2)->plist;
@@ -2454,7 +2453,8 @@ internal_equal (Lisp_Object o1, Lisp_Object o2, enum equal_kind equal_kind,
 	  {
 	    return (XMARKER (o1)->buffer == XMARKER (o2)->buffer
 		    && (XMARKER (o1)->buffer == 0
-			|| XMARKER (o1)->bytepos == XMARKER (o2)->bytepos));
+			|| (marker_bytepos (XMARKER (o1))
+			    == marker_bytepos (XMARKER (o2)))));
 	  }
 	if (BOOL_VECTOR_P (o1))
 	  {
@@ -4686,7 +4686,7 @@ sxhash_obj (Lisp_Object obj, int depth)
 	else if (pvec_type == PVEC_MARKER)
 	  {
 	    ptrdiff_t bytepos
-	      = XMARKER (obj)->buffer ? XMARKER (obj)->bytepos : 0;
+	      = XMARKER (obj)->buffer ? marker_bytepos (XMARKER (obj)) : 0;
 	    EMACS_UINT hash
 	      = sxhash_combine ((intptr_t) XMARKER (obj)->buffer, bytepos);
 	    return SXHASH_REDUCE (hash);
@@ -4695,8 +4695,8 @@ sxhash_obj (Lisp_Object obj, int depth)
 	  return sxhash_bool_vector (obj);
 	else if (pvec_type == PVEC_OVERLAY)
 	  {
-	    EMACS_UINT hash = sxhash_obj (OVERLAY_START (obj), depth);
-	    hash = sxhash_combine (hash, sxhash_obj (OVERLAY_END (obj), depth));
+	    EMACS_UINT hash = OVERLAY_START (obj);
+	    hash = sxhash_combine (hash, OVERLAY_END (obj));
 	    hash = sxhash_combine (hash, sxhash_obj (XOVERLAY (obj)->plist, depth));
 	    return SXHASH_REDUCE (hash);
 	  }
@@ -61,10 +61,10 @@
 static void
 check_markers (void)
 {
-  struct Lisp_Marker *tail;
+  struct Lisp_Marker *tail, *prev = NULL;
   bool multibyte = ! NILP (BVAR (current_buffer, enable_multibyte_characters));
 
-  for (tail = BUF_MARKERS (current_buffer); tail; tail = tail->next)
+  FOR_EACH_MARKER (current_buffer, tail)
     {
       if (tail->buffer->text != current_buffer->text)
 	emacs_abort ();
@@ -74,6 +74,10 @@ check_markers (void)
 	emacs_abort ();
       if (multibyte && ! CHAR_HEAD_P (FETCH_BYTE (tail->bytepos)))
 	emacs_abort ();
+      if (prev && (prev->charpos > tail->charpos
+		   || prev->bytepos > tail->bytepos))
+	emacs_abort ();
+      prev = tail;
     }
 }
 
@@ -227,14 +231,15 @@ adjust_suspend_auto_hscroll (ptrdiff_t from, ptrdiff_t to)
 
       if (BUFFERP (w->contents)
 	  && XBUFFER (w->contents) == current_buffer
-	  && XMARKER (w->old_pointm)->charpos >= from
-	  && XMARKER (w->old_pointm)->charpos <= to)
+	  && XMARKER (w->old_pointm)->buffer
+	  && marker_charpos (XMARKER (w->old_pointm)) >= from
+	  && marker_charpos (XMARKER (w->old_pointm)) <= to)
 	w->suspend_auto_hscroll = 0;
     }
 }
 
 
-/* Adjust all markers for a deletion
+/* Adjust all markers, and overlays, for a deletion
    whose range in bytes is FROM_BYTE to TO_BYTE.
    The range in charpos is FROM to TO.
 
@@ -245,35 +250,21 @@ adjust_suspend_auto_hscroll (ptrdiff_t from, ptrdiff_t to)
 adjust_markers_for_delete (ptrdiff_t from, ptrdiff_t from_byte,
 			   ptrdiff_t to, ptrdiff_t to_byte)
 {
-  struct Lisp_Marker *m;
-  ptrdiff_t charpos;
-
   adjust_suspend_auto_hscroll (from, to);
-  for (m = BUF_MARKERS (current_buffer); m; m = m->next)
-    {
-      charpos = m->charpos;
-      eassert (charpos <= Z);
 
-      /* If the marker is after the deletion,
-	 relocate by number of chars / bytes deleted.  */
-      if (charpos > to)
-	{
-	  m->charpos -= to - from;
-	  m->bytepos -= to_byte - from_byte;
-	}
-      /* Here's the case where a marker is inside text being deleted.  */
-      else if (charpos > from)
-	{
-	  m->charpos = from;
-	  m->bytepos = from_byte;
-	}
-    }
+  /* Markers after the deletion are relocated by the number of chars /
+     bytes deleted, and markers inside it go to FROM.  */
+  marker_tree_replace (current_buffer, from, from_byte,
+		       to, from - to, from_byte - to_byte);
+  adjust_char_index (current_buffer, from, from_byte,
+		     to - from, to_byte - from_byte, 0, 0);
+  adjust_overlays_for_delete (from, to - from);
 }
 
 
-/* Adjust markers for an insertion that stretches from FROM / FROM_BYTE
-   to TO / TO_BYTE.  We have to relocate the charpos of every marker
-   that points after the insertion (but not their bytepos).
+/* Adjust markers, and overlays, for an insertion that stretches from
+   FROM / FROM_BYTE to TO / TO_BYTE.  We have to relocate the charpos of
+   every marker that points after the insertion (but not their bytepos).
 
    When a marker points at the insertion point,
    we advance it if either its insertion-type is t
@@ -283,42 +274,13 @@ adjust_markers_for_delete (ptrdiff_t from, ptrdiff_t from_byte,
 adjust_markers_for_insert (ptrdiff_t from, ptrdiff_t from_byte,
 			   ptrdiff_t to, ptrdiff_t to_byte, bool before_markers)
 {
-  struct Lisp_Marker *m;
-  bool adjusted = 0;
-  ptrdiff_t nchars = to - from;
-  ptrdiff_t nbytes = to_byte - from_byte;
-
   adjust_suspend_auto_hscroll (from, to);
-  for (m = BUF_MARKERS (current_buffer); m; m = m->next)
-    {
-      eassert (m->bytepos >= m->charpos
-	       && m->bytepos - m->charpos <= Z_BYTE - Z);
-
-      if (m->bytepos == from_byte)
-	{
-	  if (m->insertion_type || before_markers)
-	    {
-	      m->bytepos = to_byte;
-	      m->charpos = to;
-	      if (m->insertion_type)
-		adjusted = 1;
-	    }
-	}
-      else if (m->bytepos > from_byte)
-	{
-	  m->bytepos += nbytes;
-	  m->charpos += nchars;
-	}
-    }
+  marker_tree_insert_gap (current_buffer, from, from_byte,
+			  to - from, to_byte - from_byte, before_markers);
+  adjust_char_index (current_buffer, from, from_byte,
+		     0, 0, to - from, to_byte - from_byte);
 
-  /* Adjusting only markers whose insertion-type is t may result in
-     - disordered start and end in overlays, and
-     - disordered overlays in the slot `overlays_before' of current_buffer.  */
-  if (adjusted)
-    {
-      fix_start_end_in_overlays (from, to);
-      fix_overlays_before (current_buffer, from, to);
-    }
+  adjust_overlays_for_insert (from, to - from, before_markers);
 }
 
 /* Adjust point for an insertion of NBYTES bytes, which are NCHARS characters.
@@ -339,35 +301,31 @@ adjust_point (ptrdiff_t nchars, ptrdiff_t nbytes)
   eassert (PT_BYTE >= PT && PT_BYTE - PT <= ZV_BYTE - ZV);
 }
 
-/* Adjust markers for a replacement of a text at FROM (FROM_BYTE) of
-   length OLD_CHARS (OLD_BYTES) to a new text of length NEW_CHARS
-   (NEW_BYTES).  It is assumed that OLD_CHARS > 0, i.e., this is not
-   an insertion.  */
+/* Adjust markers, and overlays, for a replacement of a text at FROM
+   (FROM_BYTE) of length OLD_CHARS (OLD_BYTES) to a new text of length
+   NEW_CHARS (NEW_BYTES).  It is assumed that OLD_CHARS > 0, i.e., this
+   is not an insertion.  */
 
 static void
 adjust_markers_for_replace (ptrdiff_t from, ptrdiff_t from_byte,
 			    ptrdiff_t old_chars, ptrdiff_t old_bytes,
 			    ptrdiff_t new_chars, ptrdiff_t new_bytes)
 {
-  register struct Lisp_Marker *m;
-  ptrdiff_t prev_to_byte = from_byte + old_bytes;
   ptrdiff_t diff_chars = new_chars - old_chars;
   ptrdiff_t diff_bytes = new_bytes - old_bytes;
 
   adjust_suspend_auto_hscroll (from, from + old_chars);
-  for (m = BUF_MARKERS (current_buffer); m; m = m->next)
-    {
-      if (m->bytepos >= prev_to_byte)
-	{
-	  m->charpos += diff_chars;
-	  m->bytepos += diff_bytes;
-	}
-      else if (m->bytepos > from_byte)
-	{
-	  m->charpos = from;
-	  m->bytepos = from_byte;
-	}
-    }
+  /* Markers at or after the old text move past the new one, and those
+     inside it go to FROM.  */
+  marker_tree_replace (current_buffer, from, from_byte,
+		       from + old_chars, diff_chars, diff_bytes);
+  adjust_char_index (current_buffer, from, from_byte,
+		     old_chars, old_bytes, new_chars, new_bytes);
+
+  /* Move the overlay ends the same way: those at or after the old
+     text advance past the new one, those inside it go to FROM.  */
+  adjust_overlays_for_insert (from + old_chars, new_chars, true);
+  adjust_overlays_for_delete (from, old_chars);
 
   check_markers ();
 }
@@ -408,35 +366,29 @@ adjust_markers_bytepos (ptrdiff_t from, ptrdiff_t from_byte,
 
   adjust_suspend_auto_hscroll (from, to);
 
+  /* The affected markers are those after FROM, and up to TO unless
+     TO_Z.  Their character positions don't change, so they stay in
+     order, and we can compute each one's bytepos from the one of the
+     marker before.  */
   if (Z == Z_BYTE || (!to_z && to == to_byte))
     {
       /* Make sure each affected marker's bytepos is equal to
 	 its charpos.  */
-      for (m = BUF_MARKERS (current_buffer); m; m = m->next)
-	{
-	  if (m->bytepos > from_byte
-	      && (to_z || m->bytepos <= to_byte))
-	    m->bytepos = m->charpos;
-	}
+      for (m = marker_tree_first (current_buffer, from + 1);
+	   m && (to_z || m->charpos <= to);
+	   m = marker_tree_next (current_buffer, m))
+	m->bytepos = m->charpos;
     }
   else
     {
-      for (m = BUF_MARKERS (current_buffer); m; m = m->next)
+      for (m = marker_tree_first (current_buffer, from + 1);
+	   m && (to_z || m->charpos <= to);
+	   m = marker_tree_next (current_buffer, m))
 	{
 	  /* Recompute each affected marker's bytepos.  */
-	  if (m->bytepos > from_byte
-	      && (to_z || m->bytepos <= to_byte))
-	    {
-	      if (m->charpos < beg
-		  && beg - m->charpos > m->charpos - from)
-		{
-		  beg = from;
-		  begbyte = from_byte;
-		}
-	      m->bytepos = count_bytes (beg, begbyte, m->charpos);
-	      beg = m->charpos;
-	      begbyte = m->bytepos;
-	    }
+	  m->bytepos = count_bytes (beg, begbyte, m->charpos);
+	  beg = m->charpos;
+	  begbyte = m->bytepos;
 	}
     }
 
@@ -460,7 +412,7 @@ make_gap_larger (ptrdiff_t nbytes_added)
   ptrdiff_t real_gap_loc;
   ptrdiff_t real_gap_loc_byte;
   ptrdiff_t old_gap_size;
-  ptrdiff_t current_size = Z_BYTE - BEG_BYTE + GAP_SIZE;
+  ptrdiff_t current_size = Z_BYTE - BEG_BYTE + GAP_SIZE + TAIL_SIZE;
 
   if (BUF_BYTES_MAX - current_size < nbytes_added)
     buffer_overflow ();
@@ -470,7 +422,12 @@ make_gap_larger (ptrdiff_t nbytes_added)
   nbytes_added = min (nbytes_added + GAP_BYTES_DFL,
 		      BUF_BYTES_MAX - current_size);
 
-  enlarge_buffer_text (current_buffer, nbytes_added);
+  /* Any room after the end of the text becomes part of the new gap.  */
+  if (nbytes_added > TAIL_SIZE)
+    enlarge_buffer_text (current_buffer, nbytes_added - TAIL_SIZE);
+  else
+    nbytes_added = TAIL_SIZE;
+  TAIL_SIZE = 0;
 
   /* Prevent quitting in gap_left.  We cannot allow a quit there,
      because that would leave the buffer text in an inconsistent
@@ -546,7 +503,9 @@ make_gap_smaller (ptrdiff_t nbytes_removed)
   /* Move the unwanted pretend gap to the end of the buffer.  */
   gap_right (Z, Z_BYTE);
 
-  enlarge_buffer_text (current_buffer, -nbytes_removed);
+  /* Release it, along with any room after the end of the text.  */
+  enlarge_buffer_text (current_buffer, -(nbytes_removed + TAIL_SIZE));
+  TAIL_SIZE = 0;
 
   /* Now restore the desired gap.  */
   GAP_SIZE = new_gap_size;
@@ -603,6 +562,98 @@ make_gap_1 (struct buffer *b, ptrdiff_t nbytes)
   current_buffer = oldb;
 }
 
+/* Text after the gap is not moved to insert at the end of the buffer
+   if it is longer than this many bytes; see make_room_for_insertion.  */
+
+enum { TAIL_MOVE_BYTES_MAX = 64 * 1024 };
+
+/* Make the room after the end of the current buffer's text at least
+   NBYTES bytes longer.  */
+
+static void
+make_tail_larger (ptrdiff_t nbytes)
+{
+  ptrdiff_t current_size = Z_BYTE - BEG_BYTE + GAP_SIZE + TAIL_SIZE;
+
+  if (BUF_BYTES_MAX - current_size < nbytes)
+    buffer_overflow ();
+
+  /* As in make_gap, grow by an amount proportional to the size of the
+     buffer, so that appending to it repeatedly stays linear.  */
+  nbytes = min (max (nbytes + GAP_BYTES_DFL, (Z_BYTE - BEG_BYTE) / 64),
+		BUF_BYTES_MAX - current_size);
+
+  enlarge_buffer_text (current_buffer, nbytes);
+  TAIL_SIZE += nbytes;
+}
+
+/* Make room for inserting NBYTES bytes at point in the current
+   buffer, and return the address where they should be stored.
+
+   That is usually the gap, after moving it to point.  But when point
+   is at the end of the buffer and a lot of text lies between it and
+   the gap, as when a process appends its output to a large buffer
+   that is being edited further up, the bytes go into the room after
+   the end of the text instead, so that text need not be moved.
+   finish_insertion knows which of the two was used.  */
+
+static unsigned char *
+make_room_for_insertion (ptrdiff_t nbytes)
+{
+  if (PT == Z && Z_BYTE - GPT_BYTE > TAIL_MOVE_BYTES_MAX)
+    {
+      if (TAIL_SIZE < nbytes)
+	make_tail_larger (nbytes - TAIL_SIZE);
+      return Z_ADDR;
+    }
+
+  if (PT != GPT)
+    move_gap_both (PT, PT_BYTE);
+  if (GAP_SIZE < nbytes)
+    make_gap (nbytes - GAP_SIZE);
+  return GPT_ADDR;
+}
+
+/* Account for NCHARS characters, NBYTES bytes, just stored at point
+   in the room that make_room_for_insertion made.  */
+
+static void
+finish_insertion (ptrdiff_t nchars, ptrdiff_t nbytes)
+{
+  if (PT == GPT)
+    {
+      GAP_SIZE -= nbytes;
+      GPT += nchars;
+      ZV += nchars;
+      Z += nchars;
+      GPT_BYTE += nbytes;
+      ZV_BYTE += nbytes;
+      Z_BYTE += nbytes;
+      if (GAP_SIZE > 0) *(GPT_ADDR) = 0; /* Put an anchor.  */
+    }
+  else
+    {
+      /* The text was appended after the end of the buffer, away from
+	 the gap, so tell redisplay where the change is.  */
+      eassert (PT == Z && TAIL_SIZE >= nbytes);
+      if (Z - BEG < BEG_UNCHANGED)
+	BEG_UNCHANGED = Z - BEG;
+      END_UNCHANGED = 0;
+      TAIL_SIZE -= nbytes;
+      ZV += nchars;
+      Z += nchars;
+      ZV_BYTE += nbytes;
+      Z_BYTE += nbytes;
+      *(Z_ADDR) = 0; /* Put an anchor.  */
+    }
+
+  eassert (GPT <= GPT_BYTE);
+
+  /* The insert may have been in the unchanged region, so check again.  */
+  if (Z - GPT < END_UNCHANGED)
+    END_UNCHANGED = Z - GPT;
+}
+
 /* Copy NBYTES bytes of text from FROM_ADDR to TO_ADDR.
    FROM_MULTIBYTE says whether the incoming text is multibyte.
    TO_MULTIBYTE says whether to store the text as multibyte.
@@ -894,10 +945,7 @@ insert_1_both (const char *string,
        or make it smaller.  */
     prepare_to_modify_buffer (PT, PT, NULL);
 
-  if (PT != GPT)
-    move_gap_both (PT, PT_BYTE);
-  if (GAP_SIZE < nbytes)
-    make_gap (nbytes - GAP_SIZE);
+  unsigned char *dest = make_room_for_insertion (nbytes);
 
 #ifdef BYTE_COMBINING_DEBUG
   if (count_combining_before (string, nbytes, PT, PT_BYTE)
@@ -912,24 +960,9 @@ insert_1_both (const char *string,
   modiff_incr (&MODIFF);
   CHARS_MODIFF = MODIFF;
 
-  memcpy (GPT_ADDR, string, nbytes);
+  memcpy (dest, string, nbytes);
+  finish_insertion (nchars, nbytes);
 
-  GAP_SIZE -= nbytes;
-  GPT += nchars;
-  ZV += nchars;
-  Z += nchars;
-  GPT_BYTE += nbytes;
-  ZV_BYTE += nbytes;
-  Z_BYTE += nbytes;
-  if (GAP_SIZE > 0) *(GPT_ADDR) = 0; /* Put an anchor.  */
-
-  eassert (GPT <= GPT_BYTE);
-
-  /* The insert may have been in the unchanged region, so check again.  */
-  if (Z - GPT < END_UNCHANGED)
-    END_UNCHANGED = Z - GPT;
-
-  adjust_overlays_for_insert (PT, nchars);
   adjust_markers_for_insert (PT, PT_BYTE,
 			     PT + nchars, PT_BYTE + nbytes,
 			     before_markers);
@@ -1014,14 +1047,11 @@ insert_from_string_1 (Lisp_Object string, ptrdiff_t pos, ptrdiff_t pos_byte,
      or make it smaller.  */
   prepare_to_modify_buffer (PT, PT, NULL);
 
-  if (PT != GPT)
-    move_gap_both (PT, PT_BYTE);
-  if (GAP_SIZE < outgoing_nbytes)
-    make_gap (outgoing_nbytes - GAP_SIZE);
+  unsigned char *dest = make_room_for_insertion (outgoing_nbytes);
 
   /* Copy the string text into the buffer, perhaps converting
      between single-byte and multibyte.  */
-  copy_text (SDATA (string) + pos_byte, GPT_ADDR, nbytes,
+  copy_text (SDATA (string) + pos_byte, dest, nbytes,
 	     STRING_MULTIBYTE (string),
 	     ! NILP (BVAR (current_buffer, enable_multibyte_characters)));
 
@@ -1029,10 +1059,10 @@ insert_from_string_1 (Lisp_Object string, ptrdiff_t pos, ptrdiff_t pos_byte,
   /* We have copied text into the gap, but we have not altered
      PT or PT_BYTE yet.  So we can pass PT and PT_BYTE
      to these functions and get the same results as we would
-     have got earlier on.  Meanwhile, PT_ADDR does point to
+     have got earlier on.  Meanwhile, DEST does point to
      the text that has been stored by copy_text.  */
-  if (count_combining_before (GPT_ADDR, outgoing_nbytes, PT, PT_BYTE)
-      || count_combining_after (GPT_ADDR, outgoing_nbytes, PT, PT_BYTE))
+  if (count_combining_before (dest, outgoing_nbytes, PT, PT_BYTE)
+      || count_combining_after (dest, outgoing_nbytes, PT, PT_BYTE))
     emacs_abort ();
 #endif
 
@@ -1040,22 +1070,8 @@ insert_from_string_1 (Lisp_Object string, ptrdiff_t pos, ptrdiff_t pos_byte,
   modiff_incr (&MODIFF);
   CHARS_MODIFF = MODIFF;
 
-  GAP_SIZE -= outgoing_nbytes;
-  GPT += nchars;
-  ZV += nchars;
-  Z += nchars;
-  GPT_BYTE += outgoing_nbytes;
-  ZV_BYTE += outgoing_nbytes;
-  Z_BYTE += outgoing_nbytes;
-  if (GAP_SIZE > 0) *(GPT_ADDR) = 0; /* Put an anchor.  */
-
-  eassert (GPT <= GPT_BYTE);
+  finish_insertion (nchars, outgoing_nbytes);
 
-  /* The insert may have been in the unchanged region, so check again.  */
-  if (Z - GPT < END_UNCHANGED)
-    END_UNCHANGED = Z - GPT;
-
-  adjust_overlays_for_insert (PT, nchars);
   adjust_markers_for_insert (PT, PT_BYTE, PT + nchars,
 			     PT_BYTE + outgoing_nbytes,
 			     before_markers);
@@ -1126,7 +1142,6 @@ insert_from_gap (ptrdiff_t nchars, ptrdiff_t nbytes, bool text_at_gap_tail)
 
   insert_from_gap_1 (nchars, nbytes, text_at_gap_tail);
 
-  adjust_overlays_for_insert (ins_charpos, nchars);
   adjust_markers_for_insert (ins_charpos, ins_bytepos,
 			     ins_charpos + nchars, ins_bytepos + nbytes, 0);
 
@@ -1211,10 +1226,7 @@ insert_from_buffer_1 (struct buffer *buf,
      or make it smaller.  */
   prepare_to_modify_buffer (PT, PT, NULL);
 
-  if (PT != GPT)
-    move_gap_both (PT, PT_BYTE);
-  if (GAP_SIZE < outgoing_nbytes)
-    make_gap (outgoing_nbytes - GAP_SIZE);
+  unsigned char *dest = make_room_for_insertion (outgoing_nbytes);
 
   if (from < BUF_GPT (buf))
     {
@@ -1225,7 +1237,7 @@ insert_from_buffer_1 (struct buffer *buf,
 	 to put the output from the second copy_text.  */
       chunk_expanded
 	= copy_text (BUF_BYTE_ADDRESS (buf, from_byte),
-		     GPT_ADDR, chunk,
+		     dest, chunk,
 		     ! NILP (BVAR (buf, enable_multibyte_characters)),
 		     ! NILP (BVAR (current_buffer, enable_multibyte_characters)));
     }
@@ -1234,7 +1246,7 @@ insert_from_buffer_1 (struct buffer *buf,
 
   if (chunk < incoming_nbytes)
     copy_text (BUF_BYTE_ADDRESS (buf, from_byte + chunk),
-	       GPT_ADDR + chunk_expanded, incoming_nbytes - chunk,
+	       dest + chunk_expanded, incoming_nbytes - chunk,
 	       ! NILP (BVAR (buf, enable_multibyte_characters)),
 	       ! NILP (BVAR (current_buffer, enable_multibyte_characters)));
 
@@ -1242,10 +1254,10 @@ insert_from_buffer_1 (struct buffer *buf,
   /* We have copied text into the gap, but we have not altered
      PT or PT_BYTE yet.  So we can pass PT and PT_BYTE
      to these functions and get the same results as we would
-     have got earlier on.  Meanwhile, GPT_ADDR does point to
+     have got earlier on.  Meanwhile, DEST does point to
      the text that has been stored by copy_text.  */
-  if (count_combining_before (GPT_ADDR, outgoing_nbytes, PT, PT_BYTE)
-      || count_combining_after (GPT_ADDR, outgoing_nbytes, PT, PT_BYTE))
+  if (count_combining_before (dest, outgoing_nbytes, PT, PT_BYTE)
+      || count_combining_after (dest, outgoing_nbytes, PT, PT_BYTE))
     emacs_abort ();
 #endif
 
@@ -1253,22 +1265,8 @@ insert_from_buffer_1 (struct buffer *buf,
   modiff_incr (&MODIFF);
   CHARS_MODIFF = MODIFF;
 
-  GAP_SIZE -= outgoing_nbytes;
-  GPT += nchars;
-  ZV += nchars;
-  Z += nchars;
-  GPT_BYTE += outgoing_nbytes;
-  ZV_BYTE += outgoing_nbytes;
-  Z_BYTE += outgoing_nbytes;
-  if (GAP_SIZE > 0) *(GPT_ADDR) = 0; /* Put an anchor.  */
-
-  eassert (GPT <= GPT_BYTE);
-
-  /* The insert may have been in the unchanged region, so check again.  */
-  if (Z - GPT < END_UNCHANGED)
-    END_UNCHANGED = Z - GPT;
+  finish_insertion (nchars, outgoing_nbytes);
 
-  adjust_overlays_for_insert (PT, nchars);
   adjust_markers_for_insert (PT, PT_BYTE, PT + nchars,
 			     PT_BYTE + outgoing_nbytes,
 			     0);
@@ -1333,11 +1331,6 @@ adjust_after_replace (ptrdiff_t from, ptrdiff_t from_byte,
     record_delete (from, prev_text, false);
   record_insert (from, len);
 
-  if (len > nchars_del)
-    adjust_overlays_for_insert (from, len - nchars_del);
-  else if (len < nchars_del)
-    adjust_overlays_for_delete (from, nchars_del - len);
-
   offset_intervals (current_buffer, from, len - nchars_del);
 
   if (from < PT)
@@ -1519,13 +1512,10 @@ replace_range (ptrdiff_t from, ptrdiff_t to, Lisp_Object new,
 	 invalid.  */
       adjust_markers_bytepos (from, from_byte, from + inschars,
 			      from_byte + outgoing_insbytes, 1);
+      adjust_char_index (current_buffer, from, from_byte,
+			 nchars_del, nbytes_del, inschars, outgoing_insbytes);
     }
 
-  /* Adjust the overlay center as needed.  This must be done after
-     adjusting the markers that bound the overlays.  */
-  adjust_overlays_for_delete (from, nchars_del);
-  adjust_overlays_for_insert (from, inschars);
-
   offset_intervals (current_buffer, from, inschars - nchars_del);
 
   /* Get the intervals for the part of the string we are inserting--
@@ -1649,17 +1639,11 @@ replace_range_2 (ptrdiff_t from, ptrdiff_t from_byte,
 	     markers invalid.  */
 	  adjust_markers_bytepos (from, from_byte, from + inschars,
 				  from_byte + insbytes, 1);
+	  adjust_char_index (current_buffer, from, from_byte,
+			     nchars_del, nbytes_del, inschars, insbytes);
 	}
     }
 
-  /* Adjust the overlay center as needed.  This must be done after
-     adjusting the markers that bound the overlays.  */
-  if (nchars_del != inschars)
-    {
-      adjust_overlays_for_insert (from, inschars);
-      adjust_overlays_for_delete (from + inschars, nchars_del);
-    }
-
   offset_intervals (current_buffer, from, inschars - nchars_del);
 
   /* Relocate point as if it were a marker.  */
@@ -1862,10 +1846,6 @@ del_range_2 (ptrdiff_t from, ptrdiff_t from_byte,
 
   offset_intervals (current_buffer, from, - nchars_del);
 
-  /* Adjust the overlay center as needed.  This must be done after
-     adjusting the markers that bound the overlays.  */
-  adjust_overlays_for_delete (from, nchars_del);
-
   GAP_SIZE += nbytes_del;
   ZV_BYTE -= nbytes_del;
   Z_BYTE -= nbytes_del;
@@ -2070,6 +2050,10 @@ invalidate_buffer_caches (struct buffer *buf, ptrdiff_t start, ptrdiff_t end)
     invalidate_region_cache (buf,
                              buf->width_run_cache,
                              start - BUF_BEG (buf), BUF_Z (buf) - end);
+  if (buf->parse_state_cache)
+    invalidate_parse_state_cache (buf, start);
+  if (buf->text->line_index)
+    invalidate_line_index (buf, start, end);
 }
 
 /* These macros work with an argument named `preserve_ptr'
@@ -0,0 +1,948 @@
+/* This file implements an efficient interval data-structure.
+
+Copyright (C) 2020 Free Software Foundation, Inc.
+
+This file is part of GNU Emacs.
+
+GNU Emacs is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or (at
+your option) any later version.
+
+GNU Emacs is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with GNU Emacs.  If not, see <https://www.gnu.org/licenses/>.  */
+
+#include <config.h>
+
+#include "lisp.h"
+#include "itree.h"
+
+/*
+   Intervals of the form [BEGIN, END), are stored as nodes inside a RB
+   tree, ordered by BEGIN.  The core operation of this tree (besides
+   insert, remove, etc.) is finding all intervals intersecting with
+   some given interval.  In order to perform this operation
+   efficiently, every node stores a third value called LIMIT.  (See
+   https://en.wikipedia.org/wiki/Interval_tree#Augmented_tree and its
+   source Introduction to Algorithms, Cormen et al.)
+
+   ==== Finding intervals ====
+
+   If we search for all intervals intersecting with (X, Y], we look
+   at some node and test whether
+
+   NODE.BEGIN > Y
+
+   Due to the invariant of the search tree, we know, that we may
+   safely prune NODE's right subtree if this test succeeds, since all
+   intervals begin strictly after Y.
+
+   But we can not make such an assumptions about the left tree, since
+   all we know is that the intervals in this subtree must start before
+   or at NODE.BEGIN.  So we can't tell, whether they end before X or
+   not.  To solve this problem we add another attribute to each node,
+   called LIMIT.
+
+   The LIMIT of a node is the largest END value occurring in the nodes
+   subtree (including the node itself).  Thus, we may look at the left
+   child of some NODE and test whether
+
+   NODE.left.LIMIT < X
+
+   and this tells us, if all intervals in the left subtree of NODE end
+   before X and if they can be pruned.
+
+   Conversely, if this inequality is false, the left subtree must
+   contain at least one intersecting interval, giving a resulting time
+   complexity of O(K*log(N)) for this operation, where K is the size
+   of the result set and N the size of the tree.
+
+   ==== Adjusting intervals ====
+
+   Since this data-structure will be used for overlays in an Emacs
+   buffer, a second core operation is the ability to insert and delete
+   gaps in the tree.  This models the insertion and deletion of text
+   in a buffer and the effects it may have on the positions of
+   overlays.
+
+   Consider this: Something gets inserted at position P into a buffer
+   and assume that all overlays occur strictly after P.  Ordinarily,
+   we would have to iterate all overlays and increment their BEGIN and
+   END values accordingly (the insertion of text pushes them back).
+   In order to avoid this, we introduce yet another node attribute,
+   called OFFSET.
+
+   The OFFSET of some node gets added to all the BEGIN, END and LIMIT
+   values in the interval tree rooted at this node.  Thus, we can
+   shift all overlays by some amount by only incrementing the OFFSET
+   of the root node by this amount.
+
+   Of course, this OFFSET has to be propagated to the children of a
+   node before its BEGIN, END or LIMIT values may be looked at: this
+   is what itree_inherit_offset does, and every traversal of the tree
+   from its root calls it on the nodes it visits.  Inserting a gap of
+   length L at position P therefore visits only the nodes containing P
+   plus one path of the tree, adding L to the OFFSET of every right
+   subtree which starts after P.
+
+   In order to know when a node's values are up to date without having
+   to look at all of its ancestors, the tree carries a counter OTICK,
+   which is incremented every time offsets are introduced into the
+   tree.  Every node whose own OTICK equals the tree's is known to be
+   clean: neither it nor any of its ancestors have pending offsets.  */
+
+/* +=======================================================================+
+ * | Stack
+ * +=======================================================================+ */
+
+/* A simple stack of nodes, used by the gap functions below.  Small
+   stacks live in the struct itself, so that the common case does not
+   allocate.  */
+
+enum { ITREE_STACK_INITIAL = 64 };
+
+struct itree_stack
+{
+  struct itree_node **nodes;
+  ptrdiff_t size;
+  ptrdiff_t length;
+  struct itree_node *initial[ITREE_STACK_INITIAL];
+};
+
+static void
+itree_stack_init (struct itree_stack *stack)
+{
+  stack->nodes = stack->initial;
+  stack->size = ITREE_STACK_INITIAL;
+  stack->length = 0;
+}
+
+static void
+itree_stack_free (struct itree_stack *stack)
+{
+  if (stack->nodes != stack->initial)
+    xfree (stack->nodes);
+}
+
+static void
+itree_stack_push (struct itree_stack *stack, struct itree_node *node)
+{
+  if (stack->length == stack->size)
+    {
+      if (stack->nodes == stack->initial)
+	{
+	  stack->nodes = xpalloc (NULL, &stack->size, 1, -1,
+				  sizeof *stack->nodes);
+	  memcpy (stack->nodes, stack->initial, sizeof stack->initial);
+	}
+      else
+	stack->nodes = xpalloc (stack->nodes, &stack->size, 1, -1,
+				sizeof *stack->nodes);
+    }
+  stack->nodes[stack->length++] = node;
+}
+
+static struct itree_node *
+itree_stack_pop (struct itree_stack *stack)
+{
+  return stack->length ? stack->nodes[--stack->length] : NULL;
+}
+
+
+/* +=======================================================================+
+ * | Internal Functions
+ * +=======================================================================+ */
+
+/* Push the pending OFFSET of NODE into its BEGIN, END and LIMIT, and
+   down to its children.  This is always correct, whether or not the
+   ancestors of NODE are clean; NODE is marked clean only if its
+   parent is.  */
+
+static void
+itree_inherit_offset (uintmax_t otick, struct itree_node *node)
+{
+  if (node->offset)
+    {
+      node->begin += node->offset;
+      node->end += node->offset;
+      node->limit += node->offset;
+      if (node->left)
+	node->left->offset += node->offset;
+      if (node->right)
+	node->right->offset += node->offset;
+      node->offset = 0;
+    }
+  if (node->parent == NULL || node->parent->otick == otick)
+    node->otick = otick;
+}
+
+/* Return the LIMIT of NODE's subtree as seen from NODE's parent.  */
+
+static ptrdiff_t
+itree_subtree_limit (const struct itree_node *node)
+{
+  return node->limit + node->offset;
+}
+
+/* Recompute the LIMIT of NODE from its END and its children.  */
+
+static void
+itree_update_limit (struct itree_node *node)
+{
+  ptrdiff_t limit = node->end;
+  if (node->left && limit < itree_subtree_limit (node->left))
+    limit = itree_subtree_limit (node->left);
+  if (node->right && limit < itree_subtree_limit (node->right))
+    limit = itree_subtree_limit (node->right);
+  node->limit = limit;
+}
+
+/* Update the LIMIT of NODE and of its ancestors, stopping as soon as a
+   LIMIT does not change.  Use this when only NODE's END or the limit of
+   one of its children changed.  */
+
+static void
+itree_propagate_limit (struct itree_node *node)
+{
+  for (; node; node = node->parent)
+    {
+      ptrdiff_t old = node->limit;
+      itree_update_limit (node);
+      if (node->limit == old)
+	break;
+    }
+}
+
+/* Update the LIMIT of NODE and of all its ancestors.  Use this after
+   structural changes below NODE.  */
+
+static void
+itree_update_limits_to_root (struct itree_node *node)
+{
+  for (; node; node = node->parent)
+    itree_update_limit (node);
+}
+
+/* Make NODE clean, cleaning its ancestors along the way.  */
+
+static void
+itree_validate (struct itree_tree *tree, struct itree_node *node)
+{
+  if (node->otick == tree->otick)
+    return;
+  if (node->parent)
+    itree_validate (tree, node->parent);
+  itree_inherit_offset (tree->otick, node);
+}
+
+/* Replace the subtree rooted at SOURCE by the one rooted at DEST
+   (which may be NULL) in SOURCE's parent.  */
+
+static void
+itree_transplant (struct itree_tree *tree, struct itree_node *dest,
+		  struct itree_node *source)
+{
+  if (source->parent == NULL)
+    tree->root = dest;
+  else if (source == source->parent->left)
+    source->parent->left = dest;
+  else
+    source->parent->right = dest;
+  if (dest)
+    dest->parent = source->parent;
+}
+
+/* Rotate NODE to the left, so that its right child takes its place.  */
+
+static void
+itree_rotate_left (struct itree_tree *tree, struct itree_node *node)
+{
+  struct itree_node *right = node->right;
+  eassert (right);
+
+  /* Offsets must be settled before the parent links change.  */
+  itree_inherit_offset (tree->otick, node);
+  itree_inherit_offset (tree->otick, right);
+
+  node->right = right->left;
+  if (right->left)
+    right->left->parent = node;
+  itree_transplant (tree, right, node);
+  right->left = node;
+  node->parent = right;
+
+  /* Order matters here.  */
+  itree_update_limit (node);
+  itree_update_limit (right);
+}
+
+/* Rotate NODE to the right, so that its left child takes its place.  */
+
+static void
+itree_rotate_right (struct itree_tree *tree, struct itree_node *node)
+{
+  struct itree_node *left = node->left;
+  eassert (left);
+
+  itree_inherit_offset (tree->otick, node);
+  itree_inherit_offset (tree->otick, left);
+
+  node->left = left->right;
+  if (left->right)
+    left->right->parent = node;
+  itree_transplant (tree, left, node);
+  left->right = node;
+  node->parent = left;
+
+  itree_update_limit (node);
+  itree_update_limit (left);
+}
+
+/* Restore the Red-Black invariants after NODE has been inserted.  */
+
+static void
+itree_insert_fix (struct itree_tree *tree, struct itree_node *node)
+{
+  while (node->parent && node->parent->red)
+    {
+      struct itree_node *parent = node->parent;
+      /* The parent is red, so it is not the root and has a parent.  */
+      struct itree_node *grandparent = parent->parent;
+
+      if (parent == grandparent->left)
+	{
+	  struct itree_node *uncle = grandparent->right;
+	  if (uncle && uncle->red)
+	    {
+	      /* Case 1: Recolor and move the problem upwards.  */
+	      parent->red = false;
+	      uncle->red = false;
+	      grandparent->red = true;
+	      node = grandparent;
+	    }
+	  else
+	    {
+	      if (node == parent->right)
+		{
+		  /* Case 2: Turn it into case 3.  */
+		  node = parent;
+		  itree_rotate_left (tree, node);
+		  parent = node->parent;
+		}
+	      /* Case 3: Rotate the grandparent.  */
+	      parent->red = false;
+	      grandparent->red = true;
+	      itree_rotate_right (tree, grandparent);
+	    }
+	}
+      else
+	{
+	  struct itree_node *uncle = grandparent->left;
+	  if (uncle && uncle->red)
+	    {
+	      parent->red = false;
+	      uncle->red = false;
+	      grandparent->red = true;
+	      node = grandparent;
+	    }
+	  else
+	    {
+	      if (node == parent->left)
+		{
+		  node = parent;
+		  itree_rotate_right (tree, node);
+		  parent = node->parent;
+		}
+	      parent->red = false;
+	      grandparent->red = true;
+	      itree_rotate_left (tree, grandparent);
+	    }
+	}
+    }
+  tree->root->red = false;
+}
+
+/* Restore the Red-Black invariants after a black node was removed.
+   NODE, which may be NULL, is the node which took its place and
+   PARENT is NODE's parent.  */
+
+static void
+itree_remove_fix (struct itree_tree *tree, struct itree_node *node,
+		  struct itree_node *parent)
+{
+  while (parent && (node == NULL || !node->red))
+    {
+      if (node == parent->left)
+	{
+	  struct itree_node *other = parent->right;
+
+	  if (other->red)
+	    {
+	      other->red = false;
+	      parent->red = true;
+	      itree_rotate_left (tree, parent);
+	      other = parent->right;
+	    }
+
+	  if ((other->left == NULL || !other->left->red)
+	      && (other->right == NULL || !other->right->red))
+	    {
+	      other->red = true;
+	      node = parent;
+	      parent = node->parent;
+	    }
+	  else
+	    {
+	      if (other->right == NULL || !other->right->red)
+		{
+		  other->left->red = false;
+		  other->red = true;
+		  itree_rotate_right (tree, other);
+		  other = parent->right;
+		}
+	      other->red = parent->red;
+	      parent->red = false;
+	      if (other->right)
+		other->right->red = false;
+	      itree_rotate_left (tree, parent);
+	      node = tree->root;
+	      parent = NULL;
+	    }
+	}
+      else
+	{
+	  struct itree_node *other = parent->left;
+
+	  if (other->red)
+	    {
+	      other->red = false;
+	      parent->red = true;
+	      itree_rotate_right (tree, parent);
+	      other = parent->left;
+	    }
+
+	  if ((other->left == NULL || !other->left->red)
+	      && (other->right == NULL || !other->right->red))
+	    {
+	      other->red = true;
+	      node = parent;
+	      parent = node->parent;
+	    }
+	  else
+	    {
+	      if (other->left == NULL || !other->left->red)
+		{
+		  other->right->red = false;
+		  other->red = true;
+		  itree_rotate_left (tree, other);
+		  other = parent->left;
+		}
+	      other->red = parent->red;
+	      parent->red = false;
+	      if (other->left)
+		other->left->red = false;
+	      itree_rotate_right (tree, parent);
+	      node = tree->root;
+	      parent = NULL;
+	    }
+	}
+    }
+
+  if (node)
+    node->red = false;
+}
+
+/* Insert NODE, whose BEGIN and END are already set, into TREE.  */
+
+static void
+itree_insert_node (struct itree_tree *tree, struct itree_node *node)
+{
+  struct itree_node *parent = NULL;
+  struct itree_node *child = tree->root;
+  uintmax_t otick = tree->otick;
+
+  /* Find the insertion point, cleaning the nodes along the way and
+     accounting for NODE in their LIMIT.  */
+  while (child)
+    {
+      itree_inherit_offset (otick, child);
+      parent = child;
+      if (child->limit < node->end)
+	child->limit = node->end;
+      child = node->begin <= child->begin ? child->left : child->right;
+    }
+
+  node->parent = parent;
+  node->left = NULL;
+  node->right = NULL;
+  node->offset = 0;
+  node->limit = node->end;
+  node->red = true;
+  node->otick = otick;
+
+  if (parent == NULL)
+    tree->root = node;
+  else if (node->begin <= parent->begin)
+    parent->left = node;
+  else
+    parent->right = node;
+
+  tree->size++;
+  itree_insert_fix (tree, node);
+}
+
+/* Return true if NODE intersects the closed range [BEGIN, END].  */
+
+static bool
+itree_node_intersects (const struct itree_node *node,
+		       ptrdiff_t begin, ptrdiff_t end)
+{
+  return node->begin <= end && begin <= node->end;
+}
+
+
+/* +=======================================================================+
+ * | Nodes and trees
+ * +=======================================================================+ */
+
+/* Initialize a freshly allocated NODE, holding DATA.  */
+
+void
+itree_node_init (struct itree_node *node,
+		 bool front_advance, bool rear_advance,
+		 Lisp_Object data)
+{
+  node->parent = NULL;
+  node->left = NULL;
+  node->right = NULL;
+  node->begin = -1;
+  node->end = -1;
+  node->limit = -1;
+  node->offset = 0;
+  node->otick = 0;
+  node->data = data;
+  node->red = false;
+  node->front_advance = front_advance;
+  node->rear_advance = rear_advance;
+}
+
+/* Return NODE's begin value, computing it if necessary.  */
+
+ptrdiff_t
+itree_node_begin (struct itree_tree *tree, struct itree_node *node)
+{
+  itree_validate (tree, node);
+  return node->begin;
+}
+
+/* Return NODE's end value, computing it if necessary.  */
+
+ptrdiff_t
+itree_node_end (struct itree_tree *tree, struct itree_node *node)
+{
+  itree_validate (tree, node);
+  return node->end;
+}
+
+/* Set the BEGIN and END of NODE, which must be in TREE.  */
+
+void
+itree_node_set_region (struct itree_tree *tree, struct itree_node *node,
+		       ptrdiff_t begin, ptrdiff_t end)
+{
+  itree_validate (tree, node);
+  if (begin != node->begin)
+    {
+      itree_remove (tree, node);
+      itree_insert (tree, node, begin, end);
+    }
+  else if (end != node->end)
+    {
+      node->end = max (node->begin, end);
+      itree_propagate_limit (node);
+    }
+}
+
+/* Allocate an empty tree.  */
+
+struct itree_tree *
+itree_create (void)
+{
+  struct itree_tree *tree = xmalloc (sizeof *tree);
+  itree_clear (tree);
+  return tree;
+}
+
+/* Reset TREE to the empty tree.  The nodes it contained are left
+   alone; they remain the caller's responsibility.  */
+
+void
+itree_clear (struct itree_tree *tree)
+{
+  tree->root = NULL;
+  tree->otick = 1;
+  tree->size = 0;
+}
+
+/* Release the memory of TREE, but not that of its nodes.  */
+
+void
+itree_destroy (struct itree_tree *tree)
+{
+  xfree (tree);
+}
+
+/* Return the number of nodes in TREE.  */
+
+intmax_t
+itree_size (struct itree_tree *tree)
+{
+  return tree->size;
+}
+
+/* Insert NODE into TREE, covering BEGIN to END.  */
+
+void
+itree_insert (struct itree_tree *tree, struct itree_node *node,
+	      ptrdiff_t begin, ptrdiff_t end)
+{
+  eassert (node->parent == NULL && node->left == NULL && node->right == NULL);
+  node->begin = begin;
+  node->end = max (begin, end);
+  itree_insert_node (tree, node);
+}
+
+/* Remove NODE from TREE and return it.  NODE must be in TREE.  Its
+   BEGIN and END remain valid afterwards.  */
+
+struct itree_node *
+itree_remove (struct itree_tree *tree, struct itree_node *node)
+{
+  struct itree_node *child, *child_parent;
+  bool removed_black;
+
+  /* Make the path from the root to NODE clean, so that nodes can be
+     moved around it without disturbing pending offsets.  */
+  itree_validate (tree, node);
+
+  if (node->left == NULL || node->right == NULL)
+    {
+      /* NODE has at most one child, which takes its place.  */
+      child = node->left ? node->left : node->right;
+      child_parent = node->parent;
+      removed_black = !node->red;
+      itree_transplant (tree, child, node);
+    }
+  else
+    {
+      /* Replace NODE by its in-order successor, the minimum of its
+	 right subtree, which has no left child.  */
+      struct itree_node *min = node->right;
+      itree_inherit_offset (tree->otick, min);
+      while (min->left)
+	{
+	  min = min->left;
+	  itree_inherit_offset (tree->otick, min);
+	}
+
+      removed_black = !min->red;
+      child = min->right;
+      if (min->parent == node)
+	child_parent = min;
+      else
+	{
+	  child_parent = min->parent;
+	  itree_transplant (tree, child, min);
+	  min->right = node->right;
+	  min->right->parent = min;
+	}
+      itree_transplant (tree, min, node);
+      min->left = node->left;
+      min->left->parent = min;
+      min->red = node->red;
+    }
+
+  itree_update_limits_to_root (child_parent);
+  tree->size--;
+
+  if (removed_black)
+    itree_remove_fix (tree, child, child_parent);
+
+  node->parent = NULL;
+  node->left = NULL;
+  node->right = NULL;
+  node->red = false;
+  node->limit = node->end;
+  eassert (node->offset == 0);
+
+  return node;
+}
+
+
+/* +=======================================================================+
+ * | Insert/Delete Gaps
+ * +=======================================================================+ */
+
+/* Insert a gap at POS of length LENGTH expanding all intervals
+   intersecting it, while respecting their rear_advance and
+   front_advance setting.
+
+   If BEFORE_MARKERS is non-zero, all overlays beginning/ending at POS
+   are treated as if their front_advance/rear_advance was true.  */
+
+void
+itree_insert_gap (struct itree_tree *tree,
+		  ptrdiff_t pos, ptrdiff_t length, bool before_markers)
+{
+  if (!tree || length <= 0 || tree->root == NULL)
+    return;
+
+  /* Nodes with front_advance starting at POS would have to move past
+     nodes which stay put, which could mess up the order of the tree.
+     So remove them first and reinsert them below.  This doesn't apply
+     for BEFORE_MARKERS, since then all positions move identically.  */
+  struct itree_stack saved;
+  itree_stack_init (&saved);
+  struct itree_node *node;
+  if (!before_markers)
+    {
+      ITREE_FOREACH (node, tree, pos, pos, ASCENDING)
+	if (node->begin == pos && node->front_advance
+	    /* If we have front_advance and !rear_advance and the
+	       interval is empty, make sure we don't move begin past
+	       end by pretending it's !front_advance.  */
+	    && (node->begin != node->end || node->rear_advance))
+	  itree_stack_push (&saved, node);
+    }
+  for (ptrdiff_t i = 0; i < saved.length; i++)
+    itree_remove (tree, saved.nodes[i]);
+
+  /* Offsets are about to be introduced in some subtrees.  */
+  tree->otick++;
+
+  if (tree->root)
+    {
+      /* We can't use an iterator here, because we can't effectively
+	 narrow AND shift some subtree at the same time.  */
+      struct itree_stack stack;
+      itree_stack_init (&stack);
+      itree_stack_push (&stack, tree->root);
+      while ((node = itree_stack_pop (&stack)))
+	{
+	  /* Process in pre-order.  */
+	  itree_inherit_offset (tree->otick, node);
+	  if (pos > node->limit)
+	    continue;
+	  if (node->right)
+	    {
+	      if (node->begin > pos)
+		/* All nodes in this subtree are shifted by LENGTH.  */
+		node->right->offset += length;
+	      else
+		itree_stack_push (&stack, node->right);
+	    }
+	  if (node->left)
+	    itree_stack_push (&stack, node->left);
+
+	  if (before_markers
+	      ? node->begin >= pos
+	      : node->begin > pos) /* node->begin == pos => front-advance */
+	    node->begin += length;
+	  if (node->end > pos
+	      || (node->end == pos && (before_markers || node->rear_advance)))
+	    node->end += length;
+	  itree_propagate_limit (node);
+	}
+      itree_stack_free (&stack);
+    }
+
+  /* Reinsert nodes starting at POS having front-advance.  */
+  while ((node = itree_stack_pop (&saved)))
+    {
+      eassert (node->begin == pos);
+      node->begin += length;
+      if (node->end != pos || node->rear_advance)
+	node->end += length;
+      itree_insert_node (tree, node);
+    }
+  itree_stack_free (&saved);
+}
+
+/* Delete a gap at POS of length LENGTH, contracting all intervals
+   intersecting it.  */
+
+void
+itree_delete_gap (struct itree_tree *tree,
+		  ptrdiff_t pos, ptrdiff_t length)
+{
+  if (!tree || length <= 0 || tree->root == NULL)
+    return;
+
+  /* Offsets are about to be introduced in some subtrees.  */
+  tree->otick++;
+
+  /* Can't use the iterator here, because by decrementing begin, we
+     might unintentionally bring shifted nodes back into our search
+     space.  */
+  struct itree_stack stack;
+  struct itree_node *node;
+  itree_stack_init (&stack);
+  itree_stack_push (&stack, tree->root);
+  while ((node = itree_stack_pop (&stack)))
+    {
+      itree_inherit_offset (tree->otick, node);
+      if (pos > node->limit)
+	continue;
+      if (node->right)
+	{
+	  if (node->begin > pos + length)
+	    /* Shift the right subtree to the left.  */
+	    node->right->offset -= length;
+	  else
+	    itree_stack_push (&stack, node->right);
+	}
+      if (node->left)
+	itree_stack_push (&stack, node->left);
+
+      if (pos < node->begin)
+	node->begin = max (pos, node->begin - length);
+      if (node->end > pos)
+	node->end = max (pos, node->end - length);
+      itree_propagate_limit (node);
+    }
+  itree_stack_free (&stack);
+}
+
+
+/* +=======================================================================+
+ * | Iterator
+ * +=======================================================================+ */
+
+/* Return true if the subtree rooted at NODE, a child of a clean node,
+   may contain nodes intersecting the range of ITER.  */
+
+static bool
+itree_iter_subtree_p (const struct itree_iterator *iter,
+		      const struct itree_node *node)
+{
+  return node && iter->begin <= itree_subtree_limit (node);
+}
+
+/* Return the first node in ascending order of the subtree rooted at
+   NODE which may intersect the range of ITER, cleaning nodes on the
+   way down.  */
+
+static struct itree_node *
+itree_iter_leftmost (const struct itree_iterator *iter,
+		     struct itree_node *node)
+{
+  for (;;)
+    {
+      itree_inherit_offset (iter->tree->otick, node);
+      if (!itree_iter_subtree_p (iter, node->left))
+	return node;
+      node = node->left;
+    }
+}
+
+/* Likewise, but for descending order.  */
+
+static struct itree_node *
+itree_iter_rightmost (const struct itree_iterator *iter,
+		      struct itree_node *node)
+{
+  for (;;)
+    {
+      itree_inherit_offset (iter->tree->otick, node);
+      if (node->begin > iter->end
+	  || !itree_iter_subtree_p (iter, node->right))
+	return node;
+      node = node->right;
+    }
+}
+
+/* Return the node following NODE in the order of ITER, skipping
+   subtrees which can't intersect the range of ITER.  NODE is clean,
+   and so is the returned node.  */
+
+static struct itree_node *
+itree_iter_successor (const struct itree_iterator *iter,
+		      struct itree_node *node)
+{
+  if (iter->order == ITREE_ASCENDING)
+    {
+      if (node->begin <= iter->end && itree_iter_subtree_p (iter, node->right))
+	return itree_iter_leftmost (iter, node->right);
+      while (node->parent && node == node->parent->right)
+	node = node->parent;
+    }
+  else
+    {
+      if (itree_iter_subtree_p (iter, node->left))
+	return itree_iter_rightmost (iter, node->left);
+      while (node->parent && node == node->parent->left)
+	node = node->parent;
+    }
+  /* All nodes on the path from the root have been cleaned on the way
+     down.  */
+  return node->parent;
+}
+
+/* Start an iteration over the nodes of TREE intersecting BEGIN to END
+   in ORDER.  TREE may be NULL.  */
+
+struct itree_iterator
+itree_iterator_start (struct itree_tree *tree, ptrdiff_t begin,
+		      ptrdiff_t end, enum itree_order order)
+{
+  struct itree_iterator iter;
+  iter.tree = tree;
+  iter.node = NULL;
+  iter.begin = begin;
+  iter.end = end;
+  iter.otick = tree ? tree->otick : 0;
+  iter.order = order;
+  if (tree && tree->root && itree_iter_subtree_p (&iter, tree->root))
+    iter.node = (order == ITREE_ASCENDING
+		 ? itree_iter_leftmost (&iter, tree->root)
+		 : itree_iter_rightmost (&iter, tree->root));
+  return iter;
+}
+
+/* Return the next node of ITER, or NULL if there are no more.  The
+   returned node is clean.  */
+
+struct itree_node *
+itree_iterator_next (struct itree_iterator *iter)
+{
+  struct itree_node *node = iter->node;
+
+  /* The tree must not be shifted while we iterate over it.  */
+  eassert (!iter->tree || iter->otick == iter->tree->otick);
+
+  while (node)
+    {
+      /* In ascending order, all remaining nodes start after this
+	 one.  */
+      if (iter->order == ITREE_ASCENDING && node->begin > iter->end)
+	{
+	  node = NULL;
+	  break;
+	}
+      struct itree_node *next = itree_iter_successor (iter, node);
+      if (itree_node_intersects (node, iter->begin, iter->end))
+	{
+	  iter->node = next;
+	  return node;
+	}
+      node = next;
+    }
+
+  iter->node = NULL;
+  return NULL;
+}
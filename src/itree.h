@@ -0,0 +1,164 @@
+/* This file implements an efficient interval data-structure.
+
+Copyright (C) 2020 Free Software Foundation, Inc.
+
+This file is part of GNU Emacs.
+
+GNU Emacs is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or (at
+your option) any later version.
+
+GNU Emacs is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with GNU Emacs.  If not, see <https://www.gnu.org/licenses/>.  */
+
+#ifndef ITREE_H
+#define ITREE_H
+
+#include <stddef.h>
+#include <inttypes.h>
+
+#include "lisp.h"
+
+/* The tree and node structs are mainly here, so they can be
+   allocated.
+
+   NOTE: The only time where it is safe to modify node.begin and
+   node.end directly, is while the node is not part of any tree.
+
+   NOTE: It is safe to read node.begin and node.end directly, if the
+   node came from an iterator, because it validates the nodes it
+   returns as a side-effect.  See ITREE_FOREACH.  */
+
+struct itree_node
+{
+  /* The normal parent, left and right links found in binary trees.
+     See also `red`, below, which completes the Red-Black tree
+     representation.  */
+  struct itree_node *parent;
+  struct itree_node *left;
+  struct itree_node *right;
+
+  /* The following five fields comprise the interval abstraction.
+
+     BEGIN, END are buffer positions describing the range.  When a
+     node is in a tree these fields are read only, written only by
+     itree functions.
+
+     The LIMIT, OFFSET and OTICK fields should be considered internal
+     to itree.c and used only by itree functions.
+
+     LIMIT is a buffer position, the maximum of END of this node and
+     its children.  It lets searches skip whole subtrees which end
+     before the region of interest.
+
+     OFFSET is an amount, in buffer position units, by which BEGIN,
+     END and LIMIT of this node and of all its descendants still have
+     to be shifted.  Shifting a whole subtree thus costs O(1); the
+     offset is pushed down lazily as the tree is traversed.
+
+     OTICK tells whether the node is clean.  A node is clean when its
+     OTICK is equal to the OTICK of its tree (see struct itree_tree):
+     then its OFFSET and those of all its ancestors are zero, so that
+     BEGIN, END and LIMIT are correct buffer positions.  Otherwise
+     they require adjustment before use.
+
+     NOTE: The interval iterators ensure nodes are clean before
+     yielding them, so BEGIN and END may be safely used as buffer
+     positions then.  */
+
+  ptrdiff_t begin;		/* The beginning of this interval.  */
+  ptrdiff_t end;		/* The end of the interval.  */
+  ptrdiff_t limit;		/* The maximum end in this subtree.  */
+  ptrdiff_t offset;		/* The amount of shift to apply to this subtree.  */
+  uintmax_t otick;		/* offset modified tick */
+  Lisp_Object data;		/* Exclusively used by the client.  */
+  bool_bf red : 1;
+  bool_bf rear_advance : 1;	/* Same as for marker and overlays.  */
+  bool_bf front_advance : 1;	/* Same as for marker and overlays.  */
+};
+
+struct itree_tree
+{
+  struct itree_node *root;
+  uintmax_t otick;		/* offset tick, compared with node's otick.  */
+  intmax_t size;		/* Number of nodes in the tree.  */
+};
+
+enum itree_order
+  {
+    ITREE_ASCENDING,
+    ITREE_DESCENDING,
+  };
+
+extern void itree_node_init (struct itree_node *, bool, bool, Lisp_Object);
+extern ptrdiff_t itree_node_begin (struct itree_tree *, struct itree_node *);
+extern ptrdiff_t itree_node_end (struct itree_tree *, struct itree_node *);
+extern void itree_node_set_region (struct itree_tree *, struct itree_node *,
+				   ptrdiff_t, ptrdiff_t);
+extern struct itree_tree *itree_create (void);
+extern void itree_destroy (struct itree_tree *);
+extern intmax_t itree_size (struct itree_tree *);
+extern void itree_clear (struct itree_tree *);
+extern void itree_insert (struct itree_tree *, struct itree_node *,
+			  ptrdiff_t, ptrdiff_t);
+extern struct itree_node *itree_remove (struct itree_tree *,
+					struct itree_node *);
+extern void itree_insert_gap (struct itree_tree *, ptrdiff_t, ptrdiff_t, bool);
+extern void itree_delete_gap (struct itree_tree *, ptrdiff_t, ptrdiff_t);
+
+/* State of an iteration over the nodes of a tree intersecting a
+   range.  The iterator is a plain value living on the C stack, so
+   iterations may be nested and abandoned at any time.  */
+struct itree_iterator
+{
+  /* The tree being iterated over.  */
+  struct itree_tree *tree;
+  /* The next node to be considered, or NULL once the iteration is
+     exhausted.  */
+  struct itree_node *node;
+  /* The range of interest; only nodes with NODE->begin <= END and
+     NODE->end >= BEGIN are returned.  The range may be narrowed while
+     iterating, but never widened.  */
+  ptrdiff_t begin;
+  ptrdiff_t end;
+  /* A copy of the tree's `otick`, to catch modifications.  */
+  uintmax_t otick;
+  enum itree_order order;
+};
+
+extern struct itree_iterator itree_iterator_start (struct itree_tree *,
+						   ptrdiff_t, ptrdiff_t,
+						   enum itree_order);
+extern struct itree_node *itree_iterator_next (struct itree_iterator *);
+
+/* Iterate over the intervals between BEG and END in the tree T.
+   N will hold successive nodes.  ORDER can be one of : `ASCENDING` or
+   `DESCENDING`.
+
+   Intervals touching the range, that is those which end at BEG or
+   start at END, are included; callers filter them as they see fit.
+
+   The tree must not be modified during the iteration, except that
+   the region of interest may be narrowed with ITREE_FOREACH_NARROW.
+   It is fine to exit the loop early via `break` or `return`.
+
+   BEWARE:
+   - The expression T may be evaluated more than once, so make sure
+     it is cheap and pure.
+   - If you need to modify the tree, collect the nodes first and act
+     on them after the loop.  */
+#define ITREE_FOREACH(n, t, beg, end, order)				\
+  for (struct itree_iterator itree_iter_				\
+	 = itree_iterator_start (t, beg, end, ITREE_##order);		\
+       ((n) = itree_iterator_next (&itree_iter_)) != NULL;)
+
+#define ITREE_FOREACH_NARROW(beg_, end_)				\
+  (itree_iter_.begin = (beg_), itree_iter_.end = (end_))
+
+#endif
@@ -1291,6 +1291,10 @@ command_loop_1 (void)
       while (pending_malloc_warning)
 	display_malloc_warning ();
 
+      /* Notice files that other programs changed while their text
+	 was mapped into buffers.  */
+      check_mapped_files ();
+
       Vdeactivate_mark = Qnil;
 
       /* Don't ignore mouse movements for more than a single command
@@ -1647,8 +1651,8 @@ adjust_point_for_property (ptrdiff_t last_pt, bool modified)
 	  && display_prop_intangible_p (val, overlay, PT, PT_BYTE)
 	  && (!OVERLAYP (overlay)
 	      ? get_property_and_range (PT, Qdisplay, &val, &beg, &end, Qnil)
-	      : (beg = OVERLAY_POSITION (OVERLAY_START (overlay)),
-		 end = OVERLAY_POSITION (OVERLAY_END (overlay))))
+	      : (beg = OVERLAY_START (overlay),
+		 end = OVERLAY_END (overlay)))
 	  && (beg < PT /* && end > PT   <- It's always the case.  */
 	      || (beg <= PT && STRINGP (val) && SCHARS (val) == 0)))
 	{
@@ -0,0 +1,441 @@
+/* An index of the newlines in a buffer's text.
+
+Copyright (C) 2020 Free Software Foundation, Inc.
+
+This file is part of GNU Emacs.
+
+GNU Emacs is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or (at
+your option) any later version.
+
+GNU Emacs is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with GNU Emacs.  If not, see <https://www.gnu.org/licenses/>.  */
+
+
+#include <config.h>
+
+#include "lisp.h"
+#include "buffer.h"
+
+/* The line index.
+
+   The newline cache (see region-cache.c) only remembers which parts
+   of the buffer are known to hold no newlines, so counting the lines
+   between two far-apart positions still means looking at every
+   newline in between.  The line index instead records how many
+   newlines there are in each chunk of the buffer text, so that the
+   number of the line holding a position, or the position where a
+   given line starts, can be found without scanning more than a chunk
+   of text.
+
+   The buffer text is split into chunks of roughly LINE_INDEX_CHUNK
+   bytes.  The byte size and the newline count of every chunk are
+   kept in an array, and also summed up in a pair of binary indexed
+   (Fenwick) trees.  A Fenwick tree is a complete binary tree stored
+   in an array in which every node holds the sum of the chunks below
+   it, so finding the chunk that holds a byte position or a newline,
+   and the totals before it, takes a logarithmic number of steps.
+
+   Since newlines are single bytes that never occur inside the byte
+   sequence of a multibyte character, the index works with byte
+   positions, and needs no changes when chunk boundaries fall in the
+   middle of a character.
+
+   The index is kept up to date in the same way as the region caches:
+   invalidate_line_index is called (from invalidate_buffer_caches)
+   before every change to the buffer text, and only records the
+   extent of the text that may have changed, as the number of
+   characters left untouched at the start and at the end of the
+   buffer.  The next time the index is consulted, the chunks covering
+   the changed text are counted again, and the chunks after it are
+   moved to their new place.  This keeps the cost of a change
+   independent of the size of the buffer, and a burst of changes in
+   one spot costs only one recount.  */
+
+/* The size in bytes of the chunks the index is built from.  A chunk
+   that grows to more than LINE_INDEX_CHUNK_MAX bytes is split when it
+   is next counted.  */
+enum { LINE_INDEX_CHUNK = 16 * 1024,
+       LINE_INDEX_CHUNK_MAX = 4 * LINE_INDEX_CHUNK };
+
+/* Buffers smaller than this many bytes are not indexed: scanning
+   them is as fast as maintaining an index would be.  */
+enum { LINE_INDEX_MIN_SIZE = 4 * LINE_INDEX_CHUNK };
+
+struct line_index
+{
+  /* The number of chunks, and the number of slots allocated for them
+     in the arrays below.  */
+  ptrdiff_t nchunks, size;
+
+  /* The size in bytes and the number of newlines of each chunk.  */
+  ptrdiff_t *bytes, *lines;
+
+  /* Fenwick trees over BYTES and LINES.  Element I (counting from 1)
+     holds the sum of the chunks from I - (I & -I) to I - 1.  */
+  ptrdiff_t *byte_tree, *line_tree;
+
+  /* The size in bytes of the text the chunks describe.  */
+  ptrdiff_t total_bytes;
+
+  /* True if the buffer text may have changed since the index was
+     last brought up to date.  The changed text starts no earlier than
+     BEG_UNCHANGED characters after the start of the buffer, and ends
+     no later than END_UNCHANGED characters before the end of the
+     buffer; as in region-cache.c.  */
+  bool modified;
+  ptrdiff_t beg_unchanged, end_unchanged;
+};
+
+
+/* Fenwick trees.  These are also used by the index of character
+   positions in marker.c.  */
+
+/* Set TREE to the Fenwick tree for the N values in VALUES.  */
+void
+fenwick_build (ptrdiff_t *tree, ptrdiff_t const *values, ptrdiff_t n)
+{
+  for (ptrdiff_t i = 1; i <= n; i++)
+    tree[i] = values[i - 1];
+  for (ptrdiff_t i = 1; i <= n; i++)
+    {
+      ptrdiff_t parent = i + (i & -i);
+      if (parent <= n)
+	tree[parent] += tree[i];
+    }
+}
+
+/* Add DELTA to value I (counting from 0) of the N values in TREE.  */
+void
+fenwick_add (ptrdiff_t *tree, ptrdiff_t n, ptrdiff_t i, ptrdiff_t delta)
+{
+  for (i++; i <= n; i += i & -i)
+    tree[i] += delta;
+}
+
+/* Return the sum of the first I values in TREE.  */
+ptrdiff_t
+fenwick_sum (ptrdiff_t const *tree, ptrdiff_t i)
+{
+  ptrdiff_t sum = 0;
+  for (; i > 0; i -= i & -i)
+    sum += tree[i];
+  return sum;
+}
+
+/* Return the largest I such that the sum of the first I of the N
+   values in TREE is at most TARGET, and store that sum in *SUM.  All
+   values must be nonnegative.  */
+ptrdiff_t
+fenwick_search (ptrdiff_t const *tree, ptrdiff_t n, ptrdiff_t target,
+		ptrdiff_t *sum)
+{
+  ptrdiff_t i = 0, step = 1, total = 0;
+
+  while (step <= n / 2)
+    step *= 2;
+  for (; step > 0; step /= 2)
+    if (i + step <= n && total + tree[i + step] <= target)
+      {
+	i += step;
+	total += tree[i];
+      }
+  *sum = total;
+  return i;
+}
+
+
+/* Scanning the text.  */
+
+/* Return the number of newlines in the current buffer between byte
+   positions FROM and TO.  */
+static ptrdiff_t
+count_newlines_between (ptrdiff_t from, ptrdiff_t to)
+{
+  ptrdiff_t n = 0;
+
+  if (from < GPT_BYTE && GPT_BYTE < to)
+    {
+      n = count_newlines (BYTE_POS_ADDR (from), GPT_BYTE - from);
+      from = GPT_BYTE;
+    }
+  return n + count_newlines (BYTE_POS_ADDR (from), to - from);
+}
+
+/* Return the byte position just after the Nth newline after byte
+   position FROM in the current buffer.  There must be at least N
+   newlines after FROM.  */
+static ptrdiff_t
+find_nth_newline (ptrdiff_t from, ptrdiff_t n)
+{
+  eassert (n > 0);
+  while (true)
+    {
+      ptrdiff_t ceiling = BUFFER_CEILING_OF (from) + 1;
+      unsigned char *base = BYTE_POS_ADDR (from);
+      unsigned char *p = base, *lim = base + (ceiling - from);
+
+      while ((p = memchr (p, '\n', lim - p)))
+	{
+	  p++;
+	  if (--n == 0)
+	    return from + (p - base);
+	}
+      eassert (ceiling < Z_BYTE);
+      from = ceiling;
+    }
+}
+
+
+/* Maintaining the index.  */
+
+/* Replace the NOLD chunks of LI starting with chunk FIRST by chunks
+   describing the LENGTH bytes of the current buffer starting at byte
+   offset START from the beginning of the buffer, and bring the
+   Fenwick trees up to date.  */
+static void
+replace_chunks (struct line_index *li, ptrdiff_t first, ptrdiff_t nold,
+		ptrdiff_t start, ptrdiff_t length)
+{
+  ptrdiff_t nnew = (length <= (nold == 1 ? LINE_INDEX_CHUNK_MAX
+			       : LINE_INDEX_CHUNK)
+		    ? 1 : (length + LINE_INDEX_CHUNK - 1) / LINE_INDEX_CHUNK);
+  bool in_place = nnew == nold;
+
+  if (!in_place)
+    {
+      ptrdiff_t nchunks = li->nchunks - nold + nnew;
+      if (li->size < nchunks)
+	{
+	  ptrdiff_t size = li->size;
+	  li->bytes = xpalloc (li->bytes, &size, nchunks - li->size, -1,
+			       sizeof *li->bytes);
+	  li->lines = xnrealloc (li->lines, size, sizeof *li->lines);
+	  li->byte_tree = xnrealloc (li->byte_tree, size + 1,
+				     sizeof *li->byte_tree);
+	  li->line_tree = xnrealloc (li->line_tree, size + 1,
+				     sizeof *li->line_tree);
+	  li->size = size;
+	}
+      ptrdiff_t tail = li->nchunks - (first + nold);
+      memmove (li->bytes + first + nnew, li->bytes + first + nold,
+	       tail * sizeof *li->bytes);
+      memmove (li->lines + first + nnew, li->lines + first + nold,
+	       tail * sizeof *li->lines);
+      li->nchunks = nchunks;
+    }
+
+  ptrdiff_t from = BEG_BYTE + start;
+  for (ptrdiff_t i = 0; i < nnew; i++)
+    {
+      ptrdiff_t to = BEG_BYTE + start + length * (i + 1) / nnew;
+      ptrdiff_t bytes = to - from;
+      ptrdiff_t lines = count_newlines_between (from, to);
+      if (in_place)
+	{
+	  fenwick_add (li->byte_tree, li->nchunks, first + i,
+		       bytes - li->bytes[first + i]);
+	  fenwick_add (li->line_tree, li->nchunks, first + i,
+		       lines - li->lines[first + i]);
+	}
+      li->bytes[first + i] = bytes;
+      li->lines[first + i] = lines;
+      from = to;
+    }
+
+  if (!in_place)
+    {
+      fenwick_build (li->byte_tree, li->bytes, li->nchunks);
+      fenwick_build (li->line_tree, li->lines, li->nchunks);
+    }
+}
+
+/* Describe the whole text of the current buffer in LI.  */
+static void
+rebuild_line_index (struct line_index *li)
+{
+  li->nchunks = 0;
+  li->total_bytes = Z_BYTE - BEG_BYTE;
+  li->modified = false;
+  replace_chunks (li, 0, 0, 0, li->total_bytes);
+}
+
+/* Bring LI, the line index of the current buffer, up to date with the
+   changes recorded by invalidate_line_index.  */
+static void
+revalidate_line_index (struct line_index *li)
+{
+  ptrdiff_t total = Z_BYTE - BEG_BYTE;
+
+  if (!li->modified)
+    {
+      /* The text should not have changed size without
+	 invalidate_line_index being told about it, but a full rebuild
+	 is cheap insurance.  */
+      if (li->total_bytes != total)
+	rebuild_line_index (li);
+      return;
+    }
+
+  /* The unchanged text at both ends, in bytes.  */
+  ptrdiff_t beg_unchanged = min (li->beg_unchanged, Z - BEG);
+  ptrdiff_t end_unchanged = min (li->end_unchanged, Z - BEG - beg_unchanged);
+  ptrdiff_t head = CHAR_TO_BYTE (BEG + beg_unchanged) - BEG_BYTE;
+  ptrdiff_t tail = Z_BYTE - CHAR_TO_BYTE (Z - end_unchanged);
+
+  if (head + tail > li->total_bytes)
+    {
+      rebuild_line_index (li);
+      return;
+    }
+
+  /* Find the chunks that overlap the changed text, in the old
+     layout.  */
+  ptrdiff_t first_start, last_start;
+  ptrdiff_t first = fenwick_search (li->byte_tree, li->nchunks, head,
+				    &first_start);
+  if (first == li->nchunks)
+    {
+      first--;
+      first_start -= li->bytes[first];
+    }
+  ptrdiff_t end = li->total_bytes - tail;
+  ptrdiff_t last = first;
+  if (end > first_start + li->bytes[first])
+    {
+      last = fenwick_search (li->byte_tree, li->nchunks, end - 1,
+			     &last_start);
+      eassert (first < last && last < li->nchunks);
+    }
+  else
+    last_start = first_start;
+  ptrdiff_t after = li->total_bytes - (last_start + li->bytes[last]);
+
+  li->total_bytes = total;
+  li->modified = false;
+  replace_chunks (li, first, last - first + 1, first_start,
+		  total - after - first_start);
+}
+
+/* Return the line index of the current buffer, brought up to date,
+   or NULL if the current buffer should not be indexed.  An index is
+   made when the buffer is large enough and `cache-long-scans' is
+   non-nil.  */
+struct line_index *
+buffer_line_index (void)
+{
+  struct buffer_text *text = current_buffer->text;
+
+  if (NILP (BVAR (current_buffer, cache_long_scans)))
+    return NULL;
+  if (!text->line_index)
+    {
+      if (Z_BYTE - BEG_BYTE < LINE_INDEX_MIN_SIZE)
+	return NULL;
+      text->line_index = xzalloc (sizeof *text->line_index);
+      rebuild_line_index (text->line_index);
+    }
+  else
+    revalidate_line_index (text->line_index);
+  return text->line_index;
+}
+
+/* Note that the text of BUF between character positions START and
+   END is about to change.  */
+void
+invalidate_line_index (struct buffer *buf, ptrdiff_t start, ptrdiff_t end)
+{
+  struct line_index *li = buf->text->line_index;
+  ptrdiff_t head = start - BUF_BEG (buf), tail = BUF_Z (buf) - end;
+
+  if (!li->modified)
+    {
+      li->modified = true;
+      li->beg_unchanged = head;
+      li->end_unchanged = tail;
+    }
+  else
+    {
+      li->beg_unchanged = min (li->beg_unchanged, head);
+      li->end_unchanged = min (li->end_unchanged, tail);
+    }
+}
+
+void
+free_line_index (struct line_index *li)
+{
+  xfree (li->bytes);
+  xfree (li->lines);
+  xfree (li->byte_tree);
+  xfree (li->line_tree);
+  xfree (li);
+}
+
+
+/* Using the index.  */
+
+/* Return the number of newlines before byte position POS of the
+   current buffer, whose line index is LI.  */
+ptrdiff_t
+line_index_count (struct line_index *li, ptrdiff_t pos)
+{
+  ptrdiff_t start;
+  ptrdiff_t i = fenwick_search (li->byte_tree, li->nchunks, pos - BEG_BYTE,
+				&start);
+  if (i == li->nchunks)
+    return fenwick_sum (li->line_tree, i);
+  return (fenwick_sum (li->line_tree, i)
+	  + count_newlines_between (BEG_BYTE + start, pos));
+}
+
+/* Return the byte position just after the Nth newline of the current
+   buffer, whose line index is LI.  N must be positive, and no more
+   than the number of newlines in the buffer.  */
+ptrdiff_t
+line_index_find (struct line_index *li, ptrdiff_t n)
+{
+  ptrdiff_t lines;
+  ptrdiff_t i = fenwick_search (li->line_tree, li->nchunks, n - 1, &lines);
+  eassert (i < li->nchunks);
+  return find_nth_newline (BEG_BYTE + fenwick_sum (li->byte_tree, i),
+			   n - lines);
+}
+
+
+DEFUN ("buffer-line-count", Fbuffer_line_count, Sbuffer_line_count, 0, 1, 0,
+       doc: /* Return the number of lines in BUFFER.
+BUFFER defaults to the current buffer.
+This is the number of newlines in the text of BUFFER, plus one if the
+text does not end in a newline, and counts the whole text regardless
+of any narrowing in effect.  In large buffers whose `cache-long-scans'
+is non-nil, the count is kept in an index that is updated as the text
+changes, so calling this repeatedly is cheap.  */)
+  (Lisp_Object buffer)
+{
+  struct buffer *b = decode_buffer (buffer);
+  struct buffer *old = current_buffer;
+  ptrdiff_t lines;
+
+  if (!BUFFER_LIVE_P (b))
+    return make_fixnum (0);
+  set_buffer_internal (b);
+  struct line_index *li = buffer_line_index ();
+  lines = (li ? line_index_count (li, Z_BYTE)
+	   : count_newlines_between (BEG_BYTE, Z_BYTE));
+  if (Z > BEG && FETCH_BYTE (Z_BYTE - 1) != '\n')
+    lines++;
+  set_buffer_internal (old);
+  return make_fixnum (lines);
+}
+
+void
+syms_of_line_index (void)
+{
+  defsubr (&Sbuffer_line_count);
+}
@@ -2433,13 +2433,13 @@ SXHASH_REDUCE (EMACS_UINT x)
   union vectorlike_header header;
 
   /* This is the buffer that the marker points into, or 0 if it points nowhere.
-     Note: a chain of markers can contain markers pointing into different
-     buffers (the chain is per buffer_text rather than per buffer, so it's
+     Note: a tree of markers can contain markers pointing into different
+     buffers (the tree is per buffer_text rather than per buffer, so it's
      shared between indirect buffers).  */
   /* This is used for (other than NULL-checking):
      - Fmarker_buffer
      - Fset_marker: check eq(oldbuf, newbuf) to avoid unchain+rechain.
-     - unchain_marker: to find the list from which to unchain.
+     - unchain_marker: to find the tree from which to unchain.
      - Fkill_buffer: to only unchain the markers of current indirect buffer.
      */
   struct buffer *buffer;
@@ -2455,13 +2455,12 @@ SXHASH_REDUCE (EMACS_UINT x)
   /* The remaining fields are meaningless in a marker that
      does not point anywhere.  */
 
-  /* For markers that point somewhere,
-     this is used to chain of all the markers in a given buffer.
-     The chain does not preserve markers from garbage collection;
-     instead, markers are removed from the chain when freed by GC.  */
-  /* We could remove it and use an array in buffer_text instead.
-     That would also allow us to preserve it ordered.  */
-  struct Lisp_Marker *next;
+  /* For markers that point somewhere, these link the marker into the
+     tree of all the markers of its buffer text, which is a binary
+     search tree ordered by position; see marker.c.  The tree does not
+     preserve markers from garbage collection; instead, markers are
+     removed from the tree when freed by GC.  */
+  struct Lisp_Marker *parent, *left, *right;
   /* This is the char position where the marker points.  */
   ptrdiff_t charpos;
   /* This is the byte position.
@@ -2469,6 +2468,14 @@ SXHASH_REDUCE (EMACS_UINT x)
      used to implement the functionality of markers, but rather to (ab)use
      markers as a cache for char<->byte mappings).  */
   ptrdiff_t bytepos;
+  /* The amounts still to be added to CHARPOS and BYTEPOS, and to the
+     positions of all the markers below this one in the tree.  */
+  ptrdiff_t offset, offset_byte;
+  /* Equal to the 'markers_otick' of the buffer text if neither this
+     marker nor its ancestors have pending offsets, so that CHARPOS and
+     BYTEPOS can be used directly.  Use marker_charpos and
+     marker_bytepos from buffer.h to read them otherwise.  */
+  uintmax_t otick;
 } GCALIGNED_STRUCT;
 
 /* START and END are markers in the overlay's buffer, and
@@ -2476,21 +2483,17 @@ SXHASH_REDUCE (EMACS_UINT x)
 struct Lisp_Overlay
 /* An overlay's real data content is:
    - plist
-   - buffer (really there are two buffer pointers, one per marker,
-     and both points to the same buffer)
-   - insertion type of both ends (per-marker fields)
-   - start & start byte (of start marker)
-   - end & end byte (of end marker)
-   - next (singly linked list of overlays)
-   - next fields of start and end markers (singly linked list of markers).
-   I.e. 9words plus 2 bits, 3words of which are for external linked lists.
-*/
+   - buffer
+   - itree node
+   - start & end (in the itree node)
+   - insertion type of both ends (in the itree node).
+   The node is allocated with xmalloc, and lives in the interval tree
+   of the buffer while the overlay is not deleted.  */
   {
     union vectorlike_header header;
-    Lisp_Object start;
-    Lisp_Object end;
     Lisp_Object plist;
-    struct Lisp_Overlay *next;
+    struct buffer *buffer;	/* NULL if the overlay was deleted.  */
+    struct itree_node *interval;
   } GCALIGNED_STRUCT;
 
 struct Lisp_Misc_Ptr
@@ -3589,8 +3592,12 @@ #define CONS_TO_INTEGER(cons, type, var)				\
 struct charset;
 
 /* Defined in syntax.c.  */
+struct parse_state_cache;
 extern void init_syntax_once (void);
 extern void syms_of_syntax (void);
+extern void invalidate_parse_state_cache (struct buffer *, ptrdiff_t);
+extern void free_parse_state_cache (struct parse_state_cache *);
+extern void mark_parse_state_cache (struct parse_state_cache *);
 
 /* Defined in fns.c.  */
 enum { NEXT_ALMOST_PRIME_LIMIT = 11 };
@@ -3988,7 +3995,7 @@ #define ALLOCATE_ZEROED_PSEUDOVECTOR(type, field, tag)		       \
 extern Lisp_Object make_float (double);
 extern void display_malloc_warning (void);
 extern ptrdiff_t inhibit_garbage_collection (void);
-extern Lisp_Object build_overlay (Lisp_Object, Lisp_Object, Lisp_Object);
+extern Lisp_Object build_overlay (bool, bool, Lisp_Object);
 extern void free_cons (struct Lisp_Cons *);
 extern void init_alloc_once (void);
 extern void init_alloc (void);
@@ -4056,6 +4063,22 @@ #define FLOAT_TO_STRING_BUFSIZE 350
 			    char const *, va_list)
   ATTRIBUTE_FORMAT_PRINTF (5, 0);
 
+/* Defined in line-index.c.  */
+/* Scans for fewer newlines than this do not use the line index.  */
+enum { LINE_INDEX_MIN_LINES = 256 };
+struct line_index;
+extern struct line_index *buffer_line_index (void);
+extern void invalidate_line_index (struct buffer *, ptrdiff_t, ptrdiff_t);
+extern void free_line_index (struct line_index *);
+extern ptrdiff_t line_index_count (struct line_index *, ptrdiff_t);
+extern ptrdiff_t line_index_find (struct line_index *, ptrdiff_t);
+extern void fenwick_build (ptrdiff_t *, ptrdiff_t const *, ptrdiff_t);
+extern void fenwick_add (ptrdiff_t *, ptrdiff_t, ptrdiff_t, ptrdiff_t);
+extern ptrdiff_t fenwick_sum (ptrdiff_t const *, ptrdiff_t);
+extern ptrdiff_t fenwick_search (ptrdiff_t const *, ptrdiff_t, ptrdiff_t,
+				 ptrdiff_t *);
+extern void syms_of_line_index (void);
+
 /* Defined in lread.c.  */
 extern Lisp_Object check_obarray (Lisp_Object);
 extern Lisp_Object intern_1 (const char *, ptrdiff_t);
@@ -4250,9 +4273,8 @@ XMODULE_FUNCTION (Lisp_Object o)
 extern bool mouse_face_overlay_overlaps (Lisp_Object);
 extern Lisp_Object disable_line_numbers_overlay_at_eob (void);
 extern AVOID nsberror (Lisp_Object);
-extern void adjust_overlays_for_insert (ptrdiff_t, ptrdiff_t);
+extern void adjust_overlays_for_insert (ptrdiff_t, ptrdiff_t, bool);
 extern void adjust_overlays_for_delete (ptrdiff_t, ptrdiff_t);
-extern void fix_start_end_in_overlays (ptrdiff_t, ptrdiff_t);
 extern void report_overlay_modification (Lisp_Object, Lisp_Object, bool,
                                          Lisp_Object, Lisp_Object, Lisp_Object);
 extern bool overlay_touches_p (ptrdiff_t);
@@ -4268,10 +4290,24 @@ XMODULE_FUNCTION (Lisp_Object o)
 extern ptrdiff_t marker_position (Lisp_Object);
 extern ptrdiff_t marker_byte_position (Lisp_Object);
 extern void clear_charpos_cache (struct buffer *);
+extern void adjust_char_index (struct buffer *, ptrdiff_t, ptrdiff_t,
+			       ptrdiff_t, ptrdiff_t, ptrdiff_t, ptrdiff_t);
+extern void clear_char_index (struct buffer *);
 extern ptrdiff_t buf_charpos_to_bytepos (struct buffer *, ptrdiff_t);
 extern ptrdiff_t buf_bytepos_to_charpos (struct buffer *, ptrdiff_t);
 extern void detach_marker (Lisp_Object);
 extern void unchain_marker (struct Lisp_Marker *);
+extern void attach_marker (struct Lisp_Marker *, struct buffer *,
+			   ptrdiff_t, ptrdiff_t);
+extern void validate_marker (struct Lisp_Marker *);
+extern struct Lisp_Marker *marker_tree_first (struct buffer *, ptrdiff_t);
+extern struct Lisp_Marker *marker_tree_next (struct buffer *,
+					     struct Lisp_Marker *);
+extern void marker_tree_insert_gap (struct buffer *, ptrdiff_t, ptrdiff_t,
+				    ptrdiff_t, ptrdiff_t, bool);
+extern void marker_tree_replace (struct buffer *, ptrdiff_t, ptrdiff_t,
+				 ptrdiff_t, ptrdiff_t, ptrdiff_t);
+extern void prune_markers (struct buffer *);
 extern Lisp_Object set_marker_restricted (Lisp_Object, Lisp_Object, Lisp_Object);
 extern Lisp_Object set_marker_both (Lisp_Object, Lisp_Object, ptrdiff_t, ptrdiff_t);
 extern Lisp_Object set_marker_restricted_both (Lisp_Object, Lisp_Object,
@@ -4306,6 +4342,7 @@ XMODULE_FUNCTION (Lisp_Object o)
 
 /* Defined in search.c.  */
 extern void shrink_regexp_cache (void);
+extern void mark_regexp_cache (void);
 extern void restore_search_regs (void);
 extern void update_search_regs (ptrdiff_t oldstart,
                                 ptrdiff_t oldend, ptrdiff_t newend);
@@ -4329,6 +4366,10 @@ fast_string_match_ignore_case (Lisp_Object regexp, Lisp_Object string)
 						  ptrdiff_t);
 extern ptrdiff_t fast_looking_at (Lisp_Object, ptrdiff_t, ptrdiff_t,
                                   ptrdiff_t, ptrdiff_t, Lisp_Object);
+/* The size of the blocks of text passed to count_newlines when
+   skipping over text.  */
+enum { NEWLINE_COUNT_BLOCK = 16 * 1024 };
+extern ptrdiff_t count_newlines (unsigned char const *, ptrdiff_t);
 extern ptrdiff_t find_newline (ptrdiff_t, ptrdiff_t, ptrdiff_t, ptrdiff_t,
 			       ptrdiff_t, ptrdiff_t *, ptrdiff_t *, bool);
 extern void scan_newline (ptrdiff_t, ptrdiff_t, ptrdiff_t, ptrdiff_t,
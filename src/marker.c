@@ -76,12 +76,881 @@ clear_charpos_cache (struct buffer *b)
     cached_buffer = 0;
 }
 
+/* The tree of markers.
+
+   The markers of a buffer text are the nodes of a binary search tree
+   ordered by position, whose root is BUF_MARKERS.  Inserting or
+   deleting text relocates all the markers after some position, so
+   instead of adding the same amount to each of them we add it to the
+   OFFSET and OFFSET_BYTE of the roots of the subtrees that hold them,
+   the way itree.c does for overlays.  A marker's offsets have to be
+   added to its positions, and pushed down to its children, before its
+   positions can be looked at: marker_inherit_offset does that, and
+   every traversal of the tree from its root calls it on the markers it
+   visits.  The tree's OTICK is incremented every time offsets are
+   introduced, so that a marker whose own OTICK equals it is known to
+   have no pending offsets above it.
+
+   The tree is kept balanced as a scapegoat tree: when a marker is
+   inserted deeper than log(N)/log(3/2), the lowest subtree on its
+   path one of whose children holds more than two thirds of its markers
+   is rebuilt into a perfectly balanced one, and the whole tree is rebuilt
+   when enough markers were removed from it.  Rebuilding needs no
+   rotations, and so no memory and no care for the offsets beyond
+   pushing them all down first, which suits removing the markers freed
+   by the garbage collector.  */
+
+/* Push the pending offsets of M into its positions, and down to its
+   children.  */
+
+static void
+marker_push_offset (struct Lisp_Marker *m)
+{
+  if (m->offset || m->offset_byte)
+    {
+      m->charpos += m->offset;
+      m->bytepos += m->offset_byte;
+      if (m->left)
+	{
+	  m->left->offset += m->offset;
+	  m->left->offset_byte += m->offset_byte;
+	}
+      if (m->right)
+	{
+	  m->right->offset += m->offset;
+	  m->right->offset_byte += m->offset_byte;
+	}
+      m->offset = m->offset_byte = 0;
+    }
+}
+
+/* Likewise, and mark M clean if its parent is.  */
+
+static void
+marker_inherit_offset (uintmax_t otick, struct Lisp_Marker *m)
+{
+  marker_push_offset (m);
+  if (m->parent == NULL || m->parent->otick == otick)
+    m->otick = otick;
+}
+
+/* Make M, which is in the tree with OTICK, clean, cleaning its
+   ancestors along the way.  */
+
+static void
+marker_tree_validate (uintmax_t otick, struct Lisp_Marker *m)
+{
+  if (m->otick == otick)
+    return;
+  if (m->parent)
+    marker_tree_validate (otick, m->parent);
+  marker_inherit_offset (otick, m);
+}
+
+/* Make the positions of M, which must point somewhere, up to date.  */
+
+void
+validate_marker (struct Lisp_Marker *m)
+{
+  marker_tree_validate (m->buffer->text->markers_otick, m);
+}
+
+/* Return the first marker of B at or after CHARPOS, or NULL if there
+   is none.  The marker and all its ancestors are clean.  */
+
+struct Lisp_Marker *
+marker_tree_first (struct buffer *b, ptrdiff_t charpos)
+{
+  uintmax_t otick = b->text->markers_otick;
+  struct Lisp_Marker *m = BUF_MARKERS (b), *found = NULL;
+
+  while (m)
+    {
+      marker_inherit_offset (otick, m);
+      if (m->charpos >= charpos)
+	{
+	  found = m;
+	  m = m->left;
+	}
+      else
+	m = m->right;
+    }
+  return found;
+}
+
+/* Return the marker that follows M in a tree with OTICK, or NULL if M
+   is the last one.  M's ancestors must be clean.  */
+
+static struct Lisp_Marker *
+marker_tree_successor (uintmax_t otick, struct Lisp_Marker *m)
+{
+  if (m->right)
+    {
+      m = m->right;
+      marker_inherit_offset (otick, m);
+      while (m->left)
+	{
+	  m = m->left;
+	  marker_inherit_offset (otick, m);
+	}
+      return m;
+    }
+  while (m->parent && m == m->parent->right)
+    m = m->parent;
+  return m->parent;
+}
+
+/* Likewise, but return the marker that precedes M.  */
+
+static struct Lisp_Marker *
+marker_tree_predecessor (uintmax_t otick, struct Lisp_Marker *m)
+{
+  if (m->left)
+    {
+      m = m->left;
+      marker_inherit_offset (otick, m);
+      while (m->right)
+	{
+	  m = m->right;
+	  marker_inherit_offset (otick, m);
+	}
+      return m;
+    }
+  while (m->parent && m == m->parent->left)
+    m = m->parent;
+  return m->parent;
+}
+
+/* Return the marker of B that follows M, or NULL if M is the last one.
+   M's ancestors must be clean, as they are for the markers returned by
+   this function and by marker_tree_first.  */
+
+struct Lisp_Marker *
+marker_tree_next (struct buffer *b, struct Lisp_Marker *m)
+{
+  return marker_tree_successor (b->text->markers_otick, m);
+}
+
+/* Find the markers of T closest to POS, a byte position if BYTE and a
+   char position otherwise.  Store in *BELOW the last one at or before
+   POS and in *ABOVE the first one at or after it, or NULL if there is
+   none.  */
+
+static void
+marker_tree_nearest (struct buffer_text *t, ptrdiff_t pos, bool byte,
+		     struct Lisp_Marker **below, struct Lisp_Marker **above)
+{
+  struct Lisp_Marker *m = t->markers;
+
+  *below = *above = NULL;
+  while (m)
+    {
+      marker_inherit_offset (t->markers_otick, m);
+      ptrdiff_t mpos = byte ? m->bytepos : m->charpos;
+      if (mpos == pos)
+	{
+	  *below = *above = m;
+	  return;
+	}
+      if (mpos < pos)
+	{
+	  *below = m;
+	  m = m->right;
+	}
+      else
+	{
+	  *above = m;
+	  m = m->left;
+	}
+    }
+}
+
+/* Return the number of markers in the subtree rooted at M.  */
+
+static ptrdiff_t
+marker_subtree_size (struct Lisp_Marker *m)
+{
+  ptrdiff_t size = 0;
+
+  for (; m; m = m->right)
+    size += 1 + marker_subtree_size (m->left);
+  return size;
+}
+
+/* Push down all the pending offsets of the subtree rooted at M, and
+   chain its markers in order through their RIGHT field in front of
+   LIST, leaving out those that point nowhere if PRUNE.  Add their
+   number to *COUNT and return the new head of the list.  */
+
+static struct Lisp_Marker *
+marker_tree_flatten (struct Lisp_Marker *m, struct Lisp_Marker *list,
+		     ptrdiff_t *count, bool prune)
+{
+  while (m)
+    {
+      struct Lisp_Marker *left = m->left;
+
+      marker_push_offset (m);
+      list = marker_tree_flatten (m->right, list, count, prune);
+      if (prune && !m->buffer)
+	m->parent = m->left = m->right = NULL;
+      else
+	{
+	  m->right = list;
+	  list = m;
+	  ++*count;
+	}
+      m = left;
+    }
+  return list;
+}
+
+/* Build a perfectly balanced tree out of the first COUNT markers of
+   *LIST, which are chained through their RIGHT field, and advance
+   *LIST past them.  Return the root of the new tree, all of whose
+   markers are clean with respect to OTICK.  */
+
+static struct Lisp_Marker *
+marker_tree_build (struct Lisp_Marker **list, ptrdiff_t count, uintmax_t otick)
+{
+  if (count == 0)
+    return NULL;
+
+  struct Lisp_Marker *left = marker_tree_build (list, count / 2, otick);
+  struct Lisp_Marker *m = *list;
+  *list = m->right;
+  m->left = left;
+  if (left)
+    left->parent = m;
+  m->right = marker_tree_build (list, count - count / 2 - 1, otick);
+  if (m->right)
+    m->right->parent = m;
+  m->otick = otick;
+  return m;
+}
+
+/* Rebuild the subtree of T rooted at M, whose ancestors must be clean,
+   into a balanced one.  Drop the markers that point nowhere if PRUNE.
+   Return the number of markers left in the subtree.  */
+
+static ptrdiff_t
+marker_tree_rebuild (struct buffer_text *t, struct Lisp_Marker *m, bool prune)
+{
+  struct Lisp_Marker *parent = m->parent;
+  struct Lisp_Marker **link = (!parent ? &t->markers
+			       : m == parent->left ? &parent->left
+			       : &parent->right);
+  ptrdiff_t count = 0;
+  struct Lisp_Marker *list = marker_tree_flatten (m, NULL, &count, prune);
+
+  *link = marker_tree_build (&list, count, t->markers_otick);
+  if (*link)
+    (*link)->parent = parent;
+  return count;
+}
+
+/* Return the depth beyond which a marker makes a tree of COUNT
+   markers too unbalanced, namely log(COUNT)/log(3/2).  */
+
+static int
+marker_tree_max_depth (ptrdiff_t count)
+{
+  int depth = 0;
+  for (double n = 1.5; n <= count; n *= 1.5)
+    depth++;
+  return depth;
+}
+
+/* Insert M, whose positions are set, into the tree of T.  */
+
+static void
+marker_tree_insert (struct buffer_text *t, struct Lisp_Marker *m)
+{
+  uintmax_t otick = t->markers_otick;
+  struct Lisp_Marker *parent = NULL, **link = &t->markers;
+  int depth = 0;
+
+  while (*link)
+    {
+      parent = *link;
+      marker_inherit_offset (otick, parent);
+      link = m->charpos < parent->charpos ? &parent->left : &parent->right;
+      depth++;
+    }
+  m->parent = parent;
+  m->left = m->right = NULL;
+  m->offset = m->offset_byte = 0;
+  m->otick = otick;
+  *link = m;
+
+  t->markers_count++;
+  if (t->markers_max_count < t->markers_count)
+    t->markers_max_count = t->markers_count;
+  if (depth <= marker_tree_max_depth (t->markers_count))
+    return;
+
+  /* M is too deep: find its closest ancestor one of whose children
+     holds more than two thirds of its markers, and rebuild it.  */
+  ptrdiff_t size = 1;
+  for (; (parent = m->parent); m = parent)
+    {
+      struct Lisp_Marker *sibling
+	= m == parent->left ? parent->right : parent->left;
+      ptrdiff_t parent_size = size + 1 + marker_subtree_size (sibling);
+      if (3 * size > 2 * parent_size)
+	{
+	  m = parent;
+	  break;
+	}
+      size = parent_size;
+    }
+  marker_tree_rebuild (t, m, false);
+}
+
+/* Replace the subtree of T rooted at M by the one rooted at CHILD,
+   which may be NULL.  */
+
+static void
+marker_tree_transplant (struct buffer_text *t, struct Lisp_Marker *m,
+			struct Lisp_Marker *child)
+{
+  if (m->parent == NULL)
+    t->markers = child;
+  else if (m == m->parent->left)
+    m->parent->left = child;
+  else
+    m->parent->right = child;
+  if (child)
+    child->parent = m->parent;
+}
+
+/* Remove M from the tree of T.  M's positions are left up to date.  */
+
+static void
+marker_tree_remove (struct buffer_text *t, struct Lisp_Marker *m)
+{
+  uintmax_t otick = t->markers_otick;
+
+  marker_tree_validate (otick, m);
+  if (m->left && m->right)
+    {
+      /* Put M's successor, which has no left child, in its place.  */
+      struct Lisp_Marker *next = marker_tree_successor (otick, m);
+      if (next->parent != m)
+	{
+	  marker_tree_transplant (t, next, next->right);
+	  next->right = m->right;
+	  next->right->parent = next;
+	}
+      marker_tree_transplant (t, m, next);
+      next->left = m->left;
+      next->left->parent = next;
+    }
+  else
+    marker_tree_transplant (t, m, m->left ? m->left : m->right);
+  m->parent = m->left = m->right = NULL;
+
+  t->markers_count--;
+  if (3 * t->markers_count < 2 * t->markers_max_count)
+    {
+      if (t->markers)
+	marker_tree_rebuild (t, t->markers, false);
+      t->markers_max_count = t->markers_count;
+    }
+}
+
+/* Relocate the markers in the subtree rooted at M, which is in a tree
+   with OTICK, for a change of the text from FROM to TO: see
+   marker_tree_replace.  */
+
+static void
+marker_tree_shift (uintmax_t otick, struct Lisp_Marker *m,
+		   ptrdiff_t from, ptrdiff_t from_byte, ptrdiff_t to,
+		   ptrdiff_t nchars, ptrdiff_t nbytes)
+{
+  while (m)
+    {
+      marker_inherit_offset (otick, m);
+      if (m->charpos >= to)
+	{
+	  /* M and all the markers after it move.  */
+	  m->charpos += nchars;
+	  m->bytepos += nbytes;
+	  if (m->right)
+	    {
+	      m->right->offset += nchars;
+	      m->right->offset_byte += nbytes;
+	    }
+	  m = m->left;
+	}
+      else
+	{
+	  if (m->charpos > from)
+	    {
+	      m->charpos = from;
+	      m->bytepos = from_byte;
+	      marker_tree_shift (otick, m->left,
+				 from, from_byte, to, nchars, nbytes);
+	    }
+	  m = m->right;
+	}
+    }
+}
+
+/* Relocate the markers of B for a change of its text between FROM
+   (FROM_BYTE) and TO: the markers after FROM and before TO move to
+   FROM, and those at or after TO move forward by NCHARS characters
+   and NBYTES bytes.  TO + NCHARS must not be less than FROM.  This
+   takes time proportional to the logarithm of the number of markers,
+   plus the number of markers that move to FROM.  */
+
+void
+marker_tree_replace (struct buffer *b, ptrdiff_t from, ptrdiff_t from_byte,
+		     ptrdiff_t to, ptrdiff_t nchars, ptrdiff_t nbytes)
+{
+  struct buffer_text *t = b->text;
+
+  eassert (from <= to && from <= to + nchars);
+  if (t->markers)
+    {
+      /* Offsets are about to be introduced in some subtrees.  */
+      t->markers_otick++;
+      marker_tree_shift (t->markers_otick, t->markers,
+			 from, from_byte, to, nchars, nbytes);
+    }
+}
+
+/* Relocate the markers of B for an insertion of NCHARS characters and
+   NBYTES bytes at FROM (FROM_BYTE).  The markers at FROM advance if
+   BEFORE_MARKERS or if their insertion type is t.  */
+
+void
+marker_tree_insert_gap (struct buffer *b, ptrdiff_t from, ptrdiff_t from_byte,
+			ptrdiff_t nchars, ptrdiff_t nbytes, bool before_markers)
+{
+  if (before_markers)
+    {
+      marker_tree_replace (b, from, from_byte, from, nchars, nbytes);
+      return;
+    }
+
+  /* The markers at FROM that advance would have to move past those
+     which stay put, which could mess up the order of the tree.  So
+     take them out first, and put them back below.  */
+  struct Lisp_Marker *advancing = NULL;
+  struct Lisp_Marker *m = marker_tree_first (b, from);
+  while (m && m->charpos == from)
+    {
+      struct Lisp_Marker *next = marker_tree_next (b, m);
+      if (m->insertion_type)
+	{
+	  marker_tree_remove (b->text, m);
+	  m->right = advancing;
+	  advancing = m;
+	}
+      m = next;
+    }
+
+  marker_tree_replace (b, from, from_byte, from + 1, nchars, nbytes);
+
+  while ((m = advancing))
+    {
+      advancing = m->right;
+      m->charpos = from + nchars;
+      m->bytepos = from_byte + nbytes;
+      marker_tree_insert (b->text, m);
+    }
+}
+
+/* Remove from the tree of B the markers whose buffer was set to NULL,
+   and rebalance it.  This takes time proportional to the number of
+   markers of B.  */
+
+void
+prune_markers (struct buffer *b)
+{
+  struct buffer_text *t = b->text;
+
+  t->markers_count = t->markers ? marker_tree_rebuild (t, t->markers, true) : 0;
+  t->markers_max_count = t->markers_count;
+}
+
+/* The index of character positions.
+
+   In a large multibyte buffer, all the places where the
+   correspondence between character and byte positions is known can
+   be far from the position to convert, and scanning from them used to
+   dominate random access to the text.  So the text of such a buffer
+   is also split into chunks of roughly CHAR_INDEX_CHUNK bytes, each
+   starting at a character boundary, and the size in bytes and in
+   characters of every chunk is kept in an array and summed up in a
+   pair of Fenwick trees, as in the line index (see line-index.c).
+   Finding the chunk that holds a position, and where it starts and
+   ends, then takes a logarithmic number of steps, and at most a chunk
+   of text has to be scanned.  A chunk with as many characters as
+   bytes is all ASCII, and needs no scanning at all.
+
+   Unlike the line index, this index cannot be brought up to date
+   lazily, because finding where the changed text starts and ends
+   would need the very conversions it is meant to speed up.  Instead,
+   insdel.c calls adjust_char_index for every change to the text,
+   which knows both the characters and the bytes it replaced.  A
+   change within a chunk is added to that chunk, and one that spans
+   several chunks merges them; chunks that grow too large are split
+   again the next time they are looked up.  */
+
+/* The size in bytes of the chunks the index is built from.  A chunk
+   that grows to more than CHAR_INDEX_CHUNK_MAX bytes is split when it
+   is next looked up.  */
+enum { CHAR_INDEX_CHUNK = 4 * 1024,
+       CHAR_INDEX_CHUNK_MAX = 4 * CHAR_INDEX_CHUNK };
+
+/* Buffers smaller than this many bytes are not indexed.  */
+enum { CHAR_INDEX_MIN_SIZE = 4 * CHAR_INDEX_CHUNK };
+
+/* The number of bytes that are counted at a time when scanning for a
+   character position.  */
+enum { CHAR_SCAN_BLOCK = 64 };
+
+struct char_index
+{
+  /* The number of chunks, and the number of slots allocated for them
+     in the arrays below.  */
+  ptrdiff_t nchunks, size;
+
+  /* The size in bytes and in characters of each chunk.  */
+  ptrdiff_t *bytes, *chars;
+
+  /* Fenwick trees over BYTES and CHARS.  */
+  ptrdiff_t *byte_tree, *char_tree;
+
+  /* The size in bytes and in characters of the text the chunks
+     describe.  */
+  ptrdiff_t total_bytes, total_chars;
+};
+
+/* Return how many of the N bytes at P start a character.  This is
+   kept simple enough for the compiler to vectorize.  */
+static ptrdiff_t
+count_char_heads (unsigned char const *p, ptrdiff_t n)
+{
+  ptrdiff_t heads = 0;
+
+  for (ptrdiff_t i = 0; i < n; i++)
+    heads += CHAR_HEAD_P (p[i]);
+  return heads;
+}
+
+/* Return the number of characters of B between byte positions FROM
+   and TO, which must be character boundaries.  */
+static ptrdiff_t
+buf_count_chars (struct buffer *b, ptrdiff_t from, ptrdiff_t to)
+{
+  ptrdiff_t n = 0;
+
+  if (from < BUF_GPT_BYTE (b) && BUF_GPT_BYTE (b) < to)
+    {
+      n = count_char_heads (BUF_BYTE_ADDRESS (b, from),
+			    BUF_GPT_BYTE (b) - from);
+      from = BUF_GPT_BYTE (b);
+    }
+  return n + count_char_heads (BUF_BYTE_ADDRESS (b, from), to - from);
+}
+
+/* Return the byte position of B that is N characters after byte
+   position FROM, a character boundary.  */
+static ptrdiff_t
+buf_advance_chars (struct buffer *b, ptrdiff_t from, ptrdiff_t n)
+{
+  /* What we look for is the Nth character head at or after FROM,
+     counting from 0, so we can skip whole blocks that hold no more
+     than N heads, even if that leaves FROM inside a character.  */
+  while (true)
+    {
+      ptrdiff_t limit = (from < BUF_GPT_BYTE (b)
+			 ? BUF_GPT_BYTE (b) : BUF_Z_BYTE (b));
+      unsigned char *p = BUF_BYTE_ADDRESS (b, from);
+
+      while (limit - from >= CHAR_SCAN_BLOCK)
+	{
+	  ptrdiff_t heads = count_char_heads (p, CHAR_SCAN_BLOCK);
+	  if (heads > n)
+	    break;
+	  n -= heads;
+	  from += CHAR_SCAN_BLOCK;
+	  p += CHAR_SCAN_BLOCK;
+	}
+      for (; from < limit; from++, p++)
+	if (CHAR_HEAD_P (*p) && n-- == 0)
+	  return from;
+      if (from == BUF_Z_BYTE (b))
+	{
+	  eassert (n == 0);
+	  return from;
+	}
+    }
+}
+
+/* Return the byte position of B that is N characters before byte
+   position FROM, a character boundary.  */
+static ptrdiff_t
+buf_retreat_chars (struct buffer *b, ptrdiff_t from, ptrdiff_t n)
+{
+  while (n > 0)
+    {
+      ptrdiff_t limit = (from > BUF_GPT_BYTE (b)
+			 ? BUF_GPT_BYTE (b) : BUF_BEG_BYTE (b));
+      unsigned char *p = BUF_BYTE_ADDRESS (b, from - 1) + 1;
+
+      eassert (from > limit);
+      while (from - limit >= CHAR_SCAN_BLOCK)
+	{
+	  ptrdiff_t heads = count_char_heads (p - CHAR_SCAN_BLOCK,
+					      CHAR_SCAN_BLOCK);
+	  if (heads >= n)
+	    break;
+	  n -= heads;
+	  from -= CHAR_SCAN_BLOCK;
+	  p -= CHAR_SCAN_BLOCK;
+	}
+      while (from > limit)
+	{
+	  from--, p--;
+	  if (CHAR_HEAD_P (*p) && --n == 0)
+	    return from;
+	}
+    }
+  return from;
+}
+
+/* Replace the NOLD chunks of CI starting with chunk FIRST by NNEW
+   chunks whose sizes are still to be set, leaving the Fenwick trees
+   to be rebuilt.  */
+static void
+resize_chunks (struct char_index *ci, ptrdiff_t first, ptrdiff_t nold,
+	       ptrdiff_t nnew)
+{
+  ptrdiff_t nchunks = ci->nchunks - nold + nnew;
+
+  if (ci->size < nchunks)
+    {
+      ptrdiff_t size = ci->size;
+      ci->bytes = xpalloc (ci->bytes, &size, nchunks - ci->size, -1,
+			   sizeof *ci->bytes);
+      ci->chars = xnrealloc (ci->chars, size, sizeof *ci->chars);
+      ci->byte_tree = xnrealloc (ci->byte_tree, size + 1,
+				 sizeof *ci->byte_tree);
+      ci->char_tree = xnrealloc (ci->char_tree, size + 1,
+				 sizeof *ci->char_tree);
+      ci->size = size;
+    }
+  ptrdiff_t tail = ci->nchunks - (first + nold);
+  memmove (ci->bytes + first + nnew, ci->bytes + first + nold,
+	   tail * sizeof *ci->bytes);
+  memmove (ci->chars + first + nnew, ci->chars + first + nold,
+	   tail * sizeof *ci->chars);
+  ci->nchunks = nchunks;
+}
+
+/* Replace the NOLD chunks of CI, the index of B, starting with chunk
+   FIRST by chunks describing the text of B between byte positions
+   FROM and TO, and bring the Fenwick trees up to date.  */
+static void
+replace_chunks (struct buffer *b, struct char_index *ci, ptrdiff_t first,
+		ptrdiff_t nold, ptrdiff_t from, ptrdiff_t to)
+{
+  ptrdiff_t base = from, length = to - from;
+  ptrdiff_t nnew = max (1, ((length + CHAR_INDEX_CHUNK - 1)
+			    / CHAR_INDEX_CHUNK));
+
+  resize_chunks (ci, first, nold, nnew);
+  for (ptrdiff_t i = 0; i < nnew; i++)
+    {
+      ptrdiff_t end = to;
+      if (i < nnew - 1)
+	{
+	  /* End the chunk at the next character boundary.  */
+	  end = base + length * (i + 1) / nnew;
+	  while (!CHAR_HEAD_P (BUF_FETCH_BYTE (b, end)))
+	    end++;
+	}
+      ci->bytes[first + i] = end - from;
+      ci->chars[first + i] = buf_count_chars (b, from, end);
+      from = end;
+    }
+  fenwick_build (ci->byte_tree, ci->bytes, ci->nchunks);
+  fenwick_build (ci->char_tree, ci->chars, ci->nchunks);
+}
+
+/* Describe the whole text of B in CI.  */
+static void
+rebuild_char_index (struct buffer *b, struct char_index *ci)
+{
+  ci->nchunks = 0;
+  ci->total_bytes = BUF_Z_BYTE (b) - BUF_BEG_BYTE (b);
+  ci->total_chars = BUF_Z (b) - BUF_BEG (b);
+  replace_chunks (b, ci, 0, 0, BUF_BEG_BYTE (b), BUF_Z_BYTE (b));
+}
+
+/* Return the index of the character positions of B, made if needed,
+   or NULL if B is too small to be indexed.  */
+static struct char_index *
+buffer_char_index (struct buffer *b)
+{
+  struct char_index *ci = b->text->char_index;
+
+  if (!ci)
+    {
+      if (BUF_Z_BYTE (b) - BUF_BEG_BYTE (b) < CHAR_INDEX_MIN_SIZE)
+	return NULL;
+      ci = b->text->char_index = xzalloc (sizeof *ci);
+    }
+  else if (ci->total_bytes == BUF_Z_BYTE (b) - BUF_BEG_BYTE (b)
+	   && ci->total_chars == BUF_Z (b) - BUF_BEG (b))
+    return ci;
+
+  /* The text should not have changed size without adjust_char_index
+     being told about it, but a full rebuild is cheap insurance.  */
+  rebuild_char_index (b, ci);
+  return ci;
+}
+
+/* Find the chunk of CI, the index of B, that holds character position
+   POS, or byte position POS if BYTE, after splitting it if it is too
+   large.  Store where it starts in *START and *START_BYTE, and where
+   it ends in *END and *END_BYTE.  */
+static void
+char_index_chunk (struct buffer *b, struct char_index *ci,
+		  ptrdiff_t pos, bool byte,
+		  ptrdiff_t *start, ptrdiff_t *start_byte,
+		  ptrdiff_t *end, ptrdiff_t *end_byte)
+{
+  ptrdiff_t i, chars, bytes;
+
+  while (true)
+    {
+      if (byte)
+	{
+	  i = fenwick_search (ci->byte_tree, ci->nchunks,
+			      pos - BUF_BEG_BYTE (b), &bytes);
+	  chars = fenwick_sum (ci->char_tree, i);
+	}
+      else
+	{
+	  i = fenwick_search (ci->char_tree, ci->nchunks,
+			      pos - BUF_BEG (b), &chars);
+	  bytes = fenwick_sum (ci->byte_tree, i);
+	}
+      if (i == ci->nchunks)
+	{
+	  i--;
+	  bytes -= ci->bytes[i];
+	  chars -= ci->chars[i];
+	}
+      if (ci->bytes[i] <= CHAR_INDEX_CHUNK_MAX)
+	break;
+      replace_chunks (b, ci, i, 1, BUF_BEG_BYTE (b) + bytes,
+		      BUF_BEG_BYTE (b) + bytes + ci->bytes[i]);
+    }
+
+  *start = BUF_BEG (b) + chars;
+  *start_byte = BUF_BEG_BYTE (b) + bytes;
+  *end = *start + ci->chars[i];
+  *end_byte = *start_byte + ci->bytes[i];
+}
+
+/* Update the index of the character positions of B after a change at
+   character position FROM, byte position FROM_BYTE, that replaced
+   OLD_CHARS characters of OLD_BYTES bytes by NEW_CHARS characters of
+   NEW_BYTES bytes.  This is called by insdel.c for every change to
+   the text.  */
+void
+adjust_char_index (struct buffer *b, ptrdiff_t from, ptrdiff_t from_byte,
+		   ptrdiff_t old_chars, ptrdiff_t old_bytes,
+		   ptrdiff_t new_chars, ptrdiff_t new_bytes)
+{
+  struct char_index *ci = b->text->char_index;
+
+  if (!ci)
+    return;
+
+  ptrdiff_t start = from_byte - BUF_BEG_BYTE (b);
+  ptrdiff_t end = start + old_bytes;
+  if (ci->total_bytes < end
+      || ci->total_chars < from - BUF_BEG (b) + old_chars)
+    {
+      /* The index missed some earlier change; start over.  */
+      clear_char_index (b);
+      return;
+    }
+
+  /* Find the chunks that the old text overlaps.  */
+  ptrdiff_t first_start, last_start;
+  ptrdiff_t first = fenwick_search (ci->byte_tree, ci->nchunks, start,
+				    &first_start);
+  if (first == ci->nchunks)
+    {
+      first--;
+      first_start -= ci->bytes[first];
+    }
+  ptrdiff_t last = first;
+  last_start = first_start;
+  if (end > first_start + ci->bytes[first])
+    last = fenwick_search (ci->byte_tree, ci->nchunks, end - 1,
+			   &last_start);
+
+  if (first == last)
+    {
+      ci->bytes[first] += new_bytes - old_bytes;
+      ci->chars[first] += new_chars - old_chars;
+      fenwick_add (ci->byte_tree, ci->nchunks, first,
+		   new_bytes - old_bytes);
+      fenwick_add (ci->char_tree, ci->nchunks, first,
+		   new_chars - old_chars);
+    }
+  else
+    {
+      /* Merge the chunks into one, since the boundaries between them
+	 need not be character boundaries of the new text.  */
+      ptrdiff_t bytes = last_start + ci->bytes[last] - first_start;
+      ptrdiff_t chars = (fenwick_sum (ci->char_tree, last + 1)
+			 - fenwick_sum (ci->char_tree, first));
+      resize_chunks (ci, first, last - first + 1, 1);
+      ci->bytes[first] = bytes + new_bytes - old_bytes;
+      ci->chars[first] = chars + new_chars - old_chars;
+      fenwick_build (ci->byte_tree, ci->bytes, ci->nchunks);
+      fenwick_build (ci->char_tree, ci->chars, ci->nchunks);
+    }
+
+  ci->total_bytes += new_bytes - old_bytes;
+  ci->total_chars += new_chars - old_chars;
+}
+
+/* Free the index of the character positions of B, if any.  */
+void
+clear_char_index (struct buffer *b)
+{
+  struct char_index *ci = b->text->char_index;
+
+  if (ci)
+    {
+      xfree (ci->bytes);
+      xfree (ci->chars);
+      xfree (ci->byte_tree);
+      xfree (ci->char_tree);
+      xfree (ci);
+      b->text->char_index = NULL;
+    }
+}
+
 /* Converting between character positions and byte positions.  */
 
 /* There are several places in the buffer where we know
    the correspondence: BEG, BEGV, PT, GPT, ZV and Z,
    and everywhere there is a marker.  So we find the one of these places
-   that is closest to the specified position, and scan from there.  */
+   that is closest to the specified position, and scan from there.
+   If they are all far away, the index of character positions gives
+   two more places, around the specified position.  */
 
 /* This macro is a subroutine of buf_charpos_to_bytepos.
    Note that it is desirable that BYTEPOS is not evaluated
@@ -133,37 +1002,15 @@ CHECK_MARKER (Lisp_Object x)
   CHECK_TYPE (MARKERP (x), Qmarkerp, x);
 }
 
-/* When converting bytes from/to chars, we look through the list of
-   markers to try and find a good starting point (since markers keep
-   track of both bytepos and charpos at the same time).
-   But if there are many markers, it can take too much time to find a "good"
-   marker from which to start.  Worse yet: if it takes a long time and we end
-   up finding a nearby markers, we won't add a new marker to cache this
-   result, so next time around we'll have to go through this same long list
-   to (re)find this best marker.  So the further down the list of
-   markers we go, the less demanding we are w.r.t what is a good marker.
-
-   The previous code used INITIAL=50 and INCREMENT=0 and this lead to
-   really poor performance when there are many markers.
-   I haven't tried to tweak INITIAL, but experiments on my trusty Thinkpad
-   T61 using various artificial test cases seem to suggest that INCREMENT=50
-   might be "the best compromise": it significantly improved the
-   worst case and it was rarely slower and never by much.
-
-   The asymptotic behavior is still poor, tho, so in largish buffers with many
-   overlays (e.g. 300KB and 30K overlays), it can still be a bottleneck.  */
-#define BYTECHAR_DISTANCE_INITIAL 50
-#define BYTECHAR_DISTANCE_INCREMENT 50
-
 /* Return the byte position corresponding to CHARPOS in B.  */
 
 ptrdiff_t
 buf_charpos_to_bytepos (struct buffer *b, ptrdiff_t charpos)
 {
-  struct Lisp_Marker *tail;
+  struct Lisp_Marker *below, *above;
+  struct char_index *ci;
   ptrdiff_t best_above, best_above_byte;
   ptrdiff_t best_below, best_below_byte;
-  ptrdiff_t distance = BYTECHAR_DISTANCE_INITIAL;
 
   eassert (BUF_BEG (b) <= charpos && charpos <= BUF_Z (b));
 
@@ -196,74 +1043,43 @@ buf_charpos_to_bytepos (struct buffer *b, ptrdiff_t charpos)
   if (b == cached_buffer && BUF_MODIFF (b) == cached_modiff)
     CONSIDER (cached_charpos, cached_bytepos);
 
-  for (tail = BUF_MARKERS (b); tail; tail = tail->next)
+  /* The markers are sorted, so the closest ones are found by a
+     single descent of their tree.  */
+  marker_tree_nearest (b->text, charpos, false, &below, &above);
+  if (below)
+    CONSIDER (below->charpos, below->bytepos);
+  if (above)
+    CONSIDER (above->charpos, above->bytepos);
+
+  if (charpos - best_below > CHAR_INDEX_CHUNK
+      && best_above - charpos > CHAR_INDEX_CHUNK
+      && (ci = buffer_char_index (b)))
     {
-      CONSIDER (tail->charpos, tail->bytepos);
+      ptrdiff_t start, start_byte, end, end_byte;
 
-      /* If we are down to a range of 50 chars,
-	 don't bother checking any other markers;
-	 scan the intervening chars directly now.  */
-      if (best_above - charpos < distance
-          || charpos - best_below < distance)
-	break;
-      else
-        distance += BYTECHAR_DISTANCE_INCREMENT;
+      char_index_chunk (b, ci, charpos, false,
+			&start, &start_byte, &end, &end_byte);
+      CONSIDER (start, start_byte);
+      CONSIDER (end, end_byte);
     }
 
   /* We get here if we did not exactly hit one of the known places.
      We have one known above and one known below.
      Scan, counting characters, from whichever one is closer.  */
 
-  if (charpos - best_below < best_above - charpos)
-    {
-      bool record = charpos - best_below > 5000;
-
-      while (best_below != charpos)
-	{
-	  best_below++;
-	  best_below_byte += buf_next_char_len (b, best_below_byte);
-	}
-
-      /* If this position is quite far from the nearest known position,
-	 cache the correspondence by creating a marker here.
-	 It will last until the next GC.  */
-      if (record)
-	build_marker (b, best_below, best_below_byte);
-
-      byte_char_debug_check (b, best_below, best_below_byte);
-
-      cached_buffer = b;
-      cached_modiff = BUF_MODIFF (b);
-      cached_charpos = best_below;
-      cached_bytepos = best_below_byte;
-
-      return best_below_byte;
-    }
-  else
-    {
-      bool record = best_above - charpos > 5000;
-
-      while (best_above != charpos)
-	{
-	  best_above--;
-	  best_above_byte -= buf_prev_char_len (b, best_above_byte);
-	}
-
-      /* If this position is quite far from the nearest known position,
-	 cache the correspondence by creating a marker here.
-	 It will last until the next GC.  */
-      if (record)
-	build_marker (b, best_above, best_above_byte);
+  ptrdiff_t value
+    = (charpos - best_below < best_above - charpos
+       ? buf_advance_chars (b, best_below_byte, charpos - best_below)
+       : buf_retreat_chars (b, best_above_byte, best_above - charpos));
 
-      byte_char_debug_check (b, best_above, best_above_byte);
+  byte_char_debug_check (b, charpos, value);
 
-      cached_buffer = b;
-      cached_modiff = BUF_MODIFF (b);
-      cached_charpos = best_above;
-      cached_bytepos = best_above_byte;
+  cached_buffer = b;
+  cached_modiff = BUF_MODIFF (b);
+  cached_charpos = charpos;
+  cached_bytepos = value;
 
-      return best_above_byte;
-    }
+  return value;
 }
 
 #undef CONSIDER
@@ -316,10 +1132,10 @@ #define CONSIDER(BYTEPOS, CHARPOS)					\
 ptrdiff_t
 buf_bytepos_to_charpos (struct buffer *b, ptrdiff_t bytepos)
 {
-  struct Lisp_Marker *tail;
+  struct Lisp_Marker *below, *above;
+  struct char_index *ci;
   ptrdiff_t best_above, best_above_byte;
   ptrdiff_t best_below, best_below_byte;
-  ptrdiff_t distance = BYTECHAR_DISTANCE_INITIAL;
 
   eassert (BUF_BEG_BYTE (b) <= bytepos && bytepos <= BUF_Z_BYTE (b));
 
@@ -347,78 +1163,41 @@ buf_bytepos_to_charpos (struct buffer *b, ptrdiff_t bytepos)
   if (b == cached_buffer && BUF_MODIFF (b) == cached_modiff)
     CONSIDER (cached_bytepos, cached_charpos);
 
-  for (tail = BUF_MARKERS (b); tail; tail = tail->next)
+  marker_tree_nearest (b->text, bytepos, true, &below, &above);
+  if (below)
+    CONSIDER (below->bytepos, below->charpos);
+  if (above)
+    CONSIDER (above->bytepos, above->charpos);
+
+  if (bytepos - best_below_byte > CHAR_INDEX_CHUNK
+      && best_above_byte - bytepos > CHAR_INDEX_CHUNK
+      && (ci = buffer_char_index (b)))
     {
-      CONSIDER (tail->bytepos, tail->charpos);
+      ptrdiff_t start, start_byte, end, end_byte;
 
-      /* If we are down to a range of 50 chars,
-	 don't bother checking any other markers;
-	 scan the intervening chars directly now.  */
-      if (best_above - bytepos < distance
-          || bytepos - best_below < distance)
-	break;
-      else
-        distance += BYTECHAR_DISTANCE_INCREMENT;
+      char_index_chunk (b, ci, bytepos, true,
+			&start, &start_byte, &end, &end_byte);
+      CONSIDER (start_byte, start);
+      CONSIDER (end_byte, end);
     }
 
   /* We get here if we did not exactly hit one of the known places.
      We have one known above and one known below.
-     Scan, counting characters, from whichever one is closer.  */
-
-  if (bytepos - best_below_byte < best_above_byte - bytepos)
-    {
-      bool record = bytepos - best_below_byte > 5000;
-
-      while (best_below_byte < bytepos)
-	{
-	  best_below++;
-	  best_below_byte += buf_next_char_len (b, best_below_byte);
-	}
-
-      /* If this position is quite far from the nearest known position,
-	 cache the correspondence by creating a marker here.
-	 It will last until the next GC.
-	 But don't do it if BUF_MARKERS is nil;
-	 that is a signal from Fset_buffer_multibyte.  */
-      if (record && BUF_MARKERS (b))
-	build_marker (b, best_below, best_below_byte);
-
-      byte_char_debug_check (b, best_below, best_below_byte);
-
-      cached_buffer = b;
-      cached_modiff = BUF_MODIFF (b);
-      cached_charpos = best_below;
-      cached_bytepos = best_below_byte;
-
-      return best_below;
-    }
-  else
-    {
-      bool record = best_above_byte - bytepos > 5000;
-
-      while (best_above_byte > bytepos)
-	{
-	  best_above--;
-	  best_above_byte -= buf_prev_char_len (b, best_above_byte);
-	}
+     Count the characters from whichever one is closer.  */
 
-      /* If this position is quite far from the nearest known position,
-	 cache the correspondence by creating a marker here.
-	 It will last until the next GC.
-	 But don't do it if BUF_MARKERS is nil;
-	 that is a signal from Fset_buffer_multibyte.  */
-      if (record && BUF_MARKERS (b))
-	build_marker (b, best_above, best_above_byte);
+  ptrdiff_t value
+    = (bytepos - best_below_byte < best_above_byte - bytepos
+       ? best_below + buf_count_chars (b, best_below_byte, bytepos)
+       : best_above - buf_count_chars (b, bytepos, best_above_byte));
 
-      byte_char_debug_check (b, best_above, best_above_byte);
+  byte_char_debug_check (b, value, bytepos);
 
-      cached_buffer = b;
-      cached_modiff = BUF_MODIFF (b);
-      cached_charpos = best_above;
-      cached_bytepos = best_above_byte;
+  cached_buffer = b;
+  cached_modiff = BUF_MODIFF (b);
+  cached_charpos = value;
+  cached_bytepos = bytepos;
 
-      return best_above;
-    }
+  return value;
 }
 
 #undef CONSIDER
@@ -451,14 +1230,14 @@ DEFUN ("marker-position", Fmarker_position, Smarker_position, 1, 1, 0,
 {
   CHECK_MARKER (marker);
   if (XMARKER (marker)->buffer)
-    return make_fixnum (XMARKER (marker)->charpos);
+    return make_fixnum (marker_charpos (XMARKER (marker)));
 
   return Qnil;
 }
 
 /* Change M so it points to B at CHARPOS and BYTEPOS.  */
 
-static void
+void
 attach_marker (struct Lisp_Marker *m, struct buffer *b,
 	       ptrdiff_t charpos, ptrdiff_t bytepos)
 {
@@ -469,16 +1248,35 @@ attach_marker (struct Lisp_Marker *m, struct buffer *b,
   else
     eassert (charpos <= bytepos);
 
-  m->charpos = charpos;
-  m->bytepos = bytepos;
+  if (m->buffer && m->buffer->text == b->text)
+    {
+      /* M is in the right tree already: leave it in its place there
+	 if it stays between its neighbors.  */
+      uintmax_t otick = b->text->markers_otick;
+      struct Lisp_Marker *prev, *next;
 
-  if (m->buffer != b)
+      m->buffer = b;
+      marker_tree_validate (otick, m);
+      if (charpos == m->charpos
+	  || (((prev = marker_tree_predecessor (otick, m)) == NULL
+	       || prev->charpos <= charpos)
+	      && ((next = marker_tree_successor (otick, m)) == NULL
+		  || charpos <= next->charpos)))
+	{
+	  m->charpos = charpos;
+	  m->bytepos = bytepos;
+	  return;
+	}
+      marker_tree_remove (b->text, m);
+    }
+  else
     {
       unchain_marker (m);
       m->buffer = b;
-      m->next = BUF_MARKERS (b);
-      BUF_MARKERS (b) = m;
     }
+  m->charpos = charpos;
+  m->bytepos = bytepos;
+  marker_tree_insert (b->text, m);
 }
 
 /* If BUFFER is nil, return current buffer pointer.  Next, check
@@ -517,8 +1315,8 @@ set_marker_internal (Lisp_Object marker, Lisp_Object position,
   else if (MARKERP (position) && b == XMARKER (position)->buffer
 	   && b == m->buffer)
     {
-      m->bytepos = XMARKER (position)->bytepos;
-      m->charpos = XMARKER (position)->charpos;
+      struct Lisp_Marker *p = XMARKER (position);
+      attach_marker (m, b, marker_charpos (p), marker_bytepos (p));
     }
 
   else
@@ -543,8 +1341,8 @@ set_marker_internal (Lisp_Object marker, Lisp_Object position,
 	}
       else if (MARKERP (position))
 	{
-	  charpos = XMARKER (position)->charpos;
-	  bytepos = XMARKER (position)->bytepos;
+	  charpos = marker_charpos (XMARKER (position));
+	  bytepos = marker_bytepos (XMARKER (position));
 	}
       else
 	wrong_type_argument (Qinteger_or_marker_p, position);
@@ -640,10 +1438,8 @@ detach_marker (Lisp_Object marker)
   Fset_marker (marker, Qnil, Qnil);
 }
 
-/* Remove MARKER from the chain of whatever buffer it is in,
-   leaving it points to nowhere.  This is called during garbage
-   collection, so we must be careful to ignore and preserve
-   mark bits, including those in chain fields of markers.  */
+/* Remove MARKER from the tree of whatever buffer it is in,
+   leaving it points to nowhere.  */
 
 void
 unchain_marker (register struct Lisp_Marker *marker)
@@ -652,34 +1448,11 @@ unchain_marker (register struct Lisp_Marker *marker)
 
   if (b)
     {
-      register struct Lisp_Marker *tail, **prev;
-
       /* No dead buffers here.  */
       eassert (BUFFER_LIVE_P (b));
 
+      marker_tree_remove (b->text, marker);
       marker->buffer = NULL;
-      prev = &BUF_MARKERS (b);
-
-      for (tail = BUF_MARKERS (b); tail; prev = &tail->next, tail = *prev)
-	if (marker == tail)
-	  {
-	    if (*prev == BUF_MARKERS (b))
-	      {
-		/* Deleting first marker from the buffer's chain.  Crash
-		   if new first marker in chain does not say it belongs
-		   to the same buffer, or at least that they have the same
-		   base buffer.  */
-		if (tail->next && b->text != tail->next->buffer->text)
-		  emacs_abort ();
-	      }
-	    *prev = tail->next;
-	    /* We have removed the marker from the chain;
-	       no need to scan the rest of the chain.  */
-	    break;
-	  }
-
-      /* Error if marker was not in it's chain.  */
-      eassert (tail != NULL);
     }
 }
 
@@ -694,9 +1467,10 @@ marker_position (Lisp_Object marker)
   if (!buf)
     error ("Marker does not point anywhere");
 
-  eassert (BUF_BEG (buf) <= m->charpos && m->charpos <= BUF_Z (buf));
+  ptrdiff_t charpos = marker_charpos (m);
+  eassert (BUF_BEG (buf) <= charpos && charpos <= BUF_Z (buf));
 
-  return m->charpos;
+  return charpos;
 }
 
 /* Return the byte position of marker MARKER, as a C integer.  */
@@ -710,9 +1484,10 @@ marker_byte_position (Lisp_Object marker)
   if (!buf)
     error ("Marker does not point anywhere");
 
-  eassert (BUF_BEG_BYTE (buf) <= m->bytepos && m->bytepos <= BUF_Z_BYTE (buf));
+  ptrdiff_t bytepos = marker_bytepos (m);
+  eassert (BUF_BEG_BYTE (buf) <= bytepos && bytepos <= BUF_Z_BYTE (buf));
 
-  return m->bytepos;
+  return bytepos;
 }
 
 DEFUN ("copy-marker", Fcopy_marker, Scopy_marker, 0, 2, 0,
@@ -764,16 +1539,13 @@ DEFUN ("buffer-has-markers-at", Fbuffer_has_markers_at, Sbuffer_has_markers_at,
        doc: /* Return t if there are markers pointing at POSITION in the current buffer.  */)
   (Lisp_Object position)
 {
-  register struct Lisp_Marker *tail;
+  register struct Lisp_Marker *m;
   register ptrdiff_t charpos;
 
   charpos = clip_to_bounds (BEG, XFIXNUM (position), Z);
 
-  for (tail = BUF_MARKERS (current_buffer); tail; tail = tail->next)
-    if (tail->charpos == charpos)
-      return Qt;
-
-  return Qnil;
+  m = marker_tree_first (current_buffer, charpos);
+  return m && m->charpos == charpos ? Qt : Qnil;
 }
 
 #ifdef MARKER_DEBUG
@@ -784,9 +1556,9 @@ DEFUN ("buffer-has-markers-at", Fbuffer_has_markers_at, Sbuffer_has_markers_at,
 count_markers (struct buffer *buf)
 {
   int total = 0;
-  struct Lisp_Marker *tail;
+  struct Lisp_Marker *m;
 
-  for (tail = BUF_MARKERS (buf); tail; tail = tail->next)
+  FOR_EACH_MARKER (buf, m)
     total++;
 
   return total;
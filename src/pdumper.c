@@ -2104,7 +2104,7 @@ dump_string (struct dump_context *ctx, const struct Lisp_String *string)
 static dump_off
 dump_marker (struct dump_context *ctx, const struct Lisp_Marker *marker)
 {
-#if CHECK_STRUCTS && !defined (HASH_Lisp_Marker_642DBAF866)
+#if CHECK_STRUCTS && !defined (HASH_Lisp_Marker_5011095A42)
 # error "Lisp_Marker changed. See CHECK_STRUCTS comment in config.h."
 #endif
 
@@ -2116,25 +2116,58 @@ dump_marker (struct dump_context *ctx, const struct Lisp_Marker *marker)
     {
       dump_field_lv_rawptr (ctx, out, marker, &marker->buffer,
 			    Lisp_Vectorlike, WEIGHT_NORMAL);
-      dump_field_lv_rawptr (ctx, out, marker, &marker->next,
+      dump_field_lv_rawptr (ctx, out, marker, &marker->parent,
+			    Lisp_Vectorlike, WEIGHT_NORMAL);
+      dump_field_lv_rawptr (ctx, out, marker, &marker->left,
+			    Lisp_Vectorlike, WEIGHT_STRONG);
+      dump_field_lv_rawptr (ctx, out, marker, &marker->right,
 			    Lisp_Vectorlike, WEIGHT_STRONG);
       DUMP_FIELD_COPY (out, marker, charpos);
       DUMP_FIELD_COPY (out, marker, bytepos);
+      DUMP_FIELD_COPY (out, marker, offset);
+      DUMP_FIELD_COPY (out, marker, offset_byte);
+      DUMP_FIELD_COPY (out, marker, otick);
     }
   return finish_dump_pvec (ctx, &out->header);
 }
 
+static dump_off
+dump_itree_node (struct dump_context *ctx, const struct itree_node *node)
+{
+#if CHECK_STRUCTS && !defined (HASH_itree_node_43E730D6FC)
+# error "itree_node changed. See CHECK_STRUCTS comment in config.h."
+#endif
+  /* The node is dumped on its own: overlays never belong to a buffer
+     in the dump (see dump_buffer), so it is not part of any tree.  */
+  struct itree_node out;
+  dump_object_start (ctx, &out, sizeof (out));
+  DUMP_FIELD_COPY (&out, node, begin);
+  DUMP_FIELD_COPY (&out, node, end);
+  DUMP_FIELD_COPY (&out, node, limit);
+  DUMP_FIELD_COPY (&out, node, offset);
+  DUMP_FIELD_COPY (&out, node, otick);
+  dump_field_lv (ctx, &out, node, &node->data, WEIGHT_STRONG);
+  DUMP_FIELD_COPY (&out, node, red);
+  DUMP_FIELD_COPY (&out, node, rear_advance);
+  DUMP_FIELD_COPY (&out, node, front_advance);
+  return dump_object_finish (ctx, &out, sizeof (out));
+}
+
 static dump_off
 dump_overlay (struct dump_context *ctx, const struct Lisp_Overlay *overlay)
 {
-#if CHECK_STRUCTS && !defined (HASH_Lisp_Overlay_72EADA9882)
+#if CHECK_STRUCTS && !defined (HASH_Lisp_Overlay_9608C0E9E5)
 # error "Lisp_Overlay changed. See CHECK_STRUCTS comment in config.h."
 #endif
   START_DUMP_PVEC (ctx, &overlay->header, struct Lisp_Overlay, out);
   dump_pseudovector_lisp_fields (ctx, &out->header, &overlay->header);
-  dump_field_lv_rawptr (ctx, out, overlay, &overlay->next,
-                        Lisp_Vectorlike, WEIGHT_STRONG);
-  return finish_dump_pvec (ctx, &out->header);
+  dump_field_fixup_later (ctx, out, overlay, &overlay->interval);
+  dump_off offset = finish_dump_pvec (ctx, &out->header);
+  dump_remember_fixup_ptr_raw
+    (ctx,
+     offset + dump_offsetof (struct Lisp_Overlay, interval),
+     dump_itree_node (ctx, overlay->interval));
+  return offset;
 }
 
 static void
@@ -2692,7 +2725,7 @@ dump_hash_table (struct dump_context *ctx,
 static dump_off
 dump_buffer (struct dump_context *ctx, const struct buffer *in_buffer)
 {
-#if CHECK_STRUCTS && !defined HASH_buffer_5DC36DBD42
+#if CHECK_STRUCTS && !defined HASH_buffer_04BE68F5A9
 # error "buffer changed. See CHECK_STRUCTS comment in config.h."
 #endif
   struct buffer munged_buffer = *in_buffer;
@@ -2758,6 +2791,9 @@ dump_buffer (struct dump_context *ctx, const struct buffer *in_buffer)
         dump_field_fixup_later (ctx, out, buffer, &buffer->own_text.intervals);
       dump_field_lv_rawptr (ctx, out, buffer, &buffer->own_text.markers,
                             Lisp_Vectorlike, WEIGHT_NORMAL);
+      DUMP_FIELD_COPY (out, buffer, own_text.markers_count);
+      DUMP_FIELD_COPY (out, buffer, own_text.markers_max_count);
+      DUMP_FIELD_COPY (out, buffer, own_text.markers_otick);
       DUMP_FIELD_COPY (out, buffer, own_text.inhibit_shrinking);
       DUMP_FIELD_COPY (out, buffer, own_text.redisplay);
     }
@@ -2799,18 +2835,17 @@ dump_buffer (struct dump_context *ctx, const struct buffer *in_buffer)
   out->newline_cache = NULL;
   out->width_run_cache = NULL;
   out->bidi_paragraph_cache = NULL;
+  out->parse_state_cache = NULL;
 
   DUMP_FIELD_COPY (out, buffer, prevent_redisplay_optimizations_p);
   DUMP_FIELD_COPY (out, buffer, clip_changed);
   DUMP_FIELD_COPY (out, buffer, inhibit_buffer_hooks);
 
-  dump_field_lv_rawptr (ctx, out, buffer, &buffer->overlays_before,
-                        Lisp_Vectorlike, WEIGHT_NORMAL);
-
-  dump_field_lv_rawptr (ctx, out, buffer, &buffer->overlays_after,
-                        Lisp_Vectorlike, WEIGHT_NORMAL);
+  /* Overlays are not worth serializing either; the buffers in the
+     dump don't have any.  */
+  eassert (buffer->overlays == NULL || buffer->overlays->root == NULL);
+  out->overlays = NULL;
 
-  DUMP_FIELD_COPY (out, buffer, overlay_center);
   dump_field_lv (ctx, out, buffer, &buffer->undo_list_,
                  WEIGHT_STRONG);
   dump_off offset = finish_dump_pvec (ctx, &out->header);
@@ -28,11 +28,14 @@
 #include "regex-emacs.h"
 
 #include <stdlib.h>
+#include <count-one-bits.h>
+#include <flexmember.h>
 
 #include "character.h"
 #include "buffer.h"
 #include "syntax.h"
 #include "category.h"
+#include "systime.h"
 
 /* Maximum number of duplicates an interval can allow.  Some systems
    define this in other header files, but we want our value, so remove
@@ -192,6 +195,17 @@ #define BYTEWIDTH 8 /* In bits.  */
 				     ptrdiff_t pos,
 				     struct re_registers *regs,
 				     ptrdiff_t stop);
+static struct re_dfa *re_dfa_for_search (struct re_pattern_buffer *,
+					 ptrdiff_t);
+static int re_dfa_scan (struct re_dfa *, struct re_pattern_buffer *,
+			re_char *, ptrdiff_t, re_char *, ptrdiff_t,
+			ptrdiff_t, ptrdiff_t, ptrdiff_t, ptrdiff_t *);
+static int re_dfa_check (struct re_dfa *, struct re_pattern_buffer *,
+			 re_char *, ptrdiff_t, re_char *, ptrdiff_t,
+			 ptrdiff_t, ptrdiff_t);
+static void free_re_dfa (struct re_pattern_buffer *);
+static void re_memo_reset (struct re_pattern_buffer *);
+static void free_re_memo (struct re_pattern_buffer *);
 
 /* These are the command codes that appear in compiled regular
    expressions.  Some opcodes are followed by argument bytes.  A
@@ -896,6 +910,12 @@ #define INIT_FAILURE_ALLOC 20
 
 #define FAIL_STACK_EMPTY()     (fail_stack.frame == 0)
 
+/* The number of failure points pushed, and the most items that were on
+   the failure stack at once, since the search or match started.  They
+   are updated only when 'regexp-profile' is non-nil.  */
+static intmax_t re_profile_pushes;
+static ptrdiff_t re_profile_max_stack;
+
 
 /* Define macros to initialize and free the failure stack.  */
 
@@ -1052,6 +1072,8 @@ #define CHECK_INFINITE_LOOP(pat_cur, string_place)			\
       failure = NEXT_FAILURE_HANDLE(failure);				\
     }									\
   DEBUG_PRINT ("  Other string: %p\n", FAILURE_STR (failure));		\
+  if (memo)								\
+    re_memo_taint (memo, failure);					\
 } while (false)
 
 /* Push the information about the state we will need
@@ -1089,6 +1111,13 @@ #define PUSH_FAILURE_POINT(pattern, string_place)			\
 									\
   /* Close the frame by moving the frame pointer past it.  */		\
   fail_stack.frame = fail_stack.avail;					\
+									\
+  if (profiling)							\
+    {									\
+      re_profile_pushes++;						\
+      if (re_profile_max_stack < fail_stack.avail)			\
+	re_profile_max_stack = fail_stack.avail;			\
+    }									\
 } while (false)
 
 /* Estimate the size of data pushed by a typical failure stack entry.
@@ -1773,6 +1802,11 @@ regex_compile (re_char *pattern, ptrdiff_t size,
   range_table_work.allocated = 0;
 
   /* Initialize the pattern buffer.  */
+  free_re_dfa (bufp);
+  free_re_memo (bufp);
+  bufp->dfa_searches = 0;
+  bufp->backrefs = 0;
+  bufp->counters = false;
   bufp->fastmap_accurate = false;
   bufp->used_syntax = false;
 
@@ -2424,6 +2458,7 @@ regex_compile (re_char *pattern, ptrdiff_t size,
 				      b + 5 + nbytes,
 				      lower_bound);
 			b += 5;
+			bufp->counters = true;
 
 			/* Code to initialize the lower bound.  Insert
 			   before the 'succeed_n'.  The '5' is the last two
@@ -2453,6 +2488,7 @@ regex_compile (re_char *pattern, ptrdiff_t size,
 			STORE_JUMP2 (jump_n, b, laststart + startoffset,
 				     upper_bound - 1);
 			b += 5;
+			bufp->counters = true;
 
 			/* The location we want to set is the second
 			   parameter of the 'jump_n'; that is 'b-2' as
@@ -2577,6 +2613,7 @@ regex_compile (re_char *pattern, ptrdiff_t size,
 
 		laststart = b;
 		BUF_PUSH_2 (duplicate, reg);
+		bufp->backrefs |= 1 << reg;
 	      }
 	      break;
 
@@ -3129,6 +3166,35 @@ re_compile_fastmap (struct re_pattern_buffer *bufp)
   analysis = analyze_first (bufp->buffer, bufp->buffer + bufp->used,
 			    fastmap, RE_MULTIBYTE_P (bufp));
   bufp->can_be_null = (analysis != 0);
+
+  int nbytes = 0;
+  bufp->first_byte = -1;
+  bufp->fastmap_leading_codes = true;
+  for (int i = 0; i < 1 << BYTEWIDTH; i++)
+    if (fastmap[i])
+      {
+	nbytes++;
+	bufp->first_byte = i;
+	if (! CHAR_HEAD_P (i))
+	  bufp->fastmap_leading_codes = false;
+      }
+  if (nbytes != 1)
+    bufp->first_byte = -1;
+
+  /* Look for the literal string that the pattern starts with, maybe
+     inside groups.  */
+  re_char *p = bufp->buffer, *pend = p + bufp->used;
+  while (p < pend && (re_opcode_t) *p == start_memory)
+    p += 2;
+  bufp->literal = bufp->literal_length = bufp->literal_ascii_length = 0;
+  if (p < pend && (re_opcode_t) *p == exactn)
+    {
+      bufp->literal = p + 2 - bufp->buffer;
+      bufp->literal_length = p[1];
+      while (bufp->literal_ascii_length < p[1]
+	     && ASCII_CHAR_P (p[2 + bufp->literal_ascii_length]))
+	bufp->literal_ascii_length++;
+    }
 } /* re_compile_fastmap */
 
 /* Set REGS to hold NUM_REGS registers, storing them in STARTS and
@@ -3162,6 +3228,19 @@ re_set_registers (struct re_pattern_buffer *bufp, struct re_registers *regs,
       regs->start = regs->end = 0;
     }
 }
+
+/* Free the memory that BUFP allocated for its compiled pattern, its
+   DFA and its memo.  */
+
+void
+re_free_pattern (struct re_pattern_buffer *bufp)
+{
+  free_re_dfa (bufp);
+  free_re_memo (bufp);
+  xfree (bufp->buffer);
+  bufp->buffer = NULL;
+  bufp->allocated = bufp->used = 0;
+}
 
 /* Searching routines.  */
 
@@ -3180,6 +3259,95 @@ re_search (struct re_pattern_buffer *bufp, const char *string, ptrdiff_t size,
 #define POS_ADDR_VSTRING(POS)					\
   (((POS) >= size1 ? string2 - size1 : string1) + (POS))
 
+/* Return the length of the bytes that every match of BUFP starts
+   with, that a search can look for in the text, and store them in
+   *LITERAL; BYTE is where to store a single byte.  Return 0 if there
+   are no such bytes.  */
+static int
+re_literal_prefix (struct re_pattern_buffer *bufp, unsigned char *byte,
+		   re_char **literal)
+{
+  bool multibyte = RE_TARGET_MULTIBYTE_P (bufp);
+
+  if (!NILP (bufp->translate) || !bufp->fastmap_accurate
+      || bufp->can_be_null)
+    return 0;
+
+  /* The bytes of the pattern are those of the text only for ASCII,
+     unless both are multibyte.  */
+  int len = (multibyte == RE_MULTIBYTE_P (bufp)
+	     ? bufp->literal_length : bufp->literal_ascii_length);
+  if (len > 1)
+    {
+      *literal = bufp->buffer + bufp->literal;
+      return len;
+    }
+  if (bufp->first_byte >= 0
+      && (!multibyte || CHAR_HEAD_P (bufp->first_byte)))
+    {
+      *byte = bufp->first_byte;
+      *literal = byte;
+      return 1;
+    }
+  return 0;
+}
+
+/* Return the first position from STARTPOS to STARTPOS + RANGE where
+   the LEN bytes at LITERAL occur in the virtual concatenation of
+   STRING1 and STRING2, or -1 if there is none.  This uses memchr and
+   memmem, which are much faster than looking at each byte in the
+   fastmap.  */
+static ptrdiff_t
+re_search_literal (re_char *literal, int len,
+		   re_char *string1, ptrdiff_t size1,
+		   re_char *string2, ptrdiff_t size2,
+		   ptrdiff_t startpos, ptrdiff_t range)
+{
+  ptrdiff_t pos = startpos, last = startpos + range;
+  re_char *found;
+
+  if (pos < size1)
+    {
+      /* The occurrences inside STRING1.  */
+      ptrdiff_t end = min (size1, last + len);
+      if (end - pos >= len)
+	{
+	  found = (len == 1
+		   ? memchr (string1 + pos, *literal, end - pos)
+		   : memmem (string1 + pos, end - pos, literal, len));
+	  if (found)
+	    return found - string1;
+	}
+
+      /* Those that straddle the two strings.  */
+      for (pos = max (pos, size1 - len + 1); pos < size1 && pos <= last;
+	   pos++)
+	{
+	  ptrdiff_t i;
+	  for (i = 0; i < len && pos + i < size1 + size2; i++)
+	    if (*POS_ADDR_VSTRING (pos + i) != literal[i])
+	      break;
+	  if (i == len)
+	    return pos;
+	}
+    }
+
+  /* Those inside STRING2.  */
+  if (pos <= last)
+    {
+      ptrdiff_t from = pos - size1, end = min (size2, last - size1 + len);
+      if (end - from >= len)
+	{
+	  found = (len == 1
+		   ? memchr (string2 + from, *literal, end - from)
+		   : memmem (string2 + from, end - from, literal, len));
+	  if (found)
+	    return found - string2 + size1;
+	}
+    }
+  return -1;
+}
+
 /* Using the compiled pattern in BUFP->buffer, first tries to match the
    virtual concatenation of STRING1 and STRING2, starting first at index
    STARTPOS, then at STARTPOS + 1, and so on.
@@ -3201,11 +3369,12 @@ #define POS_ADDR_VSTRING(POS)					\
    found, -1 if no match, or -2 if error (such as failure
    stack overflow).  */
 
-ptrdiff_t
-re_search_2 (struct re_pattern_buffer *bufp, const char *str1, ptrdiff_t size1,
-	     const char *str2, ptrdiff_t size2,
-	     ptrdiff_t startpos, ptrdiff_t range,
-	     struct re_registers *regs, ptrdiff_t stop)
+static ptrdiff_t
+re_search_2_internal (struct re_pattern_buffer *bufp,
+		      const char *str1, ptrdiff_t size1,
+		      const char *str2, ptrdiff_t size2,
+		      ptrdiff_t startpos, ptrdiff_t range,
+		      struct re_registers *regs, ptrdiff_t stop)
 {
   ptrdiff_t val;
   re_char *string1 = (re_char *) str1;
@@ -3253,6 +3422,10 @@ re_search_2 (struct re_pattern_buffer *bufp, const char *str1, ptrdiff_t size1,
   if (fastmap && !bufp->fastmap_accurate)
     re_compile_fastmap (bufp);
 
+  /* The states that fail from one starting position fail from the
+     others too, but not in other searches.  */
+  re_memo_reset (bufp);
+
   /* See whether the pattern is anchored.  */
   anchored_start = (bufp->buffer[0] == begline);
 
@@ -3263,6 +3436,31 @@ re_search_2 (struct re_pattern_buffer *bufp, const char *str1, ptrdiff_t size1,
     SETUP_SYNTAX_TABLE_FOR_OBJECT (re_match_object, charpos, 1);
   }
 
+  /* When searching forward, let the DFA skip the places before the
+     first one where a match can start, or fail right away if there is
+     none.  The backtracking matcher is still what finds the match and
+     its registers.  */
+  struct re_dfa *dfa = re_dfa_for_search (bufp, range);
+  unsigned char literal_byte;
+  re_char *literal = NULL;
+  int literal_len = (range > 0 && fastmap
+		     ? re_literal_prefix (bufp, &literal_byte, &literal) : 0);
+  if (dfa && range > 0 && !literal_len)
+    {
+      ptrdiff_t restart = startpos;
+      int found = re_dfa_scan (dfa, bufp, string1, size1, string2, size2,
+			       startpos, startpos + range, stop, &restart);
+      if (found == 0)
+	return -1;
+      if (found < 0)
+	dfa = NULL;
+      else
+	{
+	  range -= restart - startpos;
+	  startpos = restart;
+	}
+    }
+
   /* Loop through the string, looking for a place to start matching.  */
   for (;;)
     {
@@ -3278,6 +3476,18 @@ re_search_2 (struct re_pattern_buffer *bufp, const char *str1, ptrdiff_t size1,
 	    goto advance;
 	}
 
+      /* If all matches start with the same bytes, look for them.  */
+      if (literal_len && startpos < total_size)
+	{
+	  ptrdiff_t next = re_search_literal (literal, literal_len,
+					      string1, size1, string2, size2,
+					      startpos, range);
+	  if (next < 0)
+	    return -1;
+	  range -= next - startpos;
+	  startpos = next;
+	}
+
       /* If a fastmap is supplied, skip quickly over characters that
 	 cannot be the start of a match.  If the pattern can match the
 	 null string, however, we don't need to skip characters; we want
@@ -3330,7 +3540,7 @@ re_search_2 (struct re_pattern_buffer *bufp, const char *str1, ptrdiff_t size1,
 		}
 	      else
 		{
-		  if (multibyte)
+		  if (multibyte && !bufp->fastmap_leading_codes)
 		    while (range > lim)
 		      {
 			int buf_charlen;
@@ -3378,6 +3588,17 @@ re_search_2 (struct re_pattern_buffer *bufp, const char *str1, ptrdiff_t size1,
 	  && !bufp->can_be_null)
 	return -1;
 
+      /* Don't run the matcher where the DFA says it would fail.  */
+      if (dfa)
+	{
+	  int found = re_dfa_check (dfa, bufp, string1, size1,
+				    string2, size2, startpos, stop);
+	  if (found == 0)
+	    goto advance;
+	  if (found < 0)
+	    dfa = NULL;
+	}
+
       val = re_match_2_internal (bufp, string1, size1, string2, size2,
 				 startpos, regs, stop);
 
@@ -3428,7 +3649,50 @@ re_search_2 (struct re_pattern_buffer *bufp, const char *str1, ptrdiff_t size1,
 	}
     }
   return -1;
-} /* re_search_2 */
+} /* re_search_2_internal */
+
+/* Add the cost of a search or match with BUFP that started at START and
+   went over BYTES bytes of text to the profile of BUFP.  */
+static void
+re_profile_add (struct re_pattern_buffer *bufp, struct timespec start,
+		ptrdiff_t bytes)
+{
+  struct re_profile *profile = &bufp->profile;
+  profile->calls++;
+  profile->bytes += bytes;
+  profile->pushes += re_profile_pushes;
+  profile->max_stack = max (profile->max_stack, re_profile_max_stack);
+  profile->time = timespec_add (profile->time,
+				timespec_sub (current_timespec (), start));
+}
+
+/* Like re_search_2_internal, but add the cost of the search to the
+   profile of BUFP if 'regexp-profile' is non-nil.  */
+
+ptrdiff_t
+re_search_2 (struct re_pattern_buffer *bufp, const char *str1, ptrdiff_t size1,
+	     const char *str2, ptrdiff_t size2,
+	     ptrdiff_t startpos, ptrdiff_t range,
+	     struct re_registers *regs, ptrdiff_t stop)
+{
+  if (!regexp_profile)
+    return re_search_2_internal (bufp, str1, size1, str2, size2,
+				 startpos, range, regs, stop);
+
+  struct timespec start = current_timespec ();
+  re_profile_pushes = re_profile_max_stack = 0;
+  ptrdiff_t val = re_search_2_internal (bufp, str1, size1, str2, size2,
+					startpos, range, regs, stop);
+  /* Count the text up to the end of the match, or the whole range if
+     there is none.  */
+  ptrdiff_t endpos = clip_to_bounds (0, startpos + range, size1 + size2);
+  ptrdiff_t bytes = (val < 0 ? eabs (endpos - startpos)
+		     : (eabs (val - startpos)
+			+ (regs && regs->num_regs > 0
+			   ? regs->end[0] - regs->start[0] : 0)));
+  re_profile_add (bufp, start, bytes);
+  return val;
+}
 
 /* Declarations and macros for re_match_2.  */
 
@@ -3457,6 +3721,20 @@ #define PREFETCH()							\
       dend = end_match_2;						\
     }
 
+/* Like PREFETCH, but go back to DFAIL before failing, as the operations
+   that match several characters must do when they fail halfway.  */
+#define PREFETCH_ROLLBACK()						\
+  while (d == dend)							\
+    {									\
+      if (dend == end_match_2)						\
+	{								\
+	  d = dfail;							\
+	  goto fail;							\
+	}								\
+      d = string2;							\
+      dend = end_match_2;						\
+    }
+
 /* Call before fetching a char with *d if you already checked other limits.
    This is meant for use in lookahead operations like wordend, etc..
    where we might need to look at parts of the string that might be
@@ -3823,6 +4101,1139 @@ mutually_exclusive_p (struct re_pattern_buffer *bufp, re_char *p1,
   return false;
 }
 
+
+/* The lazy DFA.
+
+   Searching with the backtracking matcher means running it at each
+   place a match could start, and each run can look at a lot of text,
+   or even exhaust the failure stack, before it gives up.  For patterns
+   without back references or counted repetitions, re_search_2 first
+   asks a deterministic automaton where a match can start, in a single
+   pass over the text, and runs the matcher only there.
+
+   The automaton is the subset construction over the positions of the
+   compiled pattern, built lazily: a state is the set of positions the
+   matcher can be at after reading some text (its "kernel"), together
+   with what the zero-width operations need to know about the last
+   character read.  A state's transitions are computed the first time
+   they are taken and then cached in the state, so that most
+   characters cost a table lookup.
+
+   A transition depends only on the state, the character and its
+   syntax class, so cached transitions remain valid whatever the
+   syntax table.  Where the automaton cannot tell whether a zero-width
+   operation succeeds, such as a word boundary between two non-ASCII
+   word characters (which depends on the category table) or anything
+   after STOP, it assumes that it does.  So it may let the matcher run
+   where it then fails, but it never skips a place where the matcher
+   would succeed.  */
+
+enum
+  {
+    /* Don't use the DFA for searches that try fewer starting
+       positions than this.  */
+    RE_DFA_MIN_RANGE = 32,
+
+    /* Many patterns are compiled for a single search over a short
+       range, which would not repay building a DFA.  Build one only for
+       the searches after this many, or for a search that tries at
+       least RE_DFA_EAGER_RANGE starting positions.  */
+    RE_DFA_MIN_SEARCHES = 1,
+    RE_DFA_EAGER_RANGE = 4096,
+
+    /* After this many checks of single starting positions, stop
+       checking if fewer than one in RE_DFA_MIN_REJECT_RATIO of them
+       were rejected.  */
+    RE_DFA_CHECK_TRIAL = 64,
+    RE_DFA_MIN_REJECT_RATIO = 16,
+
+    /* The maximum number of states of a DFA.  When a DFA needs more,
+       all its states are discarded and built again as needed.  */
+    RE_DFA_MAX_STATES = 128,
+
+    /* If a DFA discards its states again before it scanned this many
+       bytes per state, it is given up on.  */
+    RE_DFA_MIN_BYTES_PER_STATE = 64,
+
+    /* The number of hash buckets for states, and of cached transitions
+       on characters that don't fit in a state's table.  */
+    RE_DFA_BUCKETS = 64,
+    RE_DFA_WIDE_CACHE = 256
+  };
+
+/* What the zero-width operations know about a character, or about the
+   position before or after it.  */
+enum
+  {
+    DFA_BEG = 1,		/* The beginning of the text.  */
+    DFA_END = 2,		/* The end of the text.  */
+    DFA_UNKNOWN = 4,		/* Past STOP: anything goes.  */
+    DFA_NEWLINE = 8,		/* A newline.  */
+    DFA_WORD = 16,		/* Word syntax.  */
+    DFA_SYMBOL = 32,		/* Word or symbol syntax.  */
+    DFA_WIDE = 64,		/* A character that WORD_BOUNDARY_P
+				   may have to look up.  */
+    DFA_RAW = 128		/* A byte above 127 in unibyte text.  */
+  };
+
+struct re_dfa_state
+{
+  /* The state reached by reading each character below 256, or NULL if
+     it wasn't computed yet.  NEXT_SYNTAX is the syntax key that the
+     transition was computed for.  */
+  struct re_dfa_state *next[1 << BYTEWIDTH];
+  unsigned char next_syntax[1 << BYTEWIDTH];
+
+  /* Next state in the same hash bucket.  */
+  struct re_dfa_state *chain;
+  unsigned hash;
+
+  /* What the zero-width operations need to know of the previous
+     character, as DFA_* flags.  */
+  unsigned char context;
+
+  /* True if a match can also start at the current position, when
+     looking for one anywhere in a range.  */
+  bool_bf inject : 1;
+
+  /* Whether the pattern matches at the end of the text, and at STOP
+     before the end; -1 if not known yet.  */
+  signed char accept_at_end[2];
+
+  /* The positions in the compiled pattern, in increasing order.  */
+  int nkernel;
+  int kernel[FLEXIBLE_ARRAY_MEMBER];
+};
+
+/* A cached transition on a character of 256 or more.  */
+struct re_dfa_wide
+{
+  struct re_dfa_state *from, *to;
+  int c;
+  unsigned char syntax;
+};
+
+struct re_dfa
+{
+  /* True if the pattern can be run by a DFA.  */
+  bool_bf usable : 1;
+
+  /* True if the pattern looks at the syntax of the text, and if one of
+     its character classes looks at the syntax of translated
+     characters.  */
+  bool_bf syntax : 1;
+  bool_bf class_syntax : 1;
+
+  /* Whether the states were computed for multibyte text.  */
+  bool_bf target_multibyte : 1;
+
+  /* The DFA_* flags that the zero-width operations of the pattern look
+     at in the previous character.  */
+  unsigned char context_mask;
+
+  /* For each position of a character in an exactn, the end of that
+     exactn; 0 for other positions.  */
+  int *exact_end;
+
+  /* Scratch space, and a mark for each position of the pattern.  */
+  int *stack, *set;
+  unsigned *mark, generation;
+
+  int nstates, nflushes;
+
+  /* The number of single starting positions that were checked, and
+     that were rejected.  */
+  int checks, rejects;
+
+  /* The number of bytes scanned since the states were last
+     discarded.  */
+  ptrdiff_t scanned;
+
+  struct re_dfa_state *buckets[RE_DFA_BUCKETS];
+  struct re_dfa_wide wide[RE_DFA_WIDE_CACHE];
+};
+
+/* The results of a transition that accepts, and of one after which no
+   match is possible.  */
+static struct re_dfa_state re_dfa_accept, re_dfa_dead;
+
+/* Return the destination of the jump at POS in PATTERN.  A loop that
+   on_failure_jump_smart turned into an on_failure_keep_string_jump
+   loop jumps back past that operation; return the operation instead,
+   since that is where the loop can be left.  */
+static int
+re_dfa_jump_target (re_char *pattern, int pos)
+{
+  int mcnt, dest;
+  EXTRACT_NUMBER (mcnt, pattern + pos + 1);
+  dest = pos + 3 + mcnt;
+  if (dest >= 3
+      && (re_opcode_t) pattern[dest - 3] == on_failure_keep_string_jump)
+    {
+      EXTRACT_NUMBER (mcnt, pattern + dest - 2);
+      if (dest + mcnt == pos + 3)
+	return dest - 3;
+    }
+  return dest;
+}
+
+/* Return a new generation for the marks of DFA.  */
+static unsigned
+re_dfa_new_generation (struct re_dfa *dfa, int size)
+{
+  if (++dfa->generation == 0)
+    {
+      memset (dfa->mark, 0, size * sizeof *dfa->mark);
+      dfa->generation = 1;
+    }
+  return dfa->generation;
+}
+
+/* Look at the operations of BUFP that can be reached, and set up DFA
+   for them.  Return false if one of them can't be run by a DFA.  */
+static bool
+re_dfa_analyze (struct re_dfa *dfa, struct re_pattern_buffer *bufp)
+{
+  re_char *pattern = bufp->buffer;
+  int used = bufp->used, sp = 0;
+  unsigned gen = re_dfa_new_generation (dfa, used + 1);
+  int *stack = dfa->stack;
+
+#define DFA_PUSH(pos)					\
+  do {							\
+    int pos_ = (pos);					\
+    if (dfa->mark[pos_] != gen)				\
+      {							\
+	dfa->mark[pos_] = gen;				\
+	stack[sp++] = pos_;				\
+      }							\
+  } while (false)
+
+  DFA_PUSH (0);
+  while (sp > 0)
+    {
+      int pos = stack[--sp], mcnt, end;
+      re_char *p = pattern + pos;
+
+      if (pos == used)
+	continue;
+      switch (*p)
+	{
+	case succeed:
+	  break;
+
+	case no_op:
+	case begline:
+	case endline:
+	case begbuf:
+	case endbuf:
+	case wordbeg:
+	case wordend:
+	case wordbound:
+	case notwordbound:
+	case symbeg:
+	case symend:
+	  switch (*p)
+	    {
+	    case begline:
+	      dfa->context_mask |= DFA_BEG | DFA_NEWLINE;
+	      break;
+	    case begbuf:
+	      dfa->context_mask |= DFA_BEG;
+	      break;
+	    case wordbeg:
+	    case wordend:
+	    case wordbound:
+	    case notwordbound:
+	      dfa->syntax = true;
+	      dfa->context_mask |= DFA_BEG | DFA_WORD | DFA_WIDE;
+	      break;
+	    case symbeg:
+	    case symend:
+	      dfa->syntax = true;
+	      dfa->context_mask |= DFA_BEG | DFA_SYMBOL | DFA_RAW;
+	      break;
+	    default:
+	      break;
+	    }
+	  DFA_PUSH (pos + 1);
+	  break;
+
+	case exactn:
+	  end = pos + 2 + p[1];
+	  for (int q = pos + 2; q < end;
+	       q += RE_MULTIBYTE_P (bufp) ? BYTES_BY_CHAR_HEAD (pattern[q]) : 1)
+	    dfa->exact_end[q] = end;
+	  DFA_PUSH (end);
+	  break;
+
+	case charset:
+	case charset_not:
+	  if (CHARSET_RANGE_TABLE_EXISTS_P (p))
+	    {
+	      int class_bits = CHARSET_RANGE_TABLE_BITS (p);
+	      /* These depend on the case table.  */
+	      if (class_bits & (BIT_UPPER | BIT_LOWER))
+		return false;
+	      if (class_bits & (BIT_SPACE | BIT_WORD | BIT_PUNCT))
+		dfa->syntax = dfa->class_syntax = true;
+	    }
+	  FALLTHROUGH;
+	case anychar:
+	  DFA_PUSH (skip_one_char (p) - pattern);
+	  break;
+
+	case syntaxspec:
+	case notsyntaxspec:
+	  dfa->syntax = true;
+	  FALLTHROUGH;
+	case start_memory:
+	case stop_memory:
+	  DFA_PUSH (pos + 2);
+	  break;
+
+	case jump:
+	  DFA_PUSH (re_dfa_jump_target (pattern, pos));
+	  break;
+
+	case on_failure_jump:
+	case on_failure_keep_string_jump:
+	case on_failure_jump_loop:
+	case on_failure_jump_nastyloop:
+	case on_failure_jump_smart:
+	  EXTRACT_NUMBER (mcnt, p + 1);
+	  DFA_PUSH (pos + 3);
+	  DFA_PUSH (pos + 3 + mcnt);
+	  break;
+
+	default:
+	  /* Back references, counted repetitions, \= and categories.  */
+	  return false;
+	}
+    }
+  return true;
+}
+
+/* Return a DFA for BUFP.  */
+static struct re_dfa *
+make_re_dfa (struct re_pattern_buffer *bufp)
+{
+  struct re_dfa *dfa = xzalloc (sizeof *dfa);
+  if (bufp->used < INT_MAX / 2)
+    {
+      ptrdiff_t size = bufp->used + 1;
+      dfa->exact_end = xzalloc (size * sizeof *dfa->exact_end);
+      dfa->stack = xnmalloc (size, sizeof *dfa->stack);
+      dfa->set = xnmalloc (size, sizeof *dfa->set);
+      dfa->mark = xzalloc (size * sizeof *dfa->mark);
+      dfa->usable = re_dfa_analyze (dfa, bufp);
+    }
+  return dfa;
+}
+
+/* Discard all the states of DFA.  */
+static void
+re_dfa_flush (struct re_dfa *dfa)
+{
+  for (int i = 0; i < RE_DFA_BUCKETS; i++)
+    {
+      struct re_dfa_state *s, *next;
+      for (s = dfa->buckets[i]; s; s = next)
+	{
+	  next = s->chain;
+	  xfree (s);
+	}
+      dfa->buckets[i] = NULL;
+    }
+  memset (dfa->wide, 0, sizeof dfa->wide);
+  dfa->nstates = 0;
+  dfa->nflushes++;
+}
+
+static void
+free_re_dfa (struct re_pattern_buffer *bufp)
+{
+  struct re_dfa *dfa = bufp->dfa;
+  if (dfa)
+    {
+      re_dfa_flush (dfa);
+      xfree (dfa->exact_end);
+      xfree (dfa->stack);
+      xfree (dfa->set);
+      xfree (dfa->mark);
+      xfree (dfa);
+      bufp->dfa = NULL;
+    }
+}
+
+/* Return the DFA to use for a search in BUFP that tries RANGE
+   starting positions, or NULL if the search should not use one.  */
+static struct re_dfa *
+re_dfa_for_search (struct re_pattern_buffer *bufp, ptrdiff_t range)
+{
+  if (!regexp_use_dfa || eabs (range) < RE_DFA_MIN_RANGE)
+    return NULL;
+  if (!bufp->dfa)
+    {
+      if (bufp->dfa_searches < RE_DFA_MIN_SEARCHES
+	  && eabs (range) < RE_DFA_EAGER_RANGE)
+	{
+	  bufp->dfa_searches++;
+	  return NULL;
+	}
+      bufp->dfa = make_re_dfa (bufp);
+    }
+
+  struct re_dfa *dfa = bufp->dfa;
+  if (!dfa->usable
+      /* With syntax-table properties, the syntax of a character
+	 depends on where it is.  */
+      || (dfa->syntax && parse_sexp_lookup_properties))
+    return NULL;
+  if (dfa->target_multibyte != RE_TARGET_MULTIBYTE_P (bufp))
+    {
+      re_dfa_flush (dfa);
+      dfa->target_multibyte = RE_TARGET_MULTIBYTE_P (bufp);
+    }
+  return dfa;
+}
+
+/* qsort comparison function for pattern positions.  */
+static int
+re_dfa_compare_positions (const void *a, const void *b)
+{
+  int x = *(const int *) a, y = *(const int *) b;
+  return (x > y) - (x < y);
+}
+
+/* Return the state of DFA with the N positions of KERNEL, CONTEXT and
+   INJECT, making it if necessary.  KERNEL must not point into a
+   state.  */
+static struct re_dfa_state *
+re_dfa_intern (struct re_dfa *dfa, int *kernel, int n, int context,
+	       bool inject)
+{
+  struct re_dfa_state *s;
+  unsigned hash = context << 1 | inject;
+
+  for (int i = 0; i < n; i++)
+    hash = hash * 31 + kernel[i];
+  for (s = dfa->buckets[hash % RE_DFA_BUCKETS]; s; s = s->chain)
+    if (s->hash == hash && s->nkernel == n && s->context == context
+	&& s->inject == inject
+	&& memcmp (s->kernel, kernel, n * sizeof *kernel) == 0)
+      return s;
+
+  if (dfa->nstates == RE_DFA_MAX_STATES)
+    re_dfa_flush (dfa);
+  s = xmalloc (FLEXSIZEOF (struct re_dfa_state, kernel,
+			   n * sizeof *kernel));
+  memset (s->next, 0, sizeof s->next);
+  memset (s->next_syntax, 0, sizeof s->next_syntax);
+  s->hash = hash;
+  s->context = context;
+  s->inject = inject;
+  s->accept_at_end[0] = s->accept_at_end[1] = -1;
+  s->nkernel = n;
+  memcpy (s->kernel, kernel, n * sizeof *kernel);
+  s->chain = dfa->buckets[hash % RE_DFA_BUCKETS];
+  dfa->buckets[hash % RE_DFA_BUCKETS] = s;
+  dfa->nstates++;
+  return s;
+}
+
+/* Return the key under which the transitions of DFA on the character
+   C are cached, besides C itself: what the pattern can see of its
+   syntax.  */
+static int
+re_dfa_syntax (struct re_dfa *dfa, struct re_pattern_buffer *bufp, int c)
+{
+  if (!dfa->syntax)
+    return 0;
+
+  Lisp_Object translate = bufp->translate;
+  bool target_multibyte = RE_TARGET_MULTIBYTE_P (bufp);
+  int syntax = SYNTAX (target_multibyte ? c : RE_CHAR_TO_MULTIBYTE (c));
+
+  /* Character classes look at the syntax of the translated
+     character.  */
+  if (dfa->class_syntax && target_multibyte)
+    syntax |= SYNTAX (TRANSLATE (c)) << 4;
+  return syntax;
+}
+
+/* Return the DFA_* flags that describe the character C, whose syntax
+   key is SYNTAX.  */
+static int
+re_dfa_context (struct re_pattern_buffer *bufp, int c, int syntax)
+{
+  int context = c == '\n' ? DFA_NEWLINE : 0;
+
+  switch (syntax & 0xf)
+    {
+    case Sword:
+      context |= DFA_WORD | DFA_SYMBOL;
+      break;
+    case Ssymbol:
+      context |= DFA_SYMBOL;
+      break;
+    default:
+      break;
+    }
+  if (RE_TARGET_MULTIBYTE_P (bufp))
+    {
+      if (c >= 1 << BYTEWIDTH)
+	context |= DFA_WIDE;
+    }
+  else if (c >= 0x80)
+    context |= DFA_WIDE | DFA_RAW;
+  return context;
+}
+
+/* Return true if the zero-width operation OP succeeds between a
+   character described by PREV and one described by NEXT, or if it
+   can't tell.  */
+static bool
+re_dfa_assert_p (re_opcode_t op, int prev, int next)
+{
+  bool w1 = prev & DFA_WORD, w2 = next & DFA_WORD;
+  bool s1 = prev & DFA_SYMBOL, s2 = next & DFA_SYMBOL;
+  /* Whether WORD_BOUNDARY_P would have to be looked up.  */
+  bool word_unsure = w1 && w2 && ((prev | next) & DFA_WIDE);
+  /* The symbol operations use the syntax of raw bytes as such.  */
+  bool symbol_unsure = (prev | next) & DFA_RAW;
+
+  if (next & DFA_UNKNOWN)
+    return true;
+  switch (op)
+    {
+    case begline:
+      return prev & (DFA_BEG | DFA_NEWLINE);
+    case endline:
+      return next & (DFA_END | DFA_NEWLINE);
+    case begbuf:
+      return prev & DFA_BEG;
+    case endbuf:
+      return next & DFA_END;
+    case wordbound:
+    case notwordbound:
+      if ((prev & DFA_BEG) || (next & DFA_END))
+	return op == wordbound;
+      return word_unsure || (w1 != w2) == (op == wordbound);
+    case wordbeg:
+      return !(next & DFA_END) && w2 && (!w1 || word_unsure);
+    case wordend:
+      return !(prev & DFA_BEG) && w1 && (!w2 || word_unsure);
+    case symbeg:
+      return !(next & DFA_END) && (symbol_unsure || (s2 && !s1));
+    case symend:
+      return !(prev & DFA_BEG) && (symbol_unsure || (s1 && !s2));
+    default:
+      emacs_abort ();
+    }
+}
+
+/* Follow the operations that don't consume text from the positions of
+   S, between a previous character described by S's context and a next
+   one described by NEXT.  Store the positions of the operations that
+   consume a character in DFA->set, and return their number; return -1
+   instead if the pattern can match there.  */
+static int
+re_dfa_closure (struct re_dfa *dfa, struct re_pattern_buffer *bufp,
+		struct re_dfa_state *s, int next)
+{
+  re_char *pattern = bufp->buffer;
+  int used = bufp->used, sp = 0, n = 0;
+  unsigned gen = re_dfa_new_generation (dfa, used + 1);
+  int *stack = dfa->stack;
+
+  for (int i = 0; i < s->nkernel; i++)
+    DFA_PUSH (s->kernel[i]);
+  if (s->inject)
+    DFA_PUSH (0);
+
+  while (sp > 0)
+    {
+      int pos = stack[--sp], mcnt;
+      re_char *p = pattern + pos;
+
+      if (pos == used)
+	return -1;
+      if (dfa->exact_end[pos])
+	{
+	  dfa->set[n++] = pos;
+	  continue;
+	}
+      switch (*p)
+	{
+	case succeed:
+	  return -1;
+
+	case no_op:
+	  DFA_PUSH (pos + 1);
+	  break;
+
+	case exactn:
+	  DFA_PUSH (pos + 2);
+	  break;
+
+	case anychar:
+	case charset:
+	case charset_not:
+	case syntaxspec:
+	case notsyntaxspec:
+	  dfa->set[n++] = pos;
+	  break;
+
+	case start_memory:
+	case stop_memory:
+	  DFA_PUSH (pos + 2);
+	  break;
+
+	case jump:
+	  DFA_PUSH (re_dfa_jump_target (pattern, pos));
+	  break;
+
+	case on_failure_jump:
+	case on_failure_keep_string_jump:
+	case on_failure_jump_loop:
+	case on_failure_jump_nastyloop:
+	case on_failure_jump_smart:
+	  EXTRACT_NUMBER (mcnt, p + 1);
+	  DFA_PUSH (pos + 3);
+	  DFA_PUSH (pos + 3 + mcnt);
+	  break;
+
+	default:
+	  if (re_dfa_assert_p (*p, s->context, next))
+	    DFA_PUSH (pos + 1);
+	  break;
+	}
+    }
+  return n;
+}
+
+/* Return the position after the operation at POS if it matches the
+   character C of the text, and -1 if it doesn't.  This mirrors what
+   re_match_2_internal does.  */
+static int
+re_dfa_consume (struct re_dfa *dfa, struct re_pattern_buffer *bufp,
+		int pos, int c)
+{
+  re_char *pattern = bufp->buffer, *p = pattern + pos;
+  Lisp_Object translate = bufp->translate;
+  bool multibyte = RE_MULTIBYTE_P (bufp);
+  bool target_multibyte = RE_TARGET_MULTIBYTE_P (bufp);
+
+  if (dfa->exact_end[pos])
+    {
+      int pat_charlen, pat_ch, buf_ch;
+
+      if (multibyte)
+	pat_ch = string_char_and_length (p, &pat_charlen);
+      else
+	{
+	  pat_ch = RE_CHAR_TO_MULTIBYTE (*p);
+	  pat_charlen = 1;
+	}
+      if (target_multibyte)
+	buf_ch = TRANSLATE (c);
+      else
+	{
+	  if (multibyte)
+	    pat_ch = RE_CHAR_TO_UNIBYTE (pat_ch);
+	  else
+	    pat_ch = *p;
+	  buf_ch = RE_CHAR_TO_MULTIBYTE (c);
+	  if (! CHAR_BYTE8_P (buf_ch))
+	    {
+	      buf_ch = RE_CHAR_TO_UNIBYTE (TRANSLATE (buf_ch));
+	      if (buf_ch < 0)
+		buf_ch = c;
+	    }
+	  else
+	    buf_ch = c;
+	}
+      return buf_ch == pat_ch ? pos + pat_charlen : -1;
+    }
+
+  switch (*p)
+    {
+    case anychar:
+      return TRANSLATE (c) != '\n' ? pos + 1 : -1;
+
+    case charset:
+    case charset_not:
+      {
+	bool unibyte_char = false;
+	int corig = c;
+
+	if (target_multibyte)
+	  {
+	    int c1;
+
+	    c = TRANSLATE (c);
+	    c1 = RE_CHAR_TO_UNIBYTE (c);
+	    if (c1 >= 0)
+	      {
+		unibyte_char = true;
+		c = c1;
+	      }
+	  }
+	else
+	  {
+	    int c1 = RE_CHAR_TO_MULTIBYTE (c);
+
+	    if (! CHAR_BYTE8_P (c1))
+	      {
+		c1 = TRANSLATE (c1);
+		c1 = RE_CHAR_TO_UNIBYTE (c1);
+		if (c1 >= 0)
+		  {
+		    unibyte_char = true;
+		    c = c1;
+		  }
+	      }
+	    else
+	      unibyte_char = true;
+	  }
+	return (execute_charset (&p, c, corig, unibyte_char)
+		? p - pattern : -1);
+      }
+
+    case syntaxspec:
+    case notsyntaxspec:
+      {
+	int syntax
+	  = SYNTAX (target_multibyte ? c : RE_CHAR_TO_MULTIBYTE (c));
+	return (((syntax == p[1]) ^ ((re_opcode_t) *p == notsyntaxspec))
+		? pos + 2 : -1);
+      }
+
+    default:
+      emacs_abort ();
+    }
+}
+
+/* Return the state that DFA reaches from S by reading the character C,
+   whose syntax key is SYNTAX, or one of &re_dfa_accept and
+   &re_dfa_dead.  */
+static struct re_dfa_state *
+re_dfa_step (struct re_dfa *dfa, struct re_pattern_buffer *bufp,
+	     struct re_dfa_state *s, int c, int syntax)
+{
+  struct re_dfa_wide *wide = NULL;
+  if (c >= 1 << BYTEWIDTH)
+    {
+      wide = &dfa->wide[(c ^ s->hash * 7) % RE_DFA_WIDE_CACHE];
+      if (wide->from == s && wide->c == c && wide->syntax == syntax)
+	return wide->to;
+    }
+
+  int context = re_dfa_context (bufp, c, syntax);
+  int n = re_dfa_closure (dfa, bufp, s, context);
+  struct re_dfa_state *next;
+
+  if (n < 0)
+    next = &re_dfa_accept;
+  else
+    {
+      /* Collect the positions after the operations that match C.  */
+      int *kernel = dfa->stack, m = 0;
+      unsigned gen = re_dfa_new_generation (dfa, bufp->used + 1);
+      for (int i = 0; i < n; i++)
+	{
+	  int pos = re_dfa_consume (dfa, bufp, dfa->set[i], c);
+	  if (pos >= 0 && dfa->mark[pos] != gen)
+	    {
+	      dfa->mark[pos] = gen;
+	      kernel[m++] = pos;
+	    }
+	}
+      if (m == 0 && !s->inject)
+	next = &re_dfa_dead;
+      else
+	{
+	  int nflushes = dfa->nflushes;
+	  qsort (kernel, m, sizeof *kernel, re_dfa_compare_positions);
+	  next = re_dfa_intern (dfa, kernel, m, context & dfa->context_mask,
+				s->inject);
+	  /* If the states were discarded to make room, S is gone.  */
+	  if (dfa->nflushes != nflushes)
+	    return next;
+	}
+    }
+
+  if (wide)
+    {
+      wide->from = s;
+      wide->c = c;
+      wide->syntax = syntax;
+      wide->to = next;
+    }
+  else
+    {
+      s->next[c] = next;
+      s->next_syntax[c] = syntax;
+    }
+  return next;
+}
+
+/* Return whether the pattern of DFA matches when reading the text
+   ends in state S, which is at the end of the text if AT_END and at
+   STOP otherwise.  */
+static bool
+re_dfa_accept_p (struct re_dfa *dfa, struct re_pattern_buffer *bufp,
+		 struct re_dfa_state *s, bool at_end)
+{
+  signed char *accept = &s->accept_at_end[!at_end];
+  if (*accept < 0)
+    *accept = re_dfa_closure (dfa, bufp, s,
+			      at_end ? DFA_END : DFA_UNKNOWN) < 0;
+  return *accept;
+}
+
+/* Run DFA, the DFA of BUFP, over the virtual concatenation of STRING1
+   and STRING2 (of length SIZE1 and SIZE2), from POS, and for matches
+   that end by STOP.  If RESTART is null, look for a match that starts
+   at POS.  Otherwise look for one that starts anywhere from POS to
+   LIMIT, and set *RESTART to the first position from which one may
+   start.
+
+   Return 0 if there is no such match, 1 if there may be one, and -1 if
+   the DFA was given up on.  */
+static int
+re_dfa_scan (struct re_dfa *dfa, struct re_pattern_buffer *bufp,
+	     re_char *string1, ptrdiff_t size1,
+	     re_char *string2, ptrdiff_t size2,
+	     ptrdiff_t pos, ptrdiff_t limit, ptrdiff_t stop,
+	     ptrdiff_t *restart)
+{
+  bool target_multibyte = RE_TARGET_MULTIBYTE_P (bufp);
+  re_char *end1 = string1 + size1, *end2 = string2 + size2;
+  int context = DFA_BEG, start = 0, nflushes, result;
+  ptrdiff_t from = pos;
+  struct re_dfa_state *s;
+
+  if (pos > stop)
+    return 1;
+  if (pos > 0)
+    {
+      re_char *d = POS_ADDR_VSTRING (pos);
+      int c;
+      if (target_multibyte)
+	GET_CHAR_BEFORE_2 (c, d, string1, end1, string2, end2);
+      else
+	c = (d == string2 ? end1 : d)[-1];
+      context = re_dfa_context (bufp, c, re_dfa_syntax (dfa, bufp, c));
+    }
+  context &= dfa->context_mask;
+  s = (restart
+       ? re_dfa_intern (dfa, &start, 0, context, true)
+       : re_dfa_intern (dfa, &start, 1, context, false));
+  nflushes = dfa->nflushes;
+
+  for (;;)
+    {
+      if (s->inject && pos > limit)
+	{
+	  if (s->nkernel == 0)
+	    {
+	      result = 0;
+	      break;
+	    }
+	  memcpy (dfa->stack, s->kernel, s->nkernel * sizeof *s->kernel);
+	  s = re_dfa_intern (dfa, dfa->stack, s->nkernel, s->context, false);
+	}
+      if (pos == stop)
+	{
+	  result = re_dfa_accept_p (dfa, bufp, s, stop == size1 + size2);
+	  break;
+	}
+
+      re_char *d = POS_ADDR_VSTRING (pos);
+      int len, c = RE_STRING_CHAR_AND_LENGTH (d, len, target_multibyte);
+      int syntax = re_dfa_syntax (dfa, bufp, c);
+      struct re_dfa_state *next = NULL;
+
+      if (c < 1 << BYTEWIDTH && s->next_syntax[c] == syntax)
+	next = s->next[c];
+      if (!next)
+	next = re_dfa_step (dfa, bufp, s, c, syntax);
+      if (next == &re_dfa_accept || next == &re_dfa_dead)
+	{
+	  result = next == &re_dfa_accept;
+	  break;
+	}
+
+      if (dfa->nflushes != nflushes)
+	{
+	  /* Give up on a DFA that keeps needing new states.  */
+	  if (dfa->scanned + (pos - from)
+	      < RE_DFA_MAX_STATES * RE_DFA_MIN_BYTES_PER_STATE)
+	    {
+	      dfa->usable = false;
+	      re_dfa_flush (dfa);
+	      return -1;
+	    }
+	  nflushes = dfa->nflushes;
+	  dfa->scanned = 0;
+	  from = pos;
+	}
+
+      pos += len;
+      if (restart && next->nkernel == 0)
+	*restart = pos;
+      s = next;
+      if ((pos & 0xffff) < len)
+	maybe_quit ();
+    }
+
+  dfa->scanned += pos - from;
+  return result;
+}
+
+/* Return 0 if the pattern of BUFP, with its DFA, cannot match at POS
+   in the strings, -1 if the DFA should no longer be used for this
+   search, and 1 otherwise.  Once the DFA has seldom been right,
+   this does not bother to check and returns 1.  */
+static int
+re_dfa_check (struct re_dfa *dfa, struct re_pattern_buffer *bufp,
+	      re_char *string1, ptrdiff_t size1,
+	      re_char *string2, ptrdiff_t size2,
+	      ptrdiff_t pos, ptrdiff_t stop)
+{
+  if (dfa->checks >= RE_DFA_CHECK_TRIAL
+      && dfa->rejects < dfa->checks / RE_DFA_MIN_REJECT_RATIO)
+    return 1;
+  int found = re_dfa_scan (dfa, bufp, string1, size1, string2, size2,
+			   pos, pos, stop, NULL);
+  if (found >= 0 && dfa->checks < INT_MAX)
+    {
+      dfa->checks++;
+      dfa->rejects += found == 0;
+    }
+  return found;
+}
+
+#undef DFA_PUSH
+
+
+/* Memoizing backtracking.
+
+   Without back references, whether the matcher succeeds from a given
+   place in the pattern and position in the text does not depend on
+   how it got there, so once all the ways to go on from such a state
+   have failed, it is useless to try them again when backtracking
+   leads to the same state through another path.  Remembering the
+   states that failed bounds the work of a search to the size of the
+   pattern times the size of the text, instead of letting it grow
+   exponentially with patterns like "\\(a*\\)*b".
+
+   With back references, the state also includes the registers that
+   they refer to.  Patterns with repetition counts are not memoized,
+   since their counters are further state, kept in the pattern.
+
+   A state is recorded when it is left by popping the failure point
+   below the one it was resumed from, unless a loop check looked at
+   that failure point or those below it, since these depend on how the
+   state was reached.  In a POSIX search, where the matcher goes on
+   after finding a match, a state is recorded only if no match was
+   found from it.  */
+
+struct re_memo
+{
+  /* The number of words in a state: the offset in the pattern, the
+     position in the text, and the start and end positions of each
+     group that a back reference refers to.  */
+  int keylen;
+
+  /* The states from which matching failed, KEYLEN words each.  */
+  ptrdiff_t *keys;
+  ptrdiff_t nkeys, keys_size;
+
+  /* An open addressing hash table of these states: each of its
+     NSLOTS slots is 0, or 1 plus the index of a state in KEYS.
+     NSLOTS is a power of 2.  */
+  ptrdiff_t *slots;
+  ptrdiff_t nslots;
+
+  /* The states being explored, innermost last: for each, the failure
+     stack frame that was on top when it was resumed, the value of
+     NMATCHES at that time, the lowest frame that a loop check looked
+     at since then, the lowest frame that it can look at without
+     depending on how the state was reached, and the state, in KEYLEN
+     + 4 words.  */
+  ptrdiff_t *active;
+  ptrdiff_t nactive, active_size;
+
+  /* The number of matches found by POSIX backtracking.  */
+  ptrdiff_t nmatches;
+};
+
+/* The number of slots of a new hash table, and the most that a
+   search keeps from the previous one.  */
+enum { RE_MEMO_MIN_SLOTS = 64, RE_MEMO_MAX_KEPT_SLOTS = 4096 };
+
+/* Return the memo to use for a match with BUFP, making it if needed,
+   or NULL if the match should not use one.  */
+static struct re_memo *
+re_memo_for_match (struct re_pattern_buffer *bufp)
+{
+  if (!regexp_memoize_backtracking || bufp->counters)
+    return NULL;
+  if (!bufp->memo)
+    {
+      struct re_memo *memo = xzalloc (sizeof *memo);
+      memo->keylen = 2 + 2 * count_one_bits (bufp->backrefs);
+      bufp->memo = memo;
+    }
+  return bufp->memo;
+}
+
+/* Forget the states recorded for BUFP by a previous search.  */
+static void
+re_memo_reset (struct re_pattern_buffer *bufp)
+{
+  struct re_memo *memo = bufp->memo;
+  if (!memo || memo->nkeys == 0)
+    return;
+  if (memo->nslots > RE_MEMO_MAX_KEPT_SLOTS)
+    {
+      xfree (memo->slots);
+      memo->slots = NULL;
+      memo->nslots = 0;
+      xfree (memo->keys);
+      memo->keys = NULL;
+      memo->keys_size = 0;
+    }
+  else
+    memset (memo->slots, 0, memo->nslots * sizeof *memo->slots);
+  memo->nkeys = 0;
+}
+
+static void
+free_re_memo (struct re_pattern_buffer *bufp)
+{
+  struct re_memo *memo = bufp->memo;
+  if (memo)
+    {
+      xfree (memo->keys);
+      xfree (memo->slots);
+      xfree (memo->active);
+      xfree (memo);
+      bufp->memo = NULL;
+    }
+}
+
+/* Return the first slot for KEY in the hash table of MEMO.  */
+static ptrdiff_t
+re_memo_hash (struct re_memo *memo, ptrdiff_t const *key)
+{
+  size_t hash = 0;
+  for (int i = 0; i < memo->keylen; i++)
+    hash = hash * 31 + key[i];
+  hash ^= hash >> 15;
+  return hash & (memo->nslots - 1);
+}
+
+/* Return true if KEY is one of the states from which matching
+   failed.  */
+static bool
+re_memo_failed_p (struct re_memo *memo, ptrdiff_t const *key)
+{
+  if (memo->nkeys == 0)
+    return false;
+  for (ptrdiff_t i = re_memo_hash (memo, key); memo->slots[i];
+       i = (i + 1) & (memo->nslots - 1))
+    if (!memcmp (memo->keys + (memo->slots[i] - 1) * memo->keylen,
+		 key, memo->keylen * sizeof *key))
+      return true;
+  return false;
+}
+
+/* Record KEY as a state from which matching failed.  */
+static void
+re_memo_add (struct re_memo *memo, ptrdiff_t const *key)
+{
+  if (memo->nslots < 2 * (memo->nkeys + 1))
+    {
+      ptrdiff_t nslots = max (RE_MEMO_MIN_SLOTS, 2 * memo->nslots);
+      xfree (memo->slots);
+      memo->slots = xzalloc (nslots * sizeof *memo->slots);
+      memo->nslots = nslots;
+      for (ptrdiff_t k = 0; k < memo->nkeys; k++)
+	{
+	  ptrdiff_t i = re_memo_hash (memo, memo->keys + k * memo->keylen);
+	  while (memo->slots[i])
+	    i = (i + 1) & (nslots - 1);
+	  memo->slots[i] = k + 1;
+	}
+    }
+  if (memo->keys_size - memo->nkeys * memo->keylen < memo->keylen)
+    memo->keys = xpalloc (memo->keys, &memo->keys_size, memo->keylen, -1,
+			  sizeof *memo->keys);
+  memcpy (memo->keys + memo->nkeys * memo->keylen, key,
+	  memo->keylen * sizeof *key);
+  ptrdiff_t i = re_memo_hash (memo, key);
+  while (memo->slots[i])
+    i = (i + 1) & (memo->nslots - 1);
+  memo->slots[i] = ++memo->nkeys;
+}
+
+/* Note that the matcher resumes exploring the state KEY, with the
+   failure stack frame FRAME on top.  LOOKED_AT is true if a loop check
+   from that state could look at FRAME itself, which is the case when
+   FRAME is at the same position in the text or keeps the position.
+   Otherwise, the loop checks stop at FRAME, since the positions of
+   the frames below the state are all before its position.  */
+static void
+re_memo_explore (struct re_memo *memo, ptrdiff_t const *key,
+		 ptrdiff_t frame, bool looked_at)
+{
+  int len = memo->keylen + 4;
+  if (memo->active_size - memo->nactive * len < len)
+    memo->active = xpalloc (memo->active, &memo->active_size, len, -1,
+			    sizeof *memo->active);
+  ptrdiff_t *a = memo->active + memo->nactive++ * len;
+  a[0] = frame;
+  a[1] = memo->nmatches;
+  a[2] = PTRDIFF_MAX;
+  a[3] = frame + looked_at;
+  memcpy (a + 4, key, memo->keylen * sizeof *key);
+}
+
+/* Note that a loop check looked at the failure stack down to the
+   frame FRAME.  */
+static void
+re_memo_taint (struct re_memo *memo, ptrdiff_t frame)
+{
+  if (memo->nactive > 0)
+    {
+      ptrdiff_t *a = memo->active + (memo->nactive - 1) * (memo->keylen + 4);
+      a[2] = min (a[2], frame);
+    }
+}
+
+/* Record as failed the states being explored that are finished now
+   that the failure stack frame FRAME is on top.  */
+static void
+re_memo_finish (struct re_memo *memo, ptrdiff_t frame)
+{
+  int len = memo->keylen + 4;
+  while (memo->nactive > 0)
+    {
+      ptrdiff_t *a = memo->active + (memo->nactive - 1) * len;
+      if (a[0] < frame)
+	break;
+      if (a[1] == memo->nmatches && a[2] >= a[3])
+	re_memo_add (memo, a + 4);
+      memo->nactive--;
+      if (memo->nactive > 0)
+	a[2 - len] = min (a[2 - len], a[2]);
+    }
+}
+
 
 /* Matching routines.  */
 
@@ -3851,9 +5262,18 @@ re_match_2 (struct re_pattern_buffer *bufp,
   charpos = SYNTAX_TABLE_BYTE_TO_CHAR (POS_AS_IN_BUFFER (pos));
   SETUP_SYNTAX_TABLE_FOR_OBJECT (re_match_object, charpos, 1);
 
+  re_memo_reset (bufp);
+  if (!regexp_profile)
+    return re_match_2_internal (bufp, (re_char *) string1, size1,
+				(re_char *) string2, size2,
+				pos, regs, stop);
+
+  struct timespec start = current_timespec ();
+  re_profile_pushes = re_profile_max_stack = 0;
   result = re_match_2_internal (bufp, (re_char *) string1, size1,
 				(re_char *) string2, size2,
 				pos, regs, stop);
+  re_profile_add (bufp, start, max (result, 0));
   return result;
 }
 
@@ -3916,6 +5336,10 @@ re_match_2_internal (struct re_pattern_buffer *bufp,
      to resume scanning the pattern; the second one is where to resume
      scanning the strings.  */
   fail_stack_type fail_stack;
+
+  /* True if the failure points pushed are counted for the profile of
+     BUFP; see re_profile_add.  */
+  bool profiling = regexp_profile;
 #ifdef DEBUG_COMPILES_ARGUMENTS
   ptrdiff_t nfailure_points_pushed = 0, nfailure_points_popped = 0;
 #endif
@@ -3962,6 +5386,13 @@ re_match_2_internal (struct re_pattern_buffer *bufp,
 
   INIT_FAIL_STACK ();
 
+  /* The states from which matching failed, if they are memoized, and
+     the state being resumed.  There are at most 9 back references.  */
+  struct re_memo *memo = re_memo_for_match (bufp);
+  ptrdiff_t memo_key[2 + 2 * 9];
+  if (memo)
+    memo->nactive = 0;
+
   ptrdiff_t count = SPECPDL_INDEX ();
 
   /* Prevent shrinking and relocation of buffer text if GC happens
@@ -4106,6 +5537,8 @@ re_match_2_internal (struct re_pattern_buffer *bufp,
 			  best_regend[reg] = regend[reg];
 			}
 		    }
+		  if (memo)
+		    memo->nmatches++;
 		  goto fail;
 		}
 
@@ -4240,7 +5673,7 @@ re_match_2_internal (struct re_pattern_buffer *bufp,
 		int pat_charlen, buf_charlen;
 		int pat_ch, buf_ch;
 
-		PREFETCH ();
+		PREFETCH_ROLLBACK ();
 		if (multibyte)
 		  pat_ch = string_char_and_length (p, &pat_charlen);
 		else
@@ -4267,7 +5700,7 @@ re_match_2_internal (struct re_pattern_buffer *bufp,
 		int pat_charlen;
 		int pat_ch, buf_ch;
 
-		PREFETCH ();
+		PREFETCH_ROLLBACK ();
 		if (multibyte)
 		  {
 		    pat_ch = string_char_and_length (p, &pat_charlen);
@@ -5010,12 +6443,15 @@ re_match_2_internal (struct re_pattern_buffer *bufp,
     /* We goto here if a matching operation fails. */
     fail:
       maybe_quit ();
+      if (memo)
+	re_memo_finish (memo, fail_stack.frame);
       if (!FAIL_STACK_EMPTY ())
 	{
 	  re_char *str, *pat;
 	  /* A restart point is known.  Restore to that state.  */
 	  DEBUG_PRINT ("\nFAIL:\n");
 	  POP_FAILURE_POINT (str, pat);
+	  ptrdiff_t frame = fail_stack.frame;
 	  switch (*pat++)
 	    {
 	    case on_failure_keep_string_jump:
@@ -5047,6 +6483,28 @@ re_match_2_internal (struct re_pattern_buffer *bufp,
 
 	  if (d >= string1 && d <= end1)
 	    dend = end_match_1;
+
+	  /* Don't explore again a state that failed already.  */
+	  if (memo)
+	    {
+	      int i = 0;
+	      memo_key[i++] = p - bufp->buffer;
+	      memo_key[i++] = POINTER_TO_OFFSET (d);
+	      for (int reg = 1; reg < num_regs && reg <= 9; reg++)
+		if (bufp->backrefs & (1 << reg))
+		  {
+		    memo_key[i++] = (REG_UNSET (regstart[reg]) ? -1
+				     : POINTER_TO_OFFSET (regstart[reg]));
+		    memo_key[i++] = (REG_UNSET (regend[reg]) ? -1
+				     : POINTER_TO_OFFSET (regend[reg]));
+		  }
+	      if (re_memo_failed_p (memo, memo_key))
+		goto fail;
+	      re_memo_explore (memo, memo_key, frame,
+			       (frame > 0
+				&& (FAILURE_STR (frame) == NULL
+				    || FAILURE_STR (frame) == d)));
+	    }
 	}
       else
 	break;   /* Matching at this starting point really fails.  */
@@ -20,6 +20,7 @@
 #define EMACS_REGEX_H 1
 
 #include <stddef.h>
+#include <time.h>
 
 /* This is the structure we store register match data in.
    Declare this before including lisp.h, since lisp.h (via thread.h)
@@ -55,6 +56,17 @@ #define EMACS_REGEX_H 1
 /* Amount of memory that we can safely stack allocate.  */
 extern ptrdiff_t emacs_re_safe_alloca;
 
+/* The cost of the searches and matches with a pattern: how many there
+   were, the number of bytes of text they went over, the number of
+   failure points they pushed, the most items they had on the failure
+   stack at once, and the time they took.  */
+struct re_profile
+{
+  intmax_t calls, bytes, pushes;
+  ptrdiff_t max_stack;
+  struct timespec time;
+};
+
 /* This data structure represents a compiled pattern.  Before calling
    the pattern compiler, the fields 'buffer', 'allocated', 'fastmap',
    and 'translate' can be set.  After the pattern has been
@@ -107,6 +119,11 @@ #define EMACS_REGEX_H 1
            by 're_compile_fastmap' if it updates the fastmap.  */
   bool_bf fastmap_accurate : 1;
 
+        /* Set by 're_compile_fastmap': true if the only bytes in the
+           fastmap are ones that can start a multibyte character, so
+           that it can be tested on each byte of multibyte text.  */
+  bool_bf fastmap_leading_codes : 1;
+
   /* If true, the compilation of the pattern had to look up the syntax table,
      so the compiled pattern is valid for the current syntax table only.  */
   bool_bf used_syntax : 1;
@@ -118,6 +135,38 @@ #define EMACS_REGEX_H 1
   /* If true, multi-byte form in the target of match should be
      recognized as a multibyte character.  */
   bool_bf target_multibyte : 1;
+
+  /* Also set by 're_compile_fastmap', for searches without a translate
+     table: the only byte that a match can start with, or -1.  */
+  int first_byte;
+
+  /* And the offset in 'buffer' and the length of a string of bytes
+     that every match starts with, or 0 if there is none; and the
+     length of its leading ASCII part.  */
+  ptrdiff_t literal;
+  int literal_length, literal_ascii_length;
+
+  /* The lazily built DFA that 're_search_2' uses to skip places where
+     the pattern cannot match, or NULL if none was built yet.  */
+  struct re_dfa *dfa;
+
+  /* The number of searches that could have used a DFA since the
+     pattern was compiled, up to the point where one is built.  */
+  unsigned char dfa_searches;
+
+  /* Set by 'regex_compile': bit N is set if the pattern has a back
+     reference to group N, and COUNTERS is true if it has repetition
+     counts, which keep counters in the pattern while matching.  */
+  unsigned short backrefs;
+  bool_bf counters : 1;
+
+  /* The states from which matching failed, kept by 're_match_2' and
+     're_search_2' if 'regexp-memoize-backtracking' is non-nil.  */
+  struct re_memo *memo;
+
+  /* What the searches and matches with this pattern cost, counted by
+     're_search_2' and 're_match_2' while 'regexp-profile' is non-nil.  */
+  struct re_profile profile;
 };
 
 /* Declarations for routines.  */
@@ -161,6 +210,10 @@ #define EMACS_REGEX_H 1
 			    ptrdiff_t stop);
 
 
+/* Free the memory that BUFFER allocated for its compiled pattern.  */
+extern void re_free_pattern (struct re_pattern_buffer *buffer);
+
+
 /* Set REGS to hold NUM_REGS registers, storing them in STARTS and
    ENDS.  Subsequent matches using BUFFER and REGS will use this memory
    for recording register information.  STARTS and ENDS must be
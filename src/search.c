@@ -21,6 +21,8 @@ Copyright (C) 1985-1987, 1993-1994, 1997-1999, 2001-2020 Free Software
 
 #include <config.h>
 
+#include <stdlib.h>
+
 #include "lisp.h"
 #include "character.h"
 #include "buffer.h"
@@ -30,16 +32,25 @@ Copyright (C) 1985-1987, 1993-1994, 1997-1999, 2001-2020 Free Software
 #include "blockinput.h"
 #include "intervals.h"
 #include "pdumper.h"
+#include "systime.h"
 
 #include "regex-emacs.h"
 
+/* The default value of `regexp-cache-size'.  */
 #define REGEXP_CACHE_SIZE 20
 
 /* If the regexp is non-nil, then the buffer contains the compiled form
    of that regexp, suitable for searching.  */
 struct regexp_cache
 {
-  struct regexp_cache *next;
+  /* The neighbors in the list of all the entries, from the most to the
+     least recently used one.  */
+  struct regexp_cache *next, *prev;
+  /* The next entry in the same bucket of the hash index.  Only the
+     entries whose regexp is non-nil are in the index.  */
+  struct regexp_cache *chain;
+  /* The hash code of the regexp, see regexp_cache_hash.  */
+  EMACS_UINT hash;
   Lisp_Object regexp, f_whitespace_regexp;
   /* Syntax table for which the regexp applies.  We need this because
      of character classes.  If this is t, then the compiled pattern is valid
@@ -53,11 +64,26 @@ #define REGEXP_CACHE_SIZE 20
   bool busy;
 };
 
-/* The instances of that struct.  */
-static struct regexp_cache searchbufs[REGEXP_CACHE_SIZE];
+/* The head of the list of entries, which is the most recently used
+   one, and its tail.  The entries are allocated with xmalloc.  */
+static struct regexp_cache *searchbuf_head, *searchbuf_tail;
+
+/* The number of entries in that list.  */
+static ptrdiff_t searchbuf_count;
+
+/* The hash index of the entries: SEARCHBUF_NBUCKETS chains, a power of
+   2 that grows with the number of entries.  */
+static struct regexp_cache **searchbuf_buckets;
+static ptrdiff_t searchbuf_nbuckets;
+
+/* Statistics for `regexp-cache-stats'.  */
+static EMACS_INT regexp_cache_hits, regexp_cache_misses;
+static struct timespec regexp_cache_compile_time;
 
-/* The head of the linked list; points to the most recently used buffer.  */
-static struct regexp_cache *searchbuf_head;
+/* The costs for `regexp-profile-data' of the regexps that are no longer
+   in the cache: a hash table from each regexp to a vector
+   [CALLS BYTES PUSHES MAX-STACK TIME], or nil.  */
+static Lisp_Object regexp_profile_table;
 
 static void set_search_regs (ptrdiff_t, ptrdiff_t);
 static void save_search_regs (void);
@@ -67,6 +93,9 @@ #define REGEXP_CACHE_SIZE 20
 static EMACS_INT boyer_moore (EMACS_INT, unsigned char *, ptrdiff_t,
                               Lisp_Object, Lisp_Object, ptrdiff_t,
                               ptrdiff_t, int);
+static EMACS_INT boyer_moore_multibyte (EMACS_INT, unsigned char *,
+                                        ptrdiff_t, Lisp_Object, Lisp_Object,
+                                        ptrdiff_t, ptrdiff_t);
 static EMACS_INT search_buffer (Lisp_Object, ptrdiff_t, ptrdiff_t,
                                 ptrdiff_t, ptrdiff_t, EMACS_INT, int,
                                 Lisp_Object, Lisp_Object, bool);
@@ -120,8 +149,12 @@ compile_pattern_1 (struct regexp_cache *cp, Lisp_Object pattern,
   whitespace_regexp = STRINGP (Vsearch_spaces_regexp) ?
     SSDATA (Vsearch_spaces_regexp) : NULL;
 
+  struct timespec start = current_timespec ();
   val = (char *) re_compile_pattern (SSDATA (pattern), SBYTES (pattern),
 				     posix, whitespace_regexp, &cp->buf);
+  regexp_cache_compile_time
+    = timespec_add (regexp_cache_compile_time,
+		    timespec_sub (current_timespec (), start));
 
   /* If the compiled pattern hard codes some of the contents of the
      syntax-table, it can only be reused with *this* syntax table.  */
@@ -150,6 +183,176 @@ shrink_regexp_cache (void)
       }
 }
 
+/* Mark the Lisp objects of the regexp cache, which isn't in static
+   storage.  This is called from garbage collection.  */
+
+void
+mark_regexp_cache (void)
+{
+  for (struct regexp_cache *cp = searchbuf_head; cp; cp = cp->next)
+    {
+      mark_object (cp->regexp);
+      mark_object (cp->f_whitespace_regexp);
+      mark_object (cp->syntax_table);
+    }
+}
+
+/* Add the costs counted in the cache entry CP while `regexp-profile'
+   was non-nil to those of its regexp in `regexp_profile_table', and
+   clear them.  */
+
+static void
+regexp_profile_flush (struct regexp_cache *cp)
+{
+  struct re_profile *profile = &cp->buf.profile;
+  if (profile->calls == 0)
+    return;
+  eassert (STRINGP (cp->regexp));
+
+  if (NILP (regexp_profile_table))
+    regexp_profile_table = CALLN (Fmake_hash_table, QCtest, Qequal);
+  struct Lisp_Hash_Table *h = XHASH_TABLE (regexp_profile_table);
+  Lisp_Object hash, costs;
+  ptrdiff_t i = hash_lookup (h, cp->regexp, &hash);
+  if (i >= 0)
+    costs = HASH_VALUE (h, i);
+  else
+    {
+      costs = make_vector (5, make_fixnum (0));
+      ASET (costs, 4, make_float (0));
+      hash_put (h, cp->regexp, costs, hash);
+    }
+
+  ASET (costs, 0, CALLN (Fplus, AREF (costs, 0), make_int (profile->calls)));
+  ASET (costs, 1, CALLN (Fplus, AREF (costs, 1), make_int (profile->bytes)));
+  ASET (costs, 2, CALLN (Fplus, AREF (costs, 2), make_int (profile->pushes)));
+  ASET (costs, 3, CALLN (Fmax, AREF (costs, 3),
+			 make_int (profile->max_stack)));
+  ASET (costs, 4, make_float (XFLOAT_DATA (AREF (costs, 4))
+			      + timespectod (profile->time)));
+  memset (profile, 0, sizeof *profile);
+}
+
+/* Return the hash code of the cache entries for PATTERN compiled
+   with POSIX.  */
+
+static EMACS_UINT
+regexp_cache_hash (Lisp_Object pattern, bool posix)
+{
+  return hash_string (SSDATA (pattern), SBYTES (pattern)) ^ posix;
+}
+
+/* Remove CP from the hash index, if it is there.  */
+
+static void
+regexp_cache_unindex (struct regexp_cache *cp)
+{
+  if (NILP (cp->regexp))
+    return;
+  struct regexp_cache **cpp
+    = &searchbuf_buckets[cp->hash & (searchbuf_nbuckets - 1)];
+  while (*cpp != cp)
+    cpp = &(*cpp)->chain;
+  *cpp = cp->chain;
+}
+
+/* Add CP, whose regexp is non-nil, to the hash index.  */
+
+static void
+regexp_cache_index (struct regexp_cache *cp)
+{
+  struct regexp_cache **bucket
+    = &searchbuf_buckets[cp->hash & (searchbuf_nbuckets - 1)];
+  cp->chain = *bucket;
+  *bucket = cp;
+}
+
+/* Remove CP from the list of entries.  */
+
+static void
+regexp_cache_unlink (struct regexp_cache *cp)
+{
+  if (cp->prev)
+    cp->prev->next = cp->next;
+  else
+    searchbuf_head = cp->next;
+  if (cp->next)
+    cp->next->prev = cp->prev;
+  else
+    searchbuf_tail = cp->prev;
+}
+
+/* Put CP at the head of the list of entries if FRONT, else at its
+   tail.  */
+
+static void
+regexp_cache_link (struct regexp_cache *cp, bool front)
+{
+  if (front)
+    {
+      cp->prev = NULL;
+      cp->next = searchbuf_head;
+      if (searchbuf_head)
+	searchbuf_head->prev = cp;
+      else
+	searchbuf_tail = cp;
+      searchbuf_head = cp;
+    }
+  else
+    {
+      cp->next = NULL;
+      cp->prev = searchbuf_tail;
+      if (searchbuf_tail)
+	searchbuf_tail->next = cp;
+      else
+	searchbuf_head = cp;
+      searchbuf_tail = cp;
+    }
+}
+
+/* Add a new empty entry at the tail of the list, and return it.
+   Grow the hash index if there are more entries than buckets.  */
+
+static struct regexp_cache *
+make_regexp_cache_entry (void)
+{
+  struct regexp_cache *cp = xzalloc (sizeof *cp);
+  cp->buf.allocated = 100;
+  cp->buf.buffer = xmalloc (100);
+  cp->buf.fastmap = cp->fastmap;
+  cp->regexp = Qnil;
+  cp->f_whitespace_regexp = Qnil;
+  cp->syntax_table = Qnil;
+  regexp_cache_link (cp, false);
+  searchbuf_count++;
+
+  if (searchbuf_nbuckets < searchbuf_count)
+    {
+      ptrdiff_t nbuckets = max (2 * searchbuf_nbuckets, 32);
+      xfree (searchbuf_buckets);
+      searchbuf_buckets = xzalloc (nbuckets * sizeof *searchbuf_buckets);
+      searchbuf_nbuckets = nbuckets;
+      for (struct regexp_cache *p = searchbuf_head; p; p = p->next)
+	if (!NILP (p->regexp))
+	  regexp_cache_index (p);
+    }
+  return cp;
+}
+
+/* Remove the entry CP, which is not busy, from the cache and free it.  */
+
+static void
+free_regexp_cache_entry (struct regexp_cache *cp)
+{
+  eassert (!cp->busy);
+  regexp_profile_flush (cp);
+  regexp_cache_unindex (cp);
+  regexp_cache_unlink (cp);
+  searchbuf_count--;
+  re_free_pattern (&cp->buf);
+  xfree (cp);
+}
+
 /* Clear the regexp cache w.r.t. a particular syntax table,
    because it was changed.
    There is no danger of memory leak here because re_compile_pattern
@@ -158,14 +361,25 @@ shrink_regexp_cache (void)
 void
 clear_regexp_cache (void)
 {
-  int i;
+  struct regexp_cache *cp, *next;
 
-  for (i = 0; i < REGEXP_CACHE_SIZE; ++i)
-    /* It's tempting to compare with the syntax-table we've actually changed,
-       but it's not sufficient because char-table inheritance means that
-       modifying one syntax-table can change others at the same time.  */
-    if (!searchbufs[i].busy && !EQ (searchbufs[i].syntax_table, Qt))
-      searchbufs[i].regexp = Qnil;
+  for (cp = searchbuf_head; cp; cp = next)
+    {
+      next = cp->next;
+      /* It's tempting to compare with the syntax-table we've actually
+	 changed, but it's not sufficient because char-table inheritance
+	 means that modifying one syntax-table can change others at the
+	 same time.  */
+      if (!cp->busy && !NILP (cp->regexp) && !EQ (cp->syntax_table, Qt))
+	{
+	  /* Move the entry to the tail, to be reused first.  */
+	  regexp_profile_flush (cp);
+	  regexp_cache_unindex (cp);
+	  cp->regexp = Qnil;
+	  regexp_cache_unlink (cp);
+	  regexp_cache_link (cp, false);
+	}
+    }
 }
 
 static void
@@ -198,22 +412,15 @@ freeze_pattern (struct regexp_cache *searchbuf)
 compile_pattern (Lisp_Object pattern, struct re_registers *regp,
 		 Lisp_Object translate, bool posix, bool multibyte)
 {
-  struct regexp_cache *cp, **cpp, **lru_nonbusy;
-
-  for (cpp = &searchbuf_head, lru_nonbusy = NULL; ; cpp = &cp->next)
-    {
-      cp = *cpp;
-      if (!cp->busy)
-        lru_nonbusy = cpp;
-      /* Entries are initialized to nil, and may be set to nil by
-	 compile_pattern_1 if the pattern isn't valid.  Don't apply
-	 string accessors in those cases.  However, compile_pattern_1
-	 is only applied to the cache entry we pick here to reuse.  So
-	 nil should never appear before a non-nil entry.  */
-      if (NILP (cp->regexp))
-	goto compile_it;
-      if (SCHARS (cp->regexp) == SCHARS (pattern)
-          && !cp->busy
+  struct regexp_cache *cp;
+  EMACS_UINT hash = regexp_cache_hash (pattern, posix);
+
+  if (searchbuf_nbuckets)
+    for (cp = searchbuf_buckets[hash & (searchbuf_nbuckets - 1)]; cp;
+	 cp = cp->chain)
+      if (cp->hash == hash
+	  && SCHARS (cp->regexp) == SCHARS (pattern)
+	  && !cp->busy
 	  && STRING_MULTIBYTE (cp->regexp) == STRING_MULTIBYTE (pattern)
 	  && !NILP (Fstring_equal (cp->regexp, pattern))
 	  && EQ (cp->buf.translate, translate)
@@ -222,29 +429,49 @@ compile_pattern (Lisp_Object pattern, struct re_registers *regp,
 	      || EQ (cp->syntax_table, BVAR (current_buffer, syntax_table)))
 	  && !NILP (Fequal (cp->f_whitespace_regexp, Vsearch_spaces_regexp))
 	  && cp->buf.charset_unibyte == charset_unibyte)
-	break;
+	{
+	  regexp_cache_hits++;
+	  goto found;
+	}
 
-      /* If we're at the end of the cache, compile into the last
-	 (least recently used) non-busy cell in the cache.  */
-      if (cp->next == 0)
+  /* Compile into a new entry if the cache isn't full yet, else into
+     the least recently used entry that isn't busy, after freeing
+     those beyond the size of the cache.  */
+  regexp_cache_misses++;
+  ptrdiff_t size = max (1, regexp_cache_size);
+  struct regexp_cache *lru_nonbusy = NULL, *prev;
+  for (cp = searchbuf_tail; cp; cp = prev)
+    {
+      prev = cp->prev;
+      if (!cp->busy)
 	{
-          if (!lru_nonbusy)
-            error ("Too much matching reentrancy");
-          cpp = lru_nonbusy;
-          cp = *cpp;
-	compile_it:
-          eassert (!cp->busy);
-	  compile_pattern_1 (cp, pattern, translate, posix);
-	  break;
+	  if (searchbuf_count <= size)
+	    {
+	      lru_nonbusy = cp;
+	      break;
+	    }
+	  free_regexp_cache_entry (cp);
 	}
     }
+  if (searchbuf_count < size)
+    cp = make_regexp_cache_entry ();
+  else if (lru_nonbusy)
+    cp = lru_nonbusy;
+  else
+    error ("Too much matching reentrancy");
 
-  /* When we get here, cp (aka *cpp) contains the compiled pattern,
-     either because we found it in the cache or because we just compiled it.
-     Move it to the front of the queue to mark it as most recently used.  */
-  *cpp = cp->next;
-  cp->next = searchbuf_head;
-  searchbuf_head = cp;
+  regexp_profile_flush (cp);
+  regexp_cache_unindex (cp);
+  compile_pattern_1 (cp, pattern, translate, posix);
+  cp->hash = hash;
+  regexp_cache_index (cp);
+
+ found:
+  /* When we get here, cp contains the compiled pattern, either because
+     we found it in the cache or because we just compiled it.  Move it
+     to the front of the list to mark it as most recently used.  */
+  regexp_cache_unlink (cp);
+  regexp_cache_link (cp, true);
 
   /* Advise the searching functions about the space we have allocated
      for register data.  */
@@ -257,7 +484,80 @@ compile_pattern (Lisp_Object pattern, struct re_registers *regp,
   return cp;
 }
 
+DEFUN ("regexp-cache-stats", Fregexp_cache_stats, Sregexp_cache_stats,
+       0, 1, 0,
+       doc: /* Return statistics about the cache of compiled regexps.
+The value is an alist with these elements:
+
+  (size . SIZE)       the value of `regexp-cache-size'
+  (entries . N)       the number of regexps in the cache
+  (hits . N)          how many searches found their regexp in the cache
+  (misses . N)        how many searches had to compile their regexp
+  (compile-time . T)  the time spent compiling regexps, in seconds
+
+If a program has many misses, it searches for more distinct regexps
+than the cache holds, and increasing `regexp-cache-size' can make it
+faster.  If RESET is non-nil, restart the counts and the time from
+zero after returning them.  */)
+  (Lisp_Object reset)
+{
+  Lisp_Object val
+    = list5 (Fcons (Qsize, make_int (regexp_cache_size)),
+	     Fcons (Qentries, make_int (searchbuf_count)),
+	     Fcons (Qhits, make_int (regexp_cache_hits)),
+	     Fcons (Qmisses, make_int (regexp_cache_misses)),
+	     Fcons (Qcompile_time,
+		    make_float (timespectod (regexp_cache_compile_time))));
+  if (!NILP (reset))
+    {
+      regexp_cache_hits = regexp_cache_misses = 0;
+      regexp_cache_compile_time = make_timespec (0, 0);
+    }
+  return val;
+}
+
 
+DEFUN ("regexp-profile-data", Fregexp_profile_data, Sregexp_profile_data,
+       0, 1, 0,
+       doc: /* Return what the regexps used while `regexp-profile' was non-nil cost.
+The value is a list with an element for each regexp, of the form
+
+  (REGEXP CALLS BYTES PUSHES MAX-STACK TIME)
+
+where CALLS is the number of searches and matches for REGEXP, BYTES
+the number of bytes of text they went over, PUSHES the number of
+failure points they pushed to backtrack to, MAX-STACK the most items
+that they had on the failure stack at once, and TIME the time they
+took, in seconds.  If RESET is non-nil, restart from zero afterwards.
+
+See also the command `regexp-profile-report'.  */)
+  (Lisp_Object reset)
+{
+  for (struct regexp_cache *cp = searchbuf_head; cp; cp = cp->next)
+    regexp_profile_flush (cp);
+
+  Lisp_Object val = Qnil;
+  if (!NILP (regexp_profile_table))
+    {
+      struct Lisp_Hash_Table *h = XHASH_TABLE (regexp_profile_table);
+      for (ptrdiff_t i = 0; i < HASH_TABLE_SIZE (h); i++)
+	{
+	  Lisp_Object regexp = HASH_KEY (h, i);
+	  if (!EQ (regexp, Qunbound))
+	    {
+	      Lisp_Object costs = HASH_VALUE (h, i);
+	      val = Fcons (list (regexp, AREF (costs, 0), AREF (costs, 1),
+				 AREF (costs, 2), AREF (costs, 3),
+				 AREF (costs, 4)),
+			   val);
+	    }
+	}
+    }
+  if (!NILP (reset))
+    regexp_profile_table = Qnil;
+  return val;
+}
+
 static Lisp_Object
 looking_at_1 (Lisp_Object string, bool posix)
 {
@@ -623,6 +923,46 @@ newline_cache_on_off (struct buffer *buf)
 }
 
 
+/* Return the number of newlines in the SIZE bytes of text at P.
+
+   This looks at eight bytes at a time instead of searching for each
+   newline, which is several times faster when lines are short.  It
+   is used to skip over text which cannot contain the newline a search
+   is looking for, because it has fewer bytes than the number of
+   newlines still wanted.  */
+
+ptrdiff_t
+count_newlines (unsigned char const *p, ptrdiff_t size)
+{
+  /* ONES has 1 in each byte.  If X is a word XORed with NEWLINES, the
+     most significant bit of a byte of ((X & LOW7) + LOW7) | X is clear
+     if and only if the corresponding byte of the word is a newline.  */
+  uint64_t const ones = 0x0101010101010101;
+  uint64_t const low7 = ones * 0x7f;
+  uint64_t const newlines = ones * '\n';
+  ptrdiff_t n = 0;
+
+  for (; size >= 4 * sizeof (uint64_t); p += 4 * sizeof (uint64_t),
+	 size -= 4 * sizeof (uint64_t))
+    {
+      /* Each byte of ACC counts the newlines found at that offset in
+	 four consecutive words, so it is at most 4.  */
+      uint64_t acc = 0;
+      for (int i = 0; i < 4; i++)
+	{
+	  uint64_t w;
+	  memcpy (&w, p + i * sizeof w, sizeof w);
+	  uint64_t x = w ^ newlines;
+	  acc += (~(((x & low7) + low7) | x) >> 7) & ones;
+	}
+      /* Add up the bytes of ACC in its most significant byte.  */
+      n += (acc * ones) >> 56;
+    }
+  for (; size > 0; p++, size--)
+    n += *p == '\n';
+  return n;
+}
+
 /* Search for COUNT newlines between START/START_BYTE and END/END_BYTE.
 
    If COUNT is positive, search forwards; END must be >= START.
@@ -672,6 +1012,42 @@ find_newline (ptrdiff_t start, ptrdiff_t start_byte, ptrdiff_t end,
   else
     cache_buffer = current_buffer;
 
+  /* If more newlines are wanted than there are characters between
+     START and END, as when counting lines, the whole text has to be
+     scanned and the cache cannot save any work.  Keeping it up to date
+     with the position of every newline would make that scan several
+     times slower, so leave it alone.  */
+  if (count > 0 ? count > end - start : -count > start - end)
+    newline_cache = NULL;
+
+  /* When many lines are to be skipped, look up the line index for
+     the newline we want and the number of newlines before END.  */
+  struct line_index *line_index;
+  if ((count >= LINE_INDEX_MIN_LINES || count <= -LINE_INDEX_MIN_LINES)
+      && (line_index = buffer_line_index ()))
+    {
+      if (start_byte == -1)
+	start_byte = CHAR_TO_BYTE (start);
+      ptrdiff_t before = line_index_count (line_index, start_byte);
+      ptrdiff_t available = line_index_count (line_index, end_byte) - before;
+      ptrdiff_t wanted = count > 0 ? before + count : before + count + 1;
+
+      if (count > 0 ? count <= available : -count <= -available)
+	{
+	  if (counted)
+	    *counted = count;
+	  start_byte = line_index_find (line_index, wanted);
+	  if (bytepos)
+	    *bytepos = start_byte;
+	  return BYTE_TO_CHAR (start_byte);
+	}
+      if (counted)
+	*counted = available;
+      if (bytepos)
+	*bytepos = end_byte;
+      return end;
+    }
+
   if (counted)
     *counted = count;
 
@@ -773,7 +1149,20 @@ find_newline (ptrdiff_t start, ptrdiff_t start_byte, ptrdiff_t end,
 	  ptrdiff_t base = start_byte - lim_byte;
 	  ptrdiff_t cursor, next;
 
-	  for (cursor = base; cursor < 0; cursor = next)
+	  /* While the next block of text is smaller than the number
+	     of newlines still wanted, the last one cannot be in it;
+	     just count the newlines there.  */
+	  for (cursor = base; cursor < 0; cursor += next)
+	    {
+	      next = min (- cursor, NEWLINE_COUNT_BLOCK);
+	      if (count <= next)
+		break;
+	      count -= count_newlines (lim_addr + cursor, next);
+	      if (allow_quit)
+		maybe_quit ();
+	    }
+
+	  for (; cursor < 0; cursor = next)
 	    {
               /* The dumb loop.  */
 	      unsigned char *nl = memchr (lim_addr + cursor, '\n', - cursor);
@@ -882,7 +1271,19 @@ find_newline (ptrdiff_t start, ptrdiff_t start_byte, ptrdiff_t end,
 	  ptrdiff_t base = start_byte - ceiling_byte;
 	  ptrdiff_t cursor, prev;
 
-	  for (cursor = base; 0 < cursor; cursor = prev)
+	  /* Count the newlines in blocks of text that cannot hold the
+	     last one wanted, as above.  */
+	  for (cursor = base; 0 < cursor; cursor -= prev)
+	    {
+	      prev = min (cursor, NEWLINE_COUNT_BLOCK);
+	      if (-count <= prev)
+		break;
+	      count += count_newlines (ceiling_addr + cursor - prev, prev);
+	      if (allow_quit)
+		maybe_quit ();
+	    }
+
+	  for (; 0 < cursor; cursor = prev)
             {
 	      unsigned char *nl = memrchr (ceiling_addr, '\n', cursor);
 	      prev = nl ? nl - ceiling_addr : -1;
@@ -1482,6 +1883,9 @@ search_buffer_non_re (Lisp_Object string, ptrdiff_t pos,
        ? boyer_moore (n, pat, len_byte, trt, inverse_trt,
                       pos_byte, lim_byte,
                       char_base)
+       : multibyte
+       ? boyer_moore_multibyte (n, pat, raw_pattern_size, trt, inverse_trt,
+                                pos_byte, lim_byte)
        : simple_search (n, pat, raw_pattern_size, len_byte, trt,
                         pos, pos_byte, lim, lim_byte));
   SAFE_FREE ();
@@ -1523,8 +1927,8 @@ search_buffer (Lisp_Object string, ptrdiff_t pos, ptrdiff_t pos_byte,
    Otherwise, if M matches remained to be found, return -M.
 
    This kind of search works regardless of what is in PAT and
-   regardless of what is in TRT.  It is used in cases where
-   boyer_moore cannot work.  */
+   regardless of what is in TRT.  It is used in unibyte buffers
+   where boyer_moore cannot work.  */
 
 static EMACS_INT
 simple_search (EMACS_INT n, unsigned char *pat,
@@ -2146,6 +2550,174 @@ boyer_moore (EMACS_INT n, unsigned char *base_pat,
   return BYTE_TO_CHAR (pos_byte);
 }
 
+/* Do Boyer-Moore search N times for the string PAT, whose LEN
+   characters are already translated by TRT, from byte position
+   POS_BYTE until LIM_BYTE in a multibyte buffer.  INVERSE_TRT is the
+   inverse of TRT.
+
+   This is used when boyer_moore cannot be, because the multibyte
+   forms of the case-equivalents of the characters in PAT differ in
+   more than their last byte, or in length.  The stride for each byte
+   is the smallest distance from the end of a match (from its start,
+   if searching backward) that the byte can be at in any of the
+   multibyte forms of the equivalents of PAT, and never more than the
+   length of the shortest match, so no match is skipped.  A possible
+   match is then checked character by character, as in
+   simple_search.
+
+   Return the same values as boyer_moore.  */
+
+static EMACS_INT
+boyer_moore_multibyte (EMACS_INT n, unsigned char *pat, ptrdiff_t len,
+		       Lisp_Object trt, Lisp_Object inverse_trt,
+		       ptrdiff_t pos_byte, ptrdiff_t lim_byte)
+{
+  bool forward = n > 0;
+  ptrdiff_t BM_tab[0400], stride_for_teases[0400];
+  int *chars, *min_bytes;
+  ptrdiff_t min_len_byte = 0;
+  EMACS_INT result;
+  USE_SAFE_ALLOCA;
+
+  /* Decode the pattern, and find the length of the shortest multibyte
+     form among the equivalents of each of its characters.  */
+  SAFE_NALLOCA (chars, 1, len);
+  SAFE_NALLOCA (min_bytes, 1, len);
+  for (ptrdiff_t i = 0; i < len; i++)
+    {
+      int charlen, c = string_char_and_length (pat, &charlen);
+      int ch = c;
+      pat += charlen;
+      chars[i] = c;
+      while (true)
+	{
+	  charlen = min (charlen, CHAR_BYTES (ch));
+	  TRANSLATE (ch, inverse_trt, ch);
+	  if (ch == c)
+	    break;
+	}
+      min_bytes[i] = charlen;
+      min_len_byte += charlen;
+    }
+
+  /* STRIDE_FOR_TEASES is like BM_tab, but leaves out the last byte
+     (the first, if searching backward) of a match, to go on after a
+     possible match turns out not to be one.  */
+  for (int b = 0; b < 0400; b++)
+    BM_tab[b] = stride_for_teases[b] = min_len_byte;
+  ptrdiff_t dist = 0;
+  for (ptrdiff_t k = 0; k < len; k++)
+    {
+      ptrdiff_t i = forward ? len - 1 - k : k;
+      int c = chars[i], ch = c;
+      while (true)
+	{
+	  unsigned char str[MAX_MULTIBYTE_LENGTH];
+	  int charlen = CHAR_STRING (ch, str);
+	  for (int j = 0; j < charlen; j++)
+	    {
+	      ptrdiff_t d = dist + (forward ? charlen - 1 - j : j);
+	      BM_tab[str[j]] = min (BM_tab[str[j]], d);
+	      if (d > 0)
+		stride_for_teases[str[j]] = min (stride_for_teases[str[j]], d);
+	    }
+	  TRANSLATE (ch, inverse_trt, ch);
+	  if (ch == c)
+	    break;
+	}
+      dist += min_bytes[i];
+    }
+
+  if (forward)
+    {
+      /* The byte position of the last byte of a possible match.  */
+      ptrdiff_t end_byte = pos_byte + min_len_byte - 1;
+
+      while (n > 0 && end_byte < lim_byte)
+	{
+	  ptrdiff_t limit = min (BUFFER_CEILING_OF (end_byte), lim_byte - 1);
+	  limit = min (limit, end_byte + 20000);
+	  unsigned char *p2 = BYTE_POS_ADDR (end_byte);
+	  unsigned char *cursor = p2, *p_limit = p2 + (limit - end_byte);
+	  while (cursor <= p_limit && BM_tab[*cursor] != 0)
+	    cursor += BM_tab[*cursor];
+	  end_byte += cursor - p2;
+	  maybe_quit ();
+	  if (end_byte > limit)
+	    continue;
+
+	  /* Check for a match that ends here, back to POS_BYTE.  */
+	  ptrdiff_t beg_byte = end_byte + 1, i = len;
+	  if (beg_byte == lim_byte || CHAR_HEAD_P (FETCH_BYTE (beg_byte)))
+	    while (i > 0 && beg_byte > pos_byte)
+	      {
+		ptrdiff_t prev_byte = beg_byte - prev_char_len (beg_byte);
+		int ch = FETCH_MULTIBYTE_CHAR (prev_byte);
+		TRANSLATE (ch, trt, ch);
+		if (ch != chars[i - 1])
+		  break;
+		beg_byte = prev_byte;
+		i--;
+	      }
+	  if (i == 0)
+	    {
+	      pos_byte = end_byte + 1;
+	      if (--n == 0)
+		set_search_regs (beg_byte, pos_byte - beg_byte);
+	      end_byte = pos_byte + min_len_byte - 1;
+	    }
+	  else
+	    end_byte += stride_for_teases[FETCH_BYTE (end_byte)];
+	}
+      result = n == 0 ? BYTE_TO_CHAR (pos_byte) : -n;
+    }
+  else
+    {
+      /* The byte position of the first byte of a possible match.  */
+      ptrdiff_t beg_byte = pos_byte - min_len_byte;
+
+      while (n < 0 && beg_byte >= lim_byte)
+	{
+	  ptrdiff_t limit = max (BUFFER_FLOOR_OF (beg_byte), lim_byte);
+	  limit = max (limit, beg_byte - 20000);
+	  unsigned char *p2 = BYTE_POS_ADDR (beg_byte);
+	  unsigned char *cursor = p2, *p_limit = p2 - (beg_byte - limit);
+	  while (cursor >= p_limit && BM_tab[*cursor] != 0)
+	    cursor -= BM_tab[*cursor];
+	  beg_byte -= p2 - cursor;
+	  maybe_quit ();
+	  if (beg_byte < limit)
+	    continue;
+
+	  /* Check for a match that starts here, up to POS_BYTE.  */
+	  ptrdiff_t end_byte = beg_byte, i = 0;
+	  if (CHAR_HEAD_P (FETCH_BYTE (beg_byte)))
+	    while (i < len && end_byte < pos_byte)
+	      {
+		int ch = FETCH_MULTIBYTE_CHAR (end_byte);
+		TRANSLATE (ch, trt, ch);
+		if (ch != chars[i])
+		  break;
+		end_byte += next_char_len (end_byte);
+		i++;
+	      }
+	  if (i == len)
+	    {
+	      pos_byte = beg_byte;
+	      if (++n == 0)
+		set_search_regs (beg_byte, end_byte - beg_byte);
+	      beg_byte = pos_byte - min_len_byte;
+	    }
+	  else
+	    beg_byte -= stride_for_teases[FETCH_BYTE (beg_byte)];
+	}
+      result = n == 0 ? BYTE_TO_CHAR (pos_byte) : n;
+    }
+
+  SAFE_FREE ();
+  return result;
+}
+
 /* Record beginning BEG_BYTE and end BEG_BYTE + NBYTES
    for the overall match just found in the current buffer.
    Also clear out the match data for registers 1 and up.  */
@@ -2332,7 +2904,605 @@ DEFUN ("posix-search-forward", Fposix_search_forward, Sposix_search_forward, 1,
 {
   return search_command (regexp, bound, noerror, count, 1, 1, 1);
 }
+
+static void
+free_match_positions (void *arg)
+{
+  xfree (*(ptrdiff_t **) arg);
+}
+
+DEFUN ("search-all-matches", Fsearch_all_matches, Ssearch_all_matches,
+       1, 4, 0,
+       doc: /* Return the positions of the matches for REGEXP between START and END.
+The value is a vector [BEG1 END1 BEG2 END2 ...] of the beginning and
+end of each match, in order.  START and END default to the beginning
+and end of the accessible portion of the buffer.  Optional fourth
+argument COUNT, if non-nil, is the maximum number of matches to find.
+
+The matches are those that successive calls to `re-search-forward'
+with END as bound would find, starting at START, except that after an
+empty match the search resumes one character further.  This function
+doesn't move point or change the match data, and is faster than such
+a loop when there are many matches.
+
+Search case-sensitivity is determined by the value of the variable
+`case-fold-search', which see.  */)
+  (Lisp_Object regexp, Lisp_Object start, Lisp_Object end, Lisp_Object count)
+{
+  CHECK_STRING (regexp);
+  if (NILP (start))
+    XSETFASTINT (start, BEGV);
+  if (NILP (end))
+    XSETFASTINT (end, ZV);
+  validate_region (&start, &end);
+  EMACS_INT limit = EMACS_INT_MAX;
+  if (!NILP (count))
+    {
+      CHECK_FIXNAT (count);
+      limit = XFIXNAT (count);
+    }
+
+  ptrdiff_t pos_byte = CHAR_TO_BYTE (XFIXNUM (start));
+  ptrdiff_t lim_byte = CHAR_TO_BYTE (XFIXNUM (end));
+  bool multibyte = !NILP (BVAR (current_buffer, enable_multibyte_characters));
+
+  /* This is so set_image_of_range_1 in regex-emacs.c can find the EQV
+     table.  */
+  set_char_table_extras (BVAR (current_buffer, case_canon_table), 2,
+			 BVAR (current_buffer, case_eqv_table));
+  struct regexp_cache *cache_entry
+    = compile_pattern (regexp, &search_regs_1,
+		       (!NILP (BVAR (current_buffer, case_fold_search))
+			? BVAR (current_buffer, case_canon_table)
+			: Qnil),
+		       false, multibyte);
+  struct re_pattern_buffer *bufp = &cache_entry->buf;
+
+  unsigned char *p1 = BEGV_ADDR;
+  ptrdiff_t s1 = GPT_BYTE - BEGV_BYTE;
+  unsigned char *p2 = GAP_END_ADDR;
+  ptrdiff_t s2 = ZV_BYTE - GPT_BYTE;
+  if (s1 < 0)
+    {
+      p2 = p1;
+      s2 = ZV_BYTE - BEGV_BYTE;
+      s1 = 0;
+    }
+  if (s2 < 0)
+    {
+      s1 = ZV_BYTE - BEGV_BYTE;
+      s2 = 0;
+    }
+
+  /* The positions found so far, as character positions.  */
+  ptrdiff_t *positions = NULL;
+  ptrdiff_t npositions = 0, positions_size = 0;
+
+  ptrdiff_t count_specpdl = SPECPDL_INDEX ();
+  record_unwind_protect_ptr (free_match_positions, &positions);
+  freeze_buffer_relocation ();
+  freeze_pattern (cache_entry);
+
+  for (EMACS_INT n = 0; n < limit; n++)
+    {
+      re_match_object = Qnil;
+      ptrdiff_t val = re_search_2 (bufp, (char *) p1, s1, (char *) p2, s2,
+				   pos_byte - BEGV_BYTE, lim_byte - pos_byte,
+				   &search_regs_1, lim_byte - BEGV_BYTE);
+      if (val == -2)
+	{
+	  unbind_to (count_specpdl, Qnil);
+	  matcher_overflow ();
+	}
+      if (val < 0)
+	break;
+
+      ptrdiff_t beg_byte = search_regs_1.start[0] + BEGV_BYTE;
+      ptrdiff_t end_byte = search_regs_1.end[0] + BEGV_BYTE;
+      if (positions_size - npositions < 2)
+	positions = xpalloc (positions, &positions_size, 2, -1,
+			     sizeof *positions);
+      positions[npositions++] = BYTE_TO_CHAR (beg_byte);
+      positions[npositions++] = BYTE_TO_CHAR (end_byte);
+
+      /* Don't find an empty match again at the same place.  */
+      if (beg_byte < end_byte)
+	pos_byte = end_byte;
+      else if (end_byte < lim_byte)
+	pos_byte = end_byte + (multibyte
+			       ? BYTES_BY_CHAR_HEAD (FETCH_BYTE (end_byte))
+			       : 1);
+      else
+	break;
+      maybe_quit ();
+    }
+
+  Lisp_Object result = make_uninit_vector (npositions);
+  for (ptrdiff_t i = 0; i < npositions; i++)
+    ASET (result, i, make_fixnum (positions[i]));
+  return unbind_to (count_specpdl, result);
+}
 
+/* Searching for any of several strings.  The strings are compiled into
+   an Aho-Corasick automaton, which finds all of them in a single pass
+   over the text.  */
+
+#define MULTISEARCH_CACHE_SIZE 8
+
+struct ac_node
+{
+  /* The node to go to when the next character has no edge from this
+     one, and the nearest node on that chain that ends a string, or
+     -1.  */
+  int fail, dict;
+
+  /* The index of the string that this node ends, or -1; and the number
+     of characters read from the root to get here.  */
+  int output, depth;
+
+  /* The edges out of this node, sorted by character, start at this
+     index of the edges of the automaton.  */
+  int first_edge, nedges;
+};
+
+struct ac_edge
+{
+  int c, node;
+};
+
+struct aho_corasick
+{
+  struct ac_node *nodes;
+  struct ac_edge *edges;
+
+  /* The edges out of the root for the characters below 256; 0 if
+     there is none.  */
+  int root_next[256];
+};
+
+/* An automaton, and the strings, translation table and kind of text
+   it was built for.  STRINGS is a vector of copies of the strings, or
+   nil if the entry is unused.  */
+struct multisearch_cache
+{
+  Lisp_Object strings, translate;
+  bool multibyte;
+  struct aho_corasick *ac;
+};
+
+/* The most recently used automata come first.  */
+static struct multisearch_cache multisearch_cache[MULTISEARCH_CACHE_SIZE];
+
+static void
+free_aho_corasick (struct aho_corasick *ac)
+{
+  if (ac)
+    {
+      xfree (ac->nodes);
+      xfree (ac->edges);
+      xfree (ac);
+    }
+}
+
+/* Return the node reached from NODE of AC by an edge for C, or -1.  */
+static int
+ac_goto (struct aho_corasick *ac, int node, int c)
+{
+  if (node == 0 && c < 256)
+    return ac->root_next[c] ? ac->root_next[c] : -1;
+  struct ac_edge *e = ac->edges + ac->nodes[node].first_edge;
+  int lo = 0, hi = ac->nodes[node].nedges;
+  while (lo < hi)
+    {
+      int mid = lo + (hi - lo) / 2;
+      if (e[mid].c < c)
+	lo = mid + 1;
+      else
+	hi = mid;
+    }
+  return lo < ac->nodes[node].nedges && e[lo].c == c ? e[lo].node : -1;
+}
+
+/* Return the node of AC to go to from NODE when reading C.  */
+static int
+ac_next (struct aho_corasick *ac, int node, int c)
+{
+  for (;;)
+    {
+      if (node == 0)
+	{
+	  if (c < 256)
+	    return ac->root_next[c];
+	  int next = ac_goto (ac, 0, c);
+	  return max (next, 0);
+	}
+      int next = ac_goto (ac, node, c);
+      if (next >= 0)
+	return next;
+      node = ac->nodes[node].fail;
+    }
+}
+
+/* Return the character C of a string, as it is to be compared with
+   the characters of a multibyte buffer if MULTIBYTE, or a unibyte
+   buffer otherwise, after translation by TRT if that is non-nil.
+   STRING_MULTIBYTE says whether C comes from a multibyte string.  */
+static int
+ac_string_char (int c, bool string_multibyte, bool multibyte,
+		Lisp_Object trt)
+{
+  if (multibyte)
+    {
+      if (!string_multibyte && !ASCII_CHAR_P (c))
+	c = BYTE8_TO_CHAR (c);
+    }
+  else if (string_multibyte && !ASCII_CHAR_P (c))
+    c = CHAR_TO_BYTE8 (c);
+  if (!NILP (trt) && (multibyte || ASCII_CHAR_P (c)))
+    c = char_table_translate (trt, c);
+  return c;
+}
+
+static int
+ac_compare_edges (const void *a, const void *b)
+{
+  const struct ac_edge *x = a, *y = b;
+  return (x->c > y->c) - (x->c < y->c);
+}
+
+/* Build the automaton that looks for the strings of the vector
+   STRINGS in the text of a multibyte buffer if MULTIBYTE, a unibyte
+   one otherwise, translating characters with TRT if that is
+   non-nil.  */
+static struct aho_corasick *
+make_aho_corasick (Lisp_Object strings, Lisp_Object trt, bool multibyte)
+{
+  ptrdiff_t n = ASIZE (strings), size = 1;
+  for (ptrdiff_t i = 0; i < n; i++)
+    {
+      size += SCHARS (AREF (strings, i));
+      if (size > INT_MAX / 2 || i >= INT_MAX)
+	error ("Too many strings to search for");
+    }
+
+  /* First make a trie, where the children of each node are a list.  */
+  struct aho_corasick *ac = xzalloc (sizeof *ac);
+  struct ac_node *nodes = ac->nodes = xnmalloc (size, sizeof *nodes);
+  int *child = xnmalloc (size, sizeof *child);
+  int *sibling = xnmalloc (size, sizeof *sibling);
+  int *chr = xnmalloc (size, sizeof *chr);
+  int nnodes = 1;
+
+  nodes[0].output = -1;
+  nodes[0].depth = 0;
+  child[0] = -1;
+  for (ptrdiff_t i = 0; i < n; i++)
+    {
+      Lisp_Object string = AREF (strings, i);
+      bool string_multibyte = STRING_MULTIBYTE (string);
+      ptrdiff_t ichar = 0, ibyte = 0;
+      int node = 0;
+      while (ichar < SCHARS (string))
+	{
+	  int c = fetch_string_char_advance (string, &ichar, &ibyte);
+	  c = ac_string_char (c, string_multibyte, multibyte, trt);
+	  int next;
+	  for (next = child[node]; next >= 0; next = sibling[next])
+	    if (chr[next] == c)
+	      break;
+	  if (next < 0)
+	    {
+	      next = nnodes++;
+	      nodes[next].output = -1;
+	      nodes[next].depth = nodes[node].depth + 1;
+	      chr[next] = c;
+	      child[next] = -1;
+	      sibling[next] = child[node];
+	      child[node] = next;
+	    }
+	  node = next;
+	}
+      if (nodes[node].output < 0)
+	nodes[node].output = i;
+    }
+
+  /* Then turn the lists into sorted arrays of edges.  */
+  struct ac_edge *edges = ac->edges = xnmalloc (nnodes, sizeof *edges);
+  int nedges = 0;
+  for (int node = 0; node < nnodes; node++)
+    {
+      nodes[node].first_edge = nedges;
+      for (int next = child[node]; next >= 0; next = sibling[next])
+	{
+	  edges[nedges].c = chr[next];
+	  edges[nedges].node = next;
+	  nedges++;
+	}
+      nodes[node].nedges = nedges - nodes[node].first_edge;
+      qsort (edges + nodes[node].first_edge, nodes[node].nedges,
+	     sizeof *edges, ac_compare_edges);
+    }
+  for (int i = 0; i < nodes[0].nedges; i++)
+    if (edges[i].c < 256)
+      ac->root_next[edges[i].c] = edges[i].node;
+
+  /* Finally compute the failure links, breadth first so that those of
+     the shallower nodes are known.  CHILD is no longer needed, and
+     serves as the queue.  */
+  int *queue = child, head = 0, tail = 0;
+  nodes[0].fail = 0;
+  nodes[0].dict = -1;
+  queue[tail++] = 0;
+  while (head < tail)
+    {
+      int node = queue[head++];
+      struct ac_node *u = &nodes[node];
+      for (int i = 0; i < u->nedges; i++)
+	{
+	  int c = edges[u->first_edge + i].c;
+	  int next = edges[u->first_edge + i].node;
+	  int fail = node == 0 ? 0 : ac_next (ac, u->fail, c);
+	  nodes[next].fail = fail;
+	  nodes[next].dict = (nodes[fail].output >= 0
+			      ? fail : nodes[fail].dict);
+	  queue[tail++] = next;
+	}
+    }
+
+  xfree (child);
+  xfree (sibling);
+  xfree (chr);
+  return ac;
+}
+
+/* Return the element of STRINGS, a list or vector, that comes after
+   the one at TAIL, or at index I for a vector.  */
+static Lisp_Object
+multisearch_string (Lisp_Object strings, ptrdiff_t i, Lisp_Object *tail)
+{
+  if (VECTORP (strings))
+    return AREF (strings, i);
+  Lisp_Object string = XCAR (*tail);
+  *tail = XCDR (*tail);
+  return string;
+}
+
+/* Return the automaton that looks for the N strings of the list or
+   vector STRINGS, making it or taking it from the cache.  TRT and
+   MULTIBYTE are as for make_aho_corasick.  */
+static struct aho_corasick *
+multisearch_automaton (Lisp_Object strings, ptrdiff_t n, Lisp_Object trt,
+		       bool multibyte)
+{
+  struct multisearch_cache entry;
+  int i;
+
+  for (i = 0; i < MULTISEARCH_CACHE_SIZE; i++)
+    {
+      struct multisearch_cache *cp = &multisearch_cache[i];
+      if (NILP (cp->strings))
+	break;
+      if (ASIZE (cp->strings) != n
+	  || !EQ (cp->translate, trt)
+	  || cp->multibyte != multibyte)
+	continue;
+
+      Lisp_Object tail = strings;
+      ptrdiff_t j;
+      for (j = 0; j < n; j++)
+	{
+	  Lisp_Object a = AREF (cp->strings, j);
+	  Lisp_Object b = multisearch_string (strings, j, &tail);
+	  if (! (SBYTES (a) == SBYTES (b)
+		 && STRING_MULTIBYTE (a) == STRING_MULTIBYTE (b)
+		 && !memcmp (SDATA (a), SDATA (b), SBYTES (b))))
+	    break;
+	}
+      if (j == n)
+	{
+	  entry = *cp;
+	  goto found;
+	}
+    }
+
+  /* Not found: replace the least recently used entry.  */
+  if (i == MULTISEARCH_CACHE_SIZE)
+    {
+      i--;
+      free_aho_corasick (multisearch_cache[i].ac);
+      multisearch_cache[i].strings = Qnil;
+      multisearch_cache[i].ac = NULL;
+    }
+  {
+    /* Keep copies, in case the strings are changed later.  */
+    Lisp_Object copies = make_nil_vector (n), tail = strings;
+    for (ptrdiff_t j = 0; j < n; j++)
+      ASET (copies, j,
+	    Fcopy_sequence (multisearch_string (strings, j, &tail)));
+    entry.ac = make_aho_corasick (copies, trt, multibyte);
+    entry.strings = copies;
+    entry.translate = trt;
+    entry.multibyte = multibyte;
+  }
+
+ found:
+  /* Move the entry to the front.  */
+  memmove (&multisearch_cache[1], &multisearch_cache[0],
+	   i * sizeof *multisearch_cache);
+  multisearch_cache[0] = entry;
+  return entry.ac;
+}
+
+/* Look in the current buffer for the first of the strings of AC that
+   occurs between POS and LIM, the longest one if several start at the
+   same place.  POS_BYTE and LIM_BYTE are the byte positions of POS and
+   LIM, and TRT translates the characters of the buffer if it is not
+   nil.  If one is found, return the index of the string, and store
+   where it starts in *BEG, and where it ends in *END and *END_BYTE.
+   Otherwise, return -1.  */
+static int
+multisearch_buffer (struct aho_corasick *ac, Lisp_Object trt,
+		    ptrdiff_t pos, ptrdiff_t pos_byte,
+		    ptrdiff_t lim_byte, ptrdiff_t *beg,
+		    ptrdiff_t *end, ptrdiff_t *end_byte)
+{
+  bool multibyte = !NILP (BVAR (current_buffer, enable_multibyte_characters));
+  struct ac_node *nodes = ac->nodes;
+  int node = 0, found = -1;
+  ptrdiff_t best = -1;
+
+  for (;;)
+    {
+      /* Of the strings that end here, the longest one starts
+	 first.  */
+      int out = nodes[node].output >= 0 ? node : nodes[node].dict;
+      if (out >= 0 && (found < 0 || pos - nodes[out].depth <= best))
+	{
+	  found = nodes[out].output;
+	  best = pos - nodes[out].depth;
+	  *end = pos;
+	  *end_byte = pos_byte;
+	}
+
+      /* Stop when no string can be found that starts before the one
+	 found, or at the same place and is longer.  */
+      if (found >= 0 && pos - nodes[node].depth > best)
+	break;
+      if (pos_byte == lim_byte)
+	break;
+
+      /* Read the next character.  Look for quits now and then.  */
+      if ((pos & 0xffff) == 0)
+	maybe_quit ();
+      unsigned char *p = BYTE_POS_ADDR (pos_byte);
+      int c, len = 1;
+      if (!multibyte || ASCII_CHAR_P (*p))
+	c = *p;
+      else
+	c = string_char_and_length (p, &len);
+      if (!NILP (trt) && (multibyte || ASCII_CHAR_P (c)))
+	c = char_table_translate (trt, c);
+      node = ac_next (ac, node, c);
+      pos++;
+      pos_byte += len;
+    }
+
+  *beg = best;
+  return found;
+}
+
+DEFUN ("search-forward-any", Fsearch_forward_any, Ssearch_forward_any,
+       1, 4, 0,
+       doc: /* Search forward from point for any of the strings in STRINGS.
+STRINGS is a list or vector of strings.  Set point to the end of the
+occurrence found, and return point.  The occurrence found is the one
+that starts first; of several strings found at the same place, the
+longest one, and of several equal strings, the first one in STRINGS.
+
+Match data is set as for a regular expression that is an alternation
+of the strings, each in a group of its own: when the string at index N
+in STRINGS is found, subexpression N+1 is set to the text it matched,
+and the other subexpressions are unset.  For instance, when
+`match-data' returns a list of 2K+2 elements, the string found is the
+one at index K-1.
+
+An optional second argument bounds the search; it is a buffer position.
+  The match found must not end after that position.  A value of nil
+  means search to the end of the accessible portion of the buffer.
+Optional third argument, if t, means if fail just return nil (no error).
+  If not nil and not t, move to limit of search and return nil.
+Optional fourth argument COUNT, if a positive number, means to search
+  for COUNT successive occurrences, each starting at the end of the
+  previous one.  A value of nil means the same as 1.
+
+Search case-sensitivity is determined by the value of the variable
+`case-fold-search', which see.
+
+The strings are compiled into an automaton that finds all of them in a
+single pass over the text, and that is cached for the next searches
+for the same strings.  This is much faster than searching for a
+regular expression made of many alternatives.  */)
+  (Lisp_Object strings, Lisp_Object bound, Lisp_Object noerror,
+   Lisp_Object count)
+{
+  ptrdiff_t n, lim, lim_byte;
+  intmax_t repeat = (NILP (count) ? 1
+		     : check_integer_range (count, 1, INTMAX_MAX));
+
+  if (VECTORP (strings))
+    n = ASIZE (strings);
+  else
+    n = list_length (strings);
+  Lisp_Object tail = strings;
+  for (ptrdiff_t i = 0; i < n; i++)
+    CHECK_STRING (multisearch_string (strings, i, &tail));
+
+  if (NILP (bound))
+    lim = ZV, lim_byte = ZV_BYTE;
+  else
+    {
+      lim = fix_position (bound);
+      if (lim < PT)
+	error ("Invalid search bound (wrong side of point)");
+      if (lim > ZV)
+	lim = ZV, lim_byte = ZV_BYTE;
+      else
+	lim_byte = CHAR_TO_BYTE (lim);
+    }
+
+  if (running_asynch_code)
+    save_search_regs ();
+
+  Lisp_Object trt = (!NILP (BVAR (current_buffer, case_fold_search))
+		     ? BVAR (current_buffer, case_canon_table) : Qnil);
+  bool multibyte = !NILP (BVAR (current_buffer, enable_multibyte_characters));
+  struct aho_corasick *ac = multisearch_automaton (strings, n, trt, multibyte);
+  ptrdiff_t pos = PT, pos_byte = PT_BYTE, beg;
+  int found = -1;
+
+  ptrdiff_t count1 = SPECPDL_INDEX ();
+  freeze_buffer_relocation ();
+  for (; repeat > 0; repeat--)
+    {
+      found = multisearch_buffer (ac, trt, pos, pos_byte, lim_byte,
+				  &beg, &pos, &pos_byte);
+      if (found < 0)
+	break;
+    }
+  unbind_to (count1, Qnil);
+
+  if (found < 0)
+    {
+      if (NILP (noerror))
+	xsignal1 (Qsearch_failed, strings);
+      if (!EQ (noerror, Qt))
+	SET_PT_BOTH (lim, lim_byte);
+      return Qnil;
+    }
+
+  if (NILP (Vinhibit_changing_match_data))
+    {
+      set_search_regs (CHAR_TO_BYTE (beg), pos_byte - CHAR_TO_BYTE (beg));
+      if (search_regs.num_regs < found + 2)
+	{
+	  ptrdiff_t num_regs = search_regs.num_regs;
+	  search_regs.start =
+	    xpalloc (search_regs.start, &num_regs, found + 2 - num_regs,
+		     min (PTRDIFF_MAX, UINT_MAX), sizeof *search_regs.start);
+	  search_regs.end =
+	    xrealloc (search_regs.end, num_regs * sizeof *search_regs.end);
+	  for (ptrdiff_t i = search_regs.num_regs; i < num_regs; i++)
+	    search_regs.start[i] = search_regs.end[i] = -1;
+	  search_regs.num_regs = num_regs;
+	}
+      search_regs.start[found + 1] = beg;
+      search_regs.end[found + 1] = pos;
+    }
+
+  SET_PT_BOTH (pos, pos_byte);
+  return make_fixnum (pos);
+}
+
 DEFUN ("replace-match", Freplace_match, Sreplace_match, 1, 5, 0,
        doc: /* Replace text matched by last search with NEWTEXT.
 Leave point at the end of the replacement text.
@@ -2753,6 +3923,168 @@ DEFUN ("replace-match", Freplace_match, Sreplace_match, 1, 5, 0,
 
   return Qnil;
 }
+
+/* Search for the pattern BUFP in the current buffer from POS_BYTE, for
+   a match that ends before LIM_BYTE.  If found, set the match data and
+   return true.  */
+
+static bool
+search_regs_in_buffer (struct re_pattern_buffer *bufp, ptrdiff_t pos_byte,
+		       ptrdiff_t lim_byte)
+{
+  unsigned char *p1 = BEGV_ADDR;
+  ptrdiff_t s1 = GPT_BYTE - BEGV_BYTE;
+  unsigned char *p2 = GAP_END_ADDR;
+  ptrdiff_t s2 = ZV_BYTE - GPT_BYTE;
+  if (s1 < 0)
+    {
+      p2 = p1;
+      s2 = ZV_BYTE - BEGV_BYTE;
+      s1 = 0;
+    }
+  if (s2 < 0)
+    {
+      s1 = ZV_BYTE - BEGV_BYTE;
+      s2 = 0;
+    }
+
+  ptrdiff_t count = SPECPDL_INDEX ();
+  freeze_buffer_relocation ();
+  re_match_object = Qnil;
+  ptrdiff_t val = re_search_2 (bufp, (char *) p1, s1, (char *) p2, s2,
+			       pos_byte - BEGV_BYTE, lim_byte - pos_byte,
+			       &search_regs, lim_byte - BEGV_BYTE);
+  unbind_to (count, Qnil);
+  if (val == -2)
+    matcher_overflow ();
+  if (val < 0)
+    return false;
+
+  for (ptrdiff_t i = 0; i < search_regs.num_regs; i++)
+    if (search_regs.start[i] >= 0)
+      {
+	search_regs.start[i] = BYTE_TO_CHAR (search_regs.start[i] + BEGV_BYTE);
+	search_regs.end[i] = BYTE_TO_CHAR (search_regs.end[i] + BEGV_BYTE);
+      }
+  XSETBUFFER (last_thing_searched, current_buffer);
+  return true;
+}
+
+/* The text that 'replace-regexp-in-region' replaces, from FROM to the
+   marker END, as it was before the first replacement, and the undo
+   list of the buffer, which is t while it replaces the matches.  */
+struct replace_in_region
+{
+  ptrdiff_t from;
+  Lisp_Object end, original, undo_list;
+};
+
+/* Record the replacement of the text described by ARG for undo, as a
+   single change, and run the hooks after the change.  */
+
+static void
+finish_replace_in_region (void *arg)
+{
+  struct replace_in_region *r = arg;
+  ptrdiff_t inserted = marker_position (r->end) - r->from;
+  unchain_marker (XMARKER (r->end));
+
+  /* Extend the empty insertion recorded before the first replacement,
+     and record the deletion after it, like replace_range.  */
+  bset_undo_list (current_buffer, r->undo_list);
+  record_insert (r->from + SCHARS (r->original), inserted);
+  record_delete (r->from, r->original, false);
+
+  signal_after_change (r->from, SCHARS (r->original), inserted);
+}
+
+DEFUN ("replace-regexp-in-region", Freplace_regexp_in_region,
+       Sreplace_regexp_in_region, 2, 6, 0,
+       doc: /* Replace REGEXP with REPLACEMENT in the region from START to END.
+Return the number of replacements, or nil if REGEXP isn't found.
+START defaults to point, and END to the end of the accessible portion
+of the buffer.  Point doesn't move.
+
+Each match is replaced as by `replace-match', to which REPLACEMENT and
+the optional arguments FIXEDCASE and LITERAL are passed.  So unless
+LITERAL is non-nil, REPLACEMENT can refer to the matched text with
+`\\&' and `\\N', and unless FIXEDCASE is non-nil, its case is converted
+to that of the matched text.  After an empty match, the search for the
+next one starts one character further.  The match data are those of
+the last replacement.
+
+This is much faster than calling `re-search-forward' and
+`replace-match' in a loop when there are many matches, because the
+whole replacement counts as a single change: `before-change-functions'
+and `after-change-functions' are called once, for the text from the
+first match to END, and a single undo entry is recorded.
+
+Search case-sensitivity is determined by the value of the variable
+`case-fold-search', which see.  */)
+  (Lisp_Object regexp, Lisp_Object replacement, Lisp_Object start,
+   Lisp_Object end, Lisp_Object fixedcase, Lisp_Object literal)
+{
+  CHECK_STRING (regexp);
+  CHECK_STRING (replacement);
+  if (NILP (start))
+    XSETFASTINT (start, PT);
+  if (NILP (end))
+    XSETFASTINT (end, ZV);
+  validate_region (&start, &end);
+
+  /* This is so set_image_of_range_1 in regex-emacs.c can find the EQV
+     table.  */
+  set_char_table_extras (BVAR (current_buffer, case_canon_table), 2,
+			 BVAR (current_buffer, case_eqv_table));
+  struct regexp_cache *cache_entry
+    = compile_pattern (regexp, &search_regs,
+		       (!NILP (BVAR (current_buffer, case_fold_search))
+			? BVAR (current_buffer, case_canon_table)
+			: Qnil),
+		       false,
+		       !NILP (BVAR (current_buffer, enable_multibyte_characters)));
+  struct re_pattern_buffer *bufp = &cache_entry->buf;
+
+  ptrdiff_t count = SPECPDL_INDEX ();
+  freeze_pattern (cache_entry);
+  record_unwind_protect_excursion ();
+
+  if (!search_regs_in_buffer (bufp, CHAR_TO_BYTE (XFIXNUM (start)),
+			      CHAR_TO_BYTE (XFIXNUM (end))))
+    return unbind_to (count, Qnil);
+
+  struct replace_in_region r;
+  r.from = search_regs.start[0];
+  r.end = build_marker (current_buffer, XFIXNUM (end),
+			CHAR_TO_BYTE (XFIXNUM (end)));
+  prepare_to_modify_buffer (r.from, marker_position (r.end), &r.from);
+  r.original = make_buffer_string (r.from, marker_position (r.end), true);
+  record_insert (r.from + SCHARS (r.original), 0);
+  r.undo_list = BVAR (current_buffer, undo_list);
+  record_unwind_protect_ptr (finish_replace_in_region, &r);
+  bset_undo_list (current_buffer, Qt);
+  specbind (Qinhibit_modification_hooks, Qt);
+
+  EMACS_INT n = 0;
+  bool multibyte = !NILP (BVAR (current_buffer, enable_multibyte_characters));
+  ptrdiff_t pos_byte = CHAR_TO_BYTE (r.from);
+  while (search_regs_in_buffer (bufp, pos_byte, marker_byte_position (r.end)))
+    {
+      bool empty = search_regs.start[0] == search_regs.end[0];
+      Freplace_match (replacement, fixedcase, literal, Qnil, Qnil);
+      n++;
+      pos_byte = CHAR_TO_BYTE (search_regs.end[0]);
+      if (empty)
+	{
+	  if (pos_byte >= marker_byte_position (r.end))
+	    break;
+	  pos_byte += multibyte ? BYTES_BY_CHAR_HEAD (FETCH_BYTE (pos_byte)) : 1;
+	}
+      maybe_quit ();
+    }
+
+  return unbind_to (count, make_fixnum (n));
+}
 
 static Lisp_Object
 match_limit (Lisp_Object num, bool beginningp)
@@ -3319,11 +4651,10 @@ DEFUN ("newline-cache-check", Fnewline_cache_check, Snewline_cache_check,
 void
 syms_of_search (void)
 {
-  for (int i = 0; i < REGEXP_CACHE_SIZE; ++i)
+  for (int i = 0; i < MULTISEARCH_CACHE_SIZE; i++)
     {
-      staticpro (&searchbufs[i].regexp);
-      staticpro (&searchbufs[i].f_whitespace_regexp);
-      staticpro (&searchbufs[i].syntax_table);
+      staticpro (&multisearch_cache[i].strings);
+      staticpro (&multisearch_cache[i].translate);
     }
 
   /* Error condition used for failing searches.  */
@@ -3353,6 +4684,8 @@ syms_of_search (void)
 
   re_match_object = Qnil;
   staticpro (&re_match_object);
+  regexp_profile_table = Qnil;
+  staticpro (&regexp_profile_table);
 
   DEFVAR_LISP ("search-spaces-regexp", Vsearch_spaces_regexp,
       doc: /* Regexp to substitute for bunches of spaces in regexp search.
@@ -3364,6 +4697,11 @@ syms_of_search (void)
 numbering of existing capture groups in unexpected ways.  */);
   Vsearch_spaces_regexp = Qnil;
 
+  DEFSYM (Qentries, "entries");
+  DEFSYM (Qhits, "hits");
+  DEFSYM (Qmisses, "misses");
+  DEFSYM (Qcompile_time, "compile-time");
+
   DEFSYM (Qinhibit_changing_match_data, "inhibit-changing-match-data");
   DEFVAR_LISP ("inhibit-changing-match-data", Vinhibit_changing_match_data,
       doc: /* Internal use only.
@@ -3373,6 +4711,47 @@ syms_of_search (void)
 is to bind it with `let' around a small expression.  */);
   Vinhibit_changing_match_data = Qnil;
 
+  DEFVAR_BOOL ("regexp-use-dfa", regexp_use_dfa,
+	       doc: /* Non-nil means regexp searches can skip text using a DFA.
+For a regexp without back references or repetition counts, the
+searching functions build a deterministic automaton that tells in one
+pass over the text where a match can start, and try to match only
+there.  This avoids retrying the match at each position of the text,
+which can take a long time, and even fail with "Stack overflow in
+regexp matcher", on long lines.  It doesn't change what matches.  */);
+  regexp_use_dfa = true;
+
+  DEFVAR_BOOL ("regexp-memoize-backtracking", regexp_memoize_backtracking,
+	       doc: /* Non-nil means the regexp matcher remembers where it failed.
+When backtracking leads the matcher to a place in the regexp and a
+position in the text from which it already failed to match, it fails
+right away instead of trying everything again.  Regexps like
+"\\(a*\\)*b", which otherwise take exponential time, then take time
+bounded by the size of the regexp times the size of the text, at the
+cost of some memory and of a slightly slower matcher.  Back references
+make the groups they refer to part of the place remembered, and regexps
+with repetition counts like "a\\{2,5\\}" are matched as usual.
+It doesn't change what matches.  */);
+  regexp_memoize_backtracking = false;
+
+  DEFVAR_BOOL ("regexp-profile", regexp_profile,
+	       doc: /* Non-nil means count what each regexp costs.
+While this is non-nil, the searching and matching functions count, for
+each regexp, the number of times it is used, the amount of text gone
+over, how much it backtracks and the time taken.  This slows them down
+slightly.  Use `regexp-profile-report' to see the counts, to find the
+regexps that make a program slow, such as font-lock keywords.  */);
+  regexp_profile = false;
+
+  DEFVAR_INT ("regexp-cache-size", regexp_cache_size,
+	      doc: /* Number of compiled regexps that are kept for reuse.
+The searching and matching functions compile each regexp they are
+given, and keep the result in a cache for the next searches with the
+same regexp.  If a program uses more distinct regexps than this in
+turn, each search has to compile its regexp again; see
+`regexp-cache-stats'.  */);
+  regexp_cache_size = REGEXP_CACHE_SIZE;
+
   defsubr (&Slooking_at);
   defsubr (&Sposix_looking_at);
   defsubr (&Sstring_match);
@@ -3383,13 +4762,18 @@ syms_of_search (void)
   defsubr (&Sre_search_backward);
   defsubr (&Sposix_search_forward);
   defsubr (&Sposix_search_backward);
+  defsubr (&Ssearch_all_matches);
+  defsubr (&Ssearch_forward_any);
   defsubr (&Sreplace_match);
+  defsubr (&Sreplace_regexp_in_region);
   defsubr (&Smatch_beginning);
   defsubr (&Smatch_end);
   defsubr (&Smatch_data);
   defsubr (&Sset_match_data);
   defsubr (&Sregexp_quote);
   defsubr (&Snewline_cache_check);
+  defsubr (&Sregexp_cache_stats);
+  defsubr (&Sregexp_profile_data);
 
   pdumper_do_now_and_after_load (syms_of_search_for_pdumper);
 }
@@ -3397,16 +4781,16 @@ syms_of_search (void)
 static void
 syms_of_search_for_pdumper (void)
 {
-  for (int i = 0; i < REGEXP_CACHE_SIZE; ++i)
+  searchbuf_head = searchbuf_tail = NULL;
+  searchbuf_count = 0;
+  searchbuf_buckets = NULL;
+  searchbuf_nbuckets = 0;
+  regexp_cache_hits = regexp_cache_misses = 0;
+  regexp_cache_compile_time = make_timespec (0, 0);
+  for (int i = 0; i < MULTISEARCH_CACHE_SIZE; i++)
     {
-      searchbufs[i].buf.allocated = 100;
-      searchbufs[i].buf.buffer = xmalloc (100);
-      searchbufs[i].buf.fastmap = searchbufs[i].fastmap;
-      searchbufs[i].regexp = Qnil;
-      searchbufs[i].f_whitespace_regexp = Qnil;
-      searchbufs[i].busy = false;
-      searchbufs[i].syntax_table = Qnil;
-      searchbufs[i].next = (i == REGEXP_CACHE_SIZE-1 ? 0 : &searchbufs[i+1]);
+      multisearch_cache[i].strings = Qnil;
+      multisearch_cache[i].translate = Qnil;
+      multisearch_cache[i].ac = NULL;
     }
-  searchbuf_head = &searchbufs[0];
 }
@@ -177,6 +177,62 @@ SYNTAX_COMEND_FIRST (int c)
 static ptrdiff_t find_start_begv;
 static modiff_count find_start_modiff;
 
+/* Checkpoints of the parse from the beginning of a buffer.
+
+   When `parse-sexp-use-checkpoints' is non-nil, `parse-partial-sexp'
+   called from BEGV with no other optional argument than TO records the
+   state of the parse every PARSE_STATE_CHECKPOINT_INTERVAL characters,
+   as well as the state at TO.  Later calls start from the closest
+   recorded state before their own TO, so that they take time
+   proportional to the distance from that state instead of the
+   distance from BEGV.
+
+   A set of checkpoints is valid for one value of BEGV, one syntax
+   table and one setting of the variables that change the way the
+   buffer is parsed.  The checkpoints are kept in the base buffer,
+   since that is where the modifications are reported, so a buffer
+   keeps up to PARSE_STATE_CACHE_MAX sets, the most recently used
+   first; an indirect buffer with its own narrowing or syntax table
+   then doesn't discard the states recorded for its base buffer.
+   Modifications of the text or of the text properties discard the
+   states recorded after the start of the modified region in every
+   set.  */
+
+enum { PARSE_STATE_CHECKPOINT_INTERVAL = 4096 };
+enum { PARSE_STATE_CACHE_MAX = 4 };
+
+struct parse_state_cache
+{
+  /* The next set of checkpoints of the same buffer.  */
+  struct parse_state_cache *next;
+
+  /* The conditions under which the states below were computed.  */
+  ptrdiff_t begv;
+  Lisp_Object syntax_table;
+  modiff_count syntax_table_modiff;
+  bool_bf lookup_properties : 1;
+  bool_bf comment_end_escapable : 1;
+
+  /* Whether LAST holds the state at LAST.location.  */
+  bool_bf last_valid : 1;
+
+  /* Incremented whenever states are discarded.  */
+  modiff_count tick;
+
+  /* STATES[I] is the state at BEGV + (I + 1)
+     * PARSE_STATE_CHECKPOINT_INTERVAL, for I < NSTATES.
+     SIZE is the allocated size of STATES.  */
+  struct lisp_parse_state *states;
+  ptrdiff_t nstates, size;
+
+  /* The state returned by the most recent lookup.  */
+  struct lisp_parse_state last;
+};
+
+/* Incremented by `modify-syntax-entry', which can change the way the
+   text is parsed without changing the syntax table object itself.  */
+static modiff_count syntax_table_modiff;
+
 
 static Lisp_Object skip_chars (bool, Lisp_Object, Lisp_Object, bool);
 static Lisp_Object skip_syntaxes (bool, Lisp_Object, Lisp_Object);
@@ -1268,6 +1324,9 @@ c (on any of its chars) using this flag:
      different values from those in the compiled regexps.*/
   clear_regexp_cache ();
 
+  /* Likewise, recorded parse states may no longer be valid.  */
+  modiff_incr (&syntax_table_modiff);
+
   return Qnil;
 }
 
@@ -3516,6 +3575,199 @@ internalize_parse_state (Lisp_Object external, struct lisp_parse_state *state)
     }
 }
 
+/* Discard the parse states of buffer BUF which are after position POS,
+   because the text or its properties changed there.  */
+
+void
+invalidate_parse_state_cache (struct buffer *buf, ptrdiff_t pos)
+{
+  for (struct parse_state_cache *cache = buf->parse_state_cache;
+       cache; cache = cache->next)
+    {
+      modiff_incr (&cache->tick);
+      if (cache->last_valid && pos < cache->last.location)
+	cache->last_valid = false;
+      if (pos < cache->begv)
+	cache->nstates = 0;
+      else
+	cache->nstates = min (cache->nstates,
+			      ((pos - cache->begv)
+			       / PARSE_STATE_CHECKPOINT_INTERVAL));
+    }
+}
+
+void
+free_parse_state_cache (struct parse_state_cache *cache)
+{
+  while (cache)
+    {
+      struct parse_state_cache *next = cache->next;
+      xfree (cache->states);
+      xfree (cache);
+      cache = next;
+    }
+}
+
+void
+mark_parse_state_cache (struct parse_state_cache *cache)
+{
+  for (; cache; cache = cache->next)
+    {
+      mark_object (cache->syntax_table);
+      for (ptrdiff_t i = 0; i < cache->nstates; i++)
+	mark_object (cache->states[i].levelstarts);
+      if (cache->last_valid)
+	mark_object (cache->last.levelstarts);
+    }
+}
+
+/* Return true if CACHE is one of the sets of checkpoints of buffer B.
+   Lisp code run while parsing can kill B or swap its text.  */
+
+static bool
+parse_state_cache_live_p (struct buffer *b, struct parse_state_cache *cache)
+{
+  for (struct parse_state_cache *c = b->parse_state_cache; c; c = c->next)
+    if (c == cache)
+      return true;
+  return false;
+}
+
+/* Return the set of checkpoints of the current buffer for its BEGV
+   and syntax table, moved to the front of the sets of its base
+   buffer.  If there is none, reuse the least recently used set when
+   there are PARSE_STATE_CACHE_MAX of them.  Empty the set if it was
+   computed under different conditions.  */
+
+static struct parse_state_cache *
+current_parse_state_cache (void)
+{
+  struct buffer *b = (current_buffer->base_buffer
+		      ? current_buffer->base_buffer : current_buffer);
+  Lisp_Object table = BVAR (current_buffer, syntax_table);
+  struct parse_state_cache **prev = &b->parse_state_cache, *cache;
+  int n = 0;
+
+  for (cache = *prev; cache; cache = *prev)
+    {
+      n++;
+      if ((cache->begv == BEGV && EQ (cache->syntax_table, table))
+	  || (!cache->next && n == PARSE_STATE_CACHE_MAX))
+	break;
+      prev = &cache->next;
+    }
+  if (cache)
+    *prev = cache->next;
+  else
+    {
+      cache = xzalloc (sizeof *cache);
+      cache->syntax_table = Qnil;
+    }
+  cache->next = b->parse_state_cache;
+  b->parse_state_cache = cache;
+
+  if (cache->begv != BEGV
+      || !EQ (cache->syntax_table, table)
+      || cache->syntax_table_modiff != syntax_table_modiff
+      || cache->lookup_properties != parse_sexp_lookup_properties
+      || cache->comment_end_escapable != comment_end_can_be_escaped)
+    {
+      cache->begv = BEGV;
+      cache->syntax_table = table;
+      cache->syntax_table_modiff = syntax_table_modiff;
+      cache->lookup_properties = parse_sexp_lookup_properties;
+      cache->comment_end_escapable = comment_end_can_be_escaped;
+      cache->last_valid = false;
+      cache->nstates = 0;
+      modiff_incr (&cache->tick);
+    }
+  return cache;
+}
+
+/* Set STATE to the state of the parse from BEGV to TO, starting from
+   the closest checkpoint of the current buffer and recording new
+   checkpoints on the way.  */
+
+static void
+scan_sexps_forward_from_checkpoint (struct lisp_parse_state *state,
+				    ptrdiff_t to)
+{
+  struct buffer *b = (current_buffer->base_buffer
+		      ? current_buffer->base_buffer : current_buffer);
+  struct parse_state_cache *cache = current_parse_state_cache ();
+  ptrdiff_t n = min (cache->nstates,
+		     (to - BEGV) / PARSE_STATE_CHECKPOINT_INTERVAL);
+  ptrdiff_t from;
+  modiff_count tick;
+
+  if (n > 0)
+    *state = cache->states[n - 1];
+  else
+    internalize_parse_state (Qnil, state);
+  from = n > 0 ? state->location : BEGV;
+  if (cache->last_valid
+      && from < cache->last.location && cache->last.location <= to)
+    {
+      *state = cache->last;
+      from = state->location;
+    }
+
+  while (true)
+    {
+      ptrdiff_t next = (BEGV + (cache->nstates + 1)
+			* PARSE_STATE_CHECKPOINT_INTERVAL);
+      if (! (from < next && next <= to))
+	break;
+      /* syntax-propertize can run Lisp code while we scan, which could
+	 modify the buffer; record the new state only if it did not.  */
+      tick = cache->tick;
+      scan_sexps_forward (state, from, CHAR_TO_BYTE (from), next,
+			  TYPE_MINIMUM (EMACS_INT), false, 0);
+      from = next;
+      if (!parse_state_cache_live_p (b, cache) || cache->tick != tick)
+	break;
+      if (cache->nstates == cache->size)
+	cache->states = xpalloc (cache->states, &cache->size, 1, -1,
+				 sizeof *cache->states);
+      cache->states[cache->nstates++] = *state;
+    }
+
+  bool record = parse_state_cache_live_p (b, cache);
+  if (record)
+    tick = cache->tick;
+  scan_sexps_forward (state, from, CHAR_TO_BYTE (from), to,
+		      TYPE_MINIMUM (EMACS_INT), false, 0);
+  if (record && parse_state_cache_live_p (b, cache) && cache->tick == tick)
+    {
+      cache->last = *state;
+      cache->last_valid = true;
+    }
+}
+
+DEFUN ("parse-sexp-flush-checkpoints", Fparse_sexp_flush_checkpoints,
+       Sparse_sexp_flush_checkpoints, 0, 1, 0,
+       doc: /* Discard the parse states recorded after POS in the current buffer.
+If POS is omitted or nil, discard all of them.
+The states are those recorded when `parse-sexp-use-checkpoints' is
+non-nil.  They are discarded automatically when the buffer text, its
+text properties or its syntax table change; this function is needed only
+when something else which affects parsing changes, like the parent of
+the syntax table.  */)
+  (Lisp_Object pos)
+{
+  struct buffer *b = (current_buffer->base_buffer
+		      ? current_buffer->base_buffer : current_buffer);
+
+  if (NILP (pos))
+    invalidate_parse_state_cache (b, PTRDIFF_MIN);
+  else
+    {
+      CHECK_FIXNUM_COERCE_MARKER (pos);
+      invalidate_parse_state_cache (b, XFIXNUM (pos));
+    }
+  return Qnil;
+}
+
 DEFUN ("parse-partial-sexp", Fparse_partial_sexp, Sparse_partial_sexp, 2, 6, 0,
        doc: /* Parse Lisp syntax starting at FROM until TO; return status of parse at TO.
 Parsing stops at TO or when certain criteria are met;
@@ -3568,12 +3820,19 @@ DEFUN ("parse-partial-sexp", Fparse_partial_sexp, Sparse_partial_sexp, 2, 6, 0,
     target = TYPE_MINIMUM (EMACS_INT);	/* We won't reach this depth.  */
 
   validate_region (&from, &to);
-  internalize_parse_state (oldstate, &state);
-  scan_sexps_forward (&state, XFIXNUM (from), CHAR_TO_BYTE (XFIXNUM (from)),
-		      XFIXNUM (to),
-		      target, !NILP (stopbefore),
-		      (NILP (commentstop)
-		       ? 0 : (EQ (commentstop, Qsyntax_table) ? -1 : 1)));
+  if (parse_sexp_use_checkpoints && XFIXNUM (from) == BEGV
+      && NILP (targetdepth) && NILP (stopbefore) && NILP (oldstate)
+      && NILP (commentstop))
+    scan_sexps_forward_from_checkpoint (&state, XFIXNUM (to));
+  else
+    {
+      internalize_parse_state (oldstate, &state);
+      scan_sexps_forward (&state, XFIXNUM (from),
+			  CHAR_TO_BYTE (XFIXNUM (from)), XFIXNUM (to),
+			  target, !NILP (stopbefore),
+			  (NILP (commentstop)
+			   ? 0 : (EQ (commentstop, Qsyntax_table) ? -1 : 1)));
+    }
 
   SET_PT_BOTH (state.location, state.location_byte);
 
@@ -3722,6 +3981,17 @@ syms_of_syntax (void)
 See the info node `(elisp)Syntax Properties' for a description of the
 `syntax-table' property.  */);
 
+  DEFVAR_BOOL ("parse-sexp-use-checkpoints", parse_sexp_use_checkpoints,
+	       doc: /* Non-nil means `parse-partial-sexp' records and reuses parse states.
+This applies only when it is called from the beginning of the
+accessible portion of the buffer with no optional arguments, as in
+\=`(parse-partial-sexp (point-min) POS)'.  The state is then computed
+from a state recorded at an earlier call, which is much faster in large
+buffers.  Elements 2 and 6 of the result cannot be relied upon in that
+case, since they describe only the part of the text scanned by the
+last call.  `syntax-ppss' binds this variable to t.  */);
+  parse_sexp_use_checkpoints = false;
+
   DEFVAR_INT ("syntax-propertize--done", syntax_propertize__done,
 	      doc: /* Position up to which syntax-table properties have been set.  */);
   syntax_propertize__done = -1;
@@ -3789,4 +4059,5 @@ syms_of_syntax (void)
   defsubr (&Sscan_sexps);
   defsubr (&Sbackward_prefix_chars);
   defsubr (&Sparse_partial_sexp);
+  defsubr (&Sparse_sexp_flush_checkpoints);
 }
@@ -85,6 +85,9 @@ modify_text_properties (Lisp_Object buffer, Lisp_Object start, Lisp_Object end)
 
   prepare_to_modify_buffer_1 (b, e, NULL);
 
+  /* Text properties can change the syntax of characters.  */
+  invalidate_parse_state_cache (buf->base_buffer ? buf->base_buffer : buf, b);
+
   BUF_COMPUTE_UNCHANGED (buf, b - 1, e);
   if (MODIFF <= SAVE_MODIFF)
     record_first_change ();
@@ -636,7 +639,7 @@ get_char_property_and_overlay (Lisp_Object position, register Lisp_Object prop,
       set_buffer_temp (XBUFFER (object));
 
       USE_SAFE_ALLOCA;
-      GET_OVERLAYS_AT (pos, overlay_vec, noverlays, NULL, false);
+      GET_OVERLAYS_AT (pos, overlay_vec, noverlays, NULL);
       noverlays = sort_overlays (overlay_vec, noverlays, w);
 
       set_buffer_temp (obuf);
@@ -128,31 +128,32 @@ record_marker_adjustments (ptrdiff_t from, ptrdiff_t to)
 {
   prepare_record ();
 
-  for (struct Lisp_Marker *m = BUF_MARKERS (current_buffer); m; m = m->next)
+  /* Consing can collect garbage, which can rebuild the tree of
+     markers, but M stays in it since it is on the undo list.  */
+  for (struct Lisp_Marker *m = marker_tree_first (current_buffer, from);
+       m && marker_charpos (m) <= to;
+       m = marker_tree_next (current_buffer, m))
     {
-      ptrdiff_t charpos = m->charpos;
+      ptrdiff_t charpos = marker_charpos (m);
       eassert (charpos <= Z);
 
-      if (from <= charpos && charpos <= to)
-        {
-          /* insertion_type nil markers will end up at the beginning of
-             the re-inserted text after undoing a deletion, and must be
-             adjusted to move them to the correct place.
-
-             insertion_type t markers will automatically move forward
-             upon re-inserting the deleted text, so we have to arrange
-             for them to move backward to the correct position.  */
-	  ptrdiff_t adjustment = (m->insertion_type ? to : from) - charpos;
-
-          if (adjustment)
-            {
-	      Lisp_Object marker = make_lisp_ptr (m, Lisp_Vectorlike);
-              bset_undo_list
-                (current_buffer,
-                 Fcons (Fcons (marker, make_fixnum (adjustment)),
-                        BVAR (current_buffer, undo_list)));
-            }
-        }
+      /* insertion_type nil markers will end up at the beginning of
+	 the re-inserted text after undoing a deletion, and must be
+	 adjusted to move them to the correct place.
+
+	 insertion_type t markers will automatically move forward
+	 upon re-inserting the deleted text, so we have to arrange
+	 for them to move backward to the correct position.  */
+      ptrdiff_t adjustment = (m->insertion_type ? to : from) - charpos;
+
+      if (adjustment)
+	{
+	  Lisp_Object marker = make_lisp_ptr (m, Lisp_Vectorlike);
+	  bset_undo_list
+	    (current_buffer,
+	     Fcons (Fcons (marker, make_fixnum (adjustment)),
+		    BVAR (current_buffer, undo_list)));
+	}
     }
 }
 
@@ -6379,7 +6379,7 @@ face_at_buffer_position (struct window *w, ptrdiff_t pos,
   {
     ptrdiff_t next_overlay;
 
-    GET_OVERLAYS_AT (pos, overlay_vec, noverlays, &next_overlay, false);
+    GET_OVERLAYS_AT (pos, overlay_vec, noverlays, &next_overlay);
     if (next_overlay < endpos)
       endpos = next_overlay;
   }
@@ -6429,7 +6429,6 @@ face_at_buffer_position (struct window *w, ptrdiff_t pos,
     {
       for (prop = Qnil, i = noverlays - 1; i >= 0 && NILP (prop); --i)
 	{
-	  Lisp_Object oend;
 	  ptrdiff_t oendpos;
 
 	  prop = Foverlay_get (overlay_vec[i], propname);
@@ -6442,8 +6441,7 @@ face_at_buffer_position (struct window *w, ptrdiff_t pos,
 	      merge_face_ref (w, f, prop, attrs, true, NULL, attr_filter);
 	    }
 
-	  oend = OVERLAY_END (overlay_vec[i]);
-	  oendpos = OVERLAY_POSITION (oend);
+	  oendpos = OVERLAY_END (overlay_vec[i]);
 	  if (oendpos < endpos)
 	    endpos = oendpos;
 	}
@@ -6452,7 +6450,6 @@ face_at_buffer_position (struct window *w, ptrdiff_t pos,
     {
       for (i = 0; i < noverlays; i++)
 	{
-	  Lisp_Object oend;
 	  ptrdiff_t oendpos;
 
 	  prop = Foverlay_get (overlay_vec[i], propname);
@@ -6460,8 +6457,7 @@ face_at_buffer_position (struct window *w, ptrdiff_t pos,
 	  if (!NILP (prop))
 	    merge_face_ref (w, f, prop, attrs, true, NULL, attr_filter);
 
-	  oend = OVERLAY_END (overlay_vec[i]);
-	  oendpos = OVERLAY_POSITION (oend);
+	  oendpos = OVERLAY_END (overlay_vec[i]);
 	  if (oendpos < endpos)
 	    endpos = oendpos;
 	}
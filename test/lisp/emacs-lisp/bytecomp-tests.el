@@ -365,7 +365,25 @@ byte-opt-testsuite-arith-data
             '(((a b)) a b (c) (d)))
     (mapcar (lambda (x) (cond ((memq '(a b) x) 1)
                               ((equal x '(c)) 2)))
-            '(((a b)) a b (c) (d))))
+            '(((a b)) a b (c) (d)))
+
+    ;; Fixnum fast paths in the interpreter.
+    (let ((a most-positive-fixnum) (b 1)) (list (+ a b) (- (- a) b 2)))
+    (let ((a most-negative-fixnum) (b -1)) (list (- a 1) (* a b) (* a 2)))
+    (let ((a (ash 1 40)) (b (ash 1 30))) (* a b))
+    (let ((a 3) (b 4)) (list (+ a b) (- a b) (* a b) (* a -1) (- b a)))
+    (let ((a 3) (b 4.0))
+      (list (+ a b) (- a b) (* a b) (< a b) (= a 3.0) (>= b a)))
+    (let ((a 3) (b 4))
+      (list (< a b) (> a b) (<= a 3) (>= a 3) (= a b) (= a 3)))
+    (let ((a (1+ most-positive-fixnum)) (b most-positive-fixnum))
+      (list (< b a) (> b a) (= a b) (= a (1+ b))))
+    (let ((v (vector 1 2 3)) (i 2)) (list (aref v 0) (aref v i)))
+    (let ((v (vector 1 2 3)) (i 3)) (aref v i))
+    (let ((v (vector 1 2 3)) (i -1)) (aref v i))
+    (let ((v "abc") (i 1)) (aref v i))
+    (let ((a 'x) (b 1)) (+ a b))
+    (let ((a 'x) (b 1)) (< a b)))
   "List of expression for test.
 Each element will be executed by interpreter and with
 bytecompiled code, and their results compared.")
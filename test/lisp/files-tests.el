@@ -1365,5 +1365,85 @@ files-colon-path
   (should (equal (parse-colon-path "/foo//bar/baz")
                  '("/foo/bar/baz/"))))
 
+(defun files-tests--insert-incrementally (file &optional coding)
+  "Insert FILE incrementally into the current buffer, and wait for it.
+Decode it with CODING if non-nil.  Return the list of the arguments
+passed to the callback, most recent first.  Stop waiting after 10
+seconds."
+  (let ((calls nil)
+        (coding-system-for-read coding)
+        (deadline (time-add nil 10)))
+    (insert-file-contents-incrementally
+     file (lambda (&rest args) (push args calls)))
+    (while (and (not (nth 2 (car calls)))
+                (time-less-p nil deadline))
+      (accept-process-output nil 0.01))
+    calls))
+
+(ert-deftest files-tests-insert-file-contents-incrementally ()
+  "Test inserting files a chunk at a time."
+  (let ((file (make-temp-file "files-tests"))
+        (text (mapconcat (lambda (i) (format "line %d été ☃\n" i))
+                         (number-sequence 1 500) ""))
+        (insert-file-contents-chunk-size 100))
+    (unwind-protect
+        (dolist (coding '(utf-8-unix utf-8-dos latin-1-unix utf-16le))
+          (let ((text (if (eq coding 'latin-1-unix)
+                          (replace-regexp-in-string "☃" "@" text)
+                        text)))
+            (let ((coding-system-for-write coding))
+              (write-region text nil file nil 'silent))
+            (with-temp-buffer
+              (insert "<>")
+              (goto-char 2)
+              (let ((calls (files-tests--insert-incrementally
+                            file (and (memq coding '(latin-1-unix utf-16le))
+                                      coding))))
+                (should (eq (nth 2 (car calls)) 'done))
+                (should-not (nth 2 (cadr calls)))
+                (should (= (caar calls)
+                           (file-attribute-size (file-attributes file))))
+                (unless (eq coding 'utf-16le)
+                  (should (> (length calls) 10)))
+                (should (= (point) 2))
+                (should (equal (buffer-string) (concat "<" text ">")))))))
+      (delete-file file))))
+
+(ert-deftest files-tests-insert-file-contents-incrementally-cancel ()
+  "Test canceling the insertion of a file a chunk at a time."
+  (let ((file (make-temp-file "files-tests"))
+        (insert-file-contents-chunk-size 10))
+    (unwind-protect
+        (progn
+          (write-region (apply #'concat (make-list 100 "aaaaaaaaa\n"))
+                        nil file nil 'silent)
+          (with-temp-buffer
+            (let ((timer (insert-file-contents-incrementally file)))
+              (should (= (buffer-size) 10))
+              (cancel-timer timer)
+              (accept-process-output nil 0.05)
+              (should (= (buffer-size) 10))))
+          (let ((calls nil))
+            (with-temp-buffer
+              (insert-file-contents-incrementally
+               file (lambda (&rest args) (push args calls))))
+            (accept-process-output nil 0.05)
+            (should (= (length calls) 1)))
+          ;; Cancel the timer from the callback.
+          (with-temp-buffer
+            (let* ((timer nil)
+                   (calls 0)
+                   (deadline (time-add nil 10)))
+              (setq timer (insert-file-contents-incrementally
+                           file (lambda (&rest _)
+                                  (when (= (setq calls (1+ calls)) 3)
+                                    (cancel-timer timer)))))
+              (while (and (< calls 3) (time-less-p nil deadline))
+                (accept-process-output nil 0.01))
+              (accept-process-output nil 0.05)
+              (should (= calls 3))
+              (should (= (buffer-size) 30)))))
+      (delete-file file))))
+
 (provide 'files-tests)
 ;;; files-tests.el ends here
@@ -38,5 +38,44 @@ isearch--test-done
   ;; Bug #21091: let `isearch-done' work without `isearch-update'.
   (isearch-done))
 
+(defun isearch-tests--lazy-highlight-matches (string regexp batch-size)
+  "Return the matches that lazy highlighting finds for STRING.
+Find them in batches of BATCH-SIZE, or one at a time if it is 0."
+  (let ((isearch-lazy-highlight-batch-size batch-size)
+        (isearch-lazy-highlight-matches nil)
+        (isearch-lazy-highlight-regexp regexp)
+        (isearch-lazy-highlight-forward t)
+        (isearch-lazy-highlight-case-fold-search t)
+        (matches nil)
+        (looping t))
+    (goto-char (point-min))
+    (while looping
+      (if (not (isearch-lazy-highlight-search string (point-max)))
+          (setq looping nil)
+        (push (cons (match-beginning 0) (match-end 0)) matches)
+        (when (= (match-beginning 0) (match-end 0))
+          (if (eobp)
+              (setq looping nil)
+            (forward-char 1)))))
+    (nreverse matches)))
+
+(ert-deftest isearch--test-lazy-highlight-batch ()
+  "Lazy highlighting finds the same matches in batches as one by one."
+  (with-temp-buffer
+    (insert "foo bar Foo baz\n"
+            (propertize "foo hidden" 'invisible t)
+            " x* foo\nfoo")
+    (dolist (search '(("foo" . nil) ("o*" . t) ("b.." . t) ("x*" . nil)
+                      ("" . nil) ("^f\\|o$" . t)))
+      (let ((matches (isearch-tests--lazy-highlight-matches
+                      (car search) (cdr search) 0)))
+        (should matches)
+        (should (equal (isearch-tests--lazy-highlight-matches
+                        (car search) (cdr search) 64)
+                       matches))
+        (should (equal (isearch-tests--lazy-highlight-matches
+                        (car search) (cdr search) 1)
+                       matches))))))
+
 (provide 'isearch-tests)
 ;;; isearch-tests.el ends here
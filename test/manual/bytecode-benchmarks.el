@@ -0,0 +1,142 @@
+;;; bytecode-benchmarks.el --- Benchmarks for the byte-code interpreter  -*- lexical-binding:t -*-
+
+;; Copyright (C) 2020 Free Software Foundation, Inc.
+
+;; Keywords:       internal
+;; Human-Keywords: internal
+
+;; This file is part of GNU Emacs.
+
+;; GNU Emacs is free software: you can redistribute it and/or modify
+;; it under the terms of the GNU General Public License as published by
+;; the Free Software Foundation, either version 3 of the License, or
+;; (at your option) any later version.
+
+;; GNU Emacs is distributed in the hope that it will be useful,
+;; but WITHOUT ANY WARRANTY; without even the implied warranty of
+;; MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;; GNU General Public License for more details.
+
+;; You should have received a copy of the GNU General Public License
+;; along with GNU Emacs.  If not, see <https://www.gnu.org/licenses/>.
+
+;;; Commentary:
+
+;; Small loops exercising the byte-code interpreter in src/bytecode.c,
+;; in the style of the elisp-benchmarks package.  Run them with
+;;
+;;   emacs -Q --batch -l test/manual/bytecode-benchmarks.el \
+;;         -f bytecode-benchmarks-run
+;;
+;; Each benchmark is byte-compiled before it is run, and the elapsed
+;; time of the best of several runs is reported, together with the
+;; time spent in garbage collection during that run.
+
+;;; Code:
+
+(require 'benchmark)
+
+(defvar bytecode-benchmarks--list nil
+  "List walked by `bytecode-benchmarks-dynamic-walk'.")
+
+(defvar bytecode-benchmarks--count 0
+  "Counter incremented by `bytecode-benchmarks-dynamic-setq'.")
+
+(defvar bytecode-benchmarks-repetitions 5
+  "Number of times each benchmark is run; the best run is reported.")
+
+(defvar bytecode-benchmarks--alist
+  (let (alist)
+    (dotimes (i 100)
+      (push (cons (intern (format "key%d" i)) i) alist))
+    alist))
+
+(defun bytecode-benchmarks--fib (n)
+  (if (< n 2)
+      n
+    (+ (bytecode-benchmarks--fib (- n 1))
+       (bytecode-benchmarks--fib (- n 2)))))
+
+(defun bytecode-benchmarks-fibn ()
+  "Recursive calls between byte-compiled functions."
+  (bytecode-benchmarks--fib 30))
+
+(defun bytecode-benchmarks-dynamic-walk ()
+  "Walk a list held in a special variable, as in dynamic-binding code."
+  (let ((l (number-sequence 1 1000))
+        (sum 0))
+    (dotimes (_ 5000)
+      (setq bytecode-benchmarks--list l)
+      (while bytecode-benchmarks--list
+        (setq sum (+ sum (car bytecode-benchmarks--list)))
+        (setq bytecode-benchmarks--list (cdr bytecode-benchmarks--list))))
+    sum))
+
+(defun bytecode-benchmarks-dynamic-setq ()
+  "Assign special variables and use the assigned value."
+  (let ((n 0))
+    (setq bytecode-benchmarks--count 0)
+    (while (< (setq bytecode-benchmarks--count
+                    (1+ bytecode-benchmarks--count))
+              5000000)
+      (setq n (setq bytecode-benchmarks--count bytecode-benchmarks--count)))
+    n))
+
+(defun bytecode-benchmarks-lexical-walk ()
+  "Walk lists held in lexical variables."
+  (let ((l (number-sequence 1 1000))
+        (sum 0))
+    (dotimes (_ 10000)
+      (let ((tail l))
+        (while tail
+          (setq sum (+ sum (car tail)))
+          (setq tail (cdr tail)))))
+    sum))
+
+(defun bytecode-benchmarks-subr-calls ()
+  "Call primitives that have no dedicated byte-code."
+  (let ((v (make-vector 100 1))
+        (s "abcdefghij")
+        (n 0))
+    (dotimes (_ 50000)
+      (dotimes (i 10)
+        (setq n (+ n (cdr (assq 'key50 bytecode-benchmarks--alist))
+                   (string-to-char (substring s i))
+                   (aref v (* i 3))))))
+    n))
+
+(defun bytecode-benchmarks-mapcar ()
+  "Call a byte-compiled closure from a primitive."
+  (let ((l (number-sequence 1 1000))
+        (k 3)
+        r)
+    (dotimes (_ 2000)
+      (setq r (mapcar (lambda (x) (* x k)) l)))
+    (length r)))
+
+(defconst bytecode-benchmarks
+  '(bytecode-benchmarks-fibn
+    bytecode-benchmarks-dynamic-walk
+    bytecode-benchmarks-dynamic-setq
+    bytecode-benchmarks-lexical-walk
+    bytecode-benchmarks-subr-calls
+    bytecode-benchmarks-mapcar)
+  "List of the benchmark functions run by `bytecode-benchmarks-run'.")
+
+(defun bytecode-benchmarks-run ()
+  "Byte-compile and run the benchmarks in `bytecode-benchmarks'.
+Report the time taken by each of them with `message'."
+  (interactive)
+  (byte-compile 'bytecode-benchmarks--fib)
+  (dolist (bench bytecode-benchmarks)
+    (byte-compile bench)
+    (garbage-collect)
+    (let ((best nil))
+      (dotimes (_ bytecode-benchmarks-repetitions)
+        (let ((result (benchmark-run (funcall bench))))
+          (when (or (null best) (< (car result) (car best)))
+            (setq best result))))
+      (message "%-36s %8.3fs (GC %6.3fs)"
+               bench (car best) (nth 2 best)))))
+
+;;; bytecode-benchmarks.el ends here
@@ -58,3 +58,66 @@ aset-nbytes-change
     (dolist (c (list 10003 ?b 128 ?c ?d (max-char) ?e))
       (aset s 0 c)
       (should (equal s (make-string 1 c))))))
+
+(ert-deftest gc-pause-statistics ()
+  (let ((done gcs-done)
+        (total (apply #'+ (append gc-pause-histogram nil))))
+    (garbage-collect)
+    (should (= gcs-done (1+ done)))
+    (should (= (length gc-pause-histogram) 16))
+    (should (= (apply #'+ (append gc-pause-histogram nil)) (1+ total)))
+    (should (floatp gc-max-pause))
+    (should (<= 0 gc-max-pause gc-elapsed))))
+
+(ert-deftest gc-deeply-nested-data ()
+  ;; Marking must not recurse on the C stack for each level of nesting.
+  (let ((v nil)
+        (c nil))
+    (dotimes (_ 1000000)
+      (setq v (vector v))
+      (setq c (cons c 1)))
+    (garbage-collect)
+    (let ((depth 0))
+      (while v
+        (setq v (aref v 0))
+        (setq depth (1+ depth)))
+      (should (= depth 1000000)))
+    (should (= (length (flatten-tree c)) 1000000))))
+
+(ert-deftest gc-lazy-cons-sweep ()
+  (let ((keep (make-list 100000 'a)))
+    ;; Make lots of garbage, then collect it and reuse it.
+    (dotimes (_ 10)
+      (make-list 100000 'b))
+    (let ((conses (assq 'conses (garbage-collect))))
+      (should (>= (nth 2 conses) 100000))
+      (should (>= (nth 3 conses) 0)))
+    (should (floatp gc-elapsed-sweep))
+    (should (<= 0 gc-elapsed-sweep gc-elapsed))
+    (let ((new (make-list 300000 'c)))
+      (garbage-collect)
+      (should (= (length keep) 100000))
+      (should (equal (delete-dups (copy-sequence keep)) '(a)))
+      (should (equal (delete-dups new) '(c))))))
+
+(ert-deftest gc-lazy-cons-sweep-free-cons ()
+  ;; `save-restriction' frees its cons explicitly.  Have a GC happen
+  ;; while newer cons blocks are half in use, so that few of them are
+  ;; swept afterwards and the block holding that cons is still marked
+  ;; from the GC when it is freed.
+  (with-temp-buffer
+    (insert "abcdef")
+    (narrow-to-region 2 5)
+    (let ((keep nil))
+      (save-restriction
+        (widen)
+        (let ((gc-cons-threshold 800000)
+              (gcs gcs-done))
+          (while (= gcs gcs-done)
+            (push (cons 1 2) keep)
+            (cons 3 4))))
+      (should (equal (buffer-string) "bcd"))
+      (let ((l (make-list 100000 'x)))
+        (garbage-collect)
+        (should (equal (delete-dups l) '(x)))
+        (should (equal (delete-dups keep) '((1 . 2))))))))
@@ -1334,4 +1334,142 @@ buffer-tests-buffer-local-variables-undo
   (with-temp-buffer
     (should (assq 'buffer-undo-list (buffer-local-variables)))))
 
+;; +==========================================================================+
+;; | Benchmark with many overlays
+;; +==========================================================================+
+
+(defun buffer-tests--overlay-benchmark (n)
+  "Create N overlays in the current buffer and exercise them.
+Return an alist of (OPERATION . (ELAPSED GC-COUNT GC-ELAPSED))."
+  (let ((size (* 10 n))
+        (results nil))
+    (insert (make-string size ?x))
+    (push (cons 'make-overlay
+                (benchmark-run 1
+                  (dotimes (i n)
+                    (let ((beg (1+ (* 10 i))))
+                      (make-overlay beg (+ beg 5 (% i 20)))))))
+          results)
+    (push (cons 'overlays-at
+                (benchmark-run 1
+                  (dotimes (i 10000)
+                    (overlays-at (1+ (* i (/ size 10000)))))))
+          results)
+    (push (cons 'overlays-in
+                (benchmark-run 1
+                  (dotimes (i 10000)
+                    (let ((beg (1+ (* i (/ size 10000)))))
+                      (overlays-in beg (+ beg 100))))))
+          results)
+    (push (cons 'next-overlay-change
+                (benchmark-run 1
+                  (let ((pos (point-min)))
+                    (while (< pos (point-max))
+                      (setq pos (next-overlay-change pos))))))
+          results)
+    (push (cons 'insert-and-delete
+                (benchmark-run 1
+                  (dotimes (i 1000)
+                    (goto-char (1+ (* i (/ size 1000))))
+                    (insert "abc")
+                    (delete-char -3))))
+          results)
+    (nreverse results)))
+
+(defun buffer-tests--overlay< (a b)
+  "Return non-nil if overlay A sorts before overlay B by position."
+  (or (< (overlay-start a) (overlay-start b))
+      (and (= (overlay-start a) (overlay-start b))
+           (< (overlay-end a) (overlay-end b)))))
+
+(ert-deftest buffer-tests-overlay-benchmark-100k ()
+  "Check that overlay operations stay fast with 100k overlays."
+  :tags '(:expensive-test)
+  (with-temp-buffer
+    (let ((results (buffer-tests--overlay-benchmark 100000)))
+      (should (= (length (overlays-in (point-min) (point-max))) 100000))
+      ;; Compare the queries with a naive scan of all the overlays.
+      (let* ((pos 500001)
+             (all (overlays-in (point-min) (point-max)))
+             (at (seq-filter (lambda (ov)
+                               (and (<= (overlay-start ov) pos)
+                                    (< pos (overlay-end ov))))
+                             all))
+             (bounds (mapcan (lambda (ov)
+                               (list (overlay-start ov) (overlay-end ov)))
+                             all)))
+        (should (equal (sort (overlays-at pos) #'buffer-tests--overlay<)
+                       (sort at #'buffer-tests--overlay<)))
+        (should (= (next-overlay-change pos)
+                   (apply #'min (point-max)
+                          (seq-filter (lambda (p) (> p pos)) bounds))))
+        (should (= (previous-overlay-change pos)
+                   (apply #'max (point-min)
+                          (seq-filter (lambda (p) (< p pos)) bounds)))))
+      (dolist (result results)
+        (message "%s: %.3fs" (car result) (cadr result))
+        ;; With linear overlay lists, each of these used to take well
+        ;; over a minute.
+        (should (< (cadr result) 30))))))
+
+(ert-deftest buffer-tests-overlay-many-at-pos ()
+  "Check property lookups at a position with more than 40 overlays."
+  (with-temp-buffer
+    (insert (make-string 100 ?x))
+    ;; Overlays of equal priority are ordered by address, so give
+    ;; each one its own priority to know which of them wins.
+    (dotimes (i 45)
+      (let ((ov (make-overlay 10 20)))
+        (overlay-put ov 'priority i)
+        (overlay-put ov 'buffer-tests-prop i)))
+    (should (= (length (overlays-at 12)) 45))
+    (should (eq (get-char-property 12 'buffer-tests-prop) 44))
+    (should-not (get-char-property 12 'field))
+    (should (= (field-end 12) (point-max)))))
+
+;; Insertions at the end of a large buffer whose gap is far away
+;; store the text after the end instead of moving the gap.
+
+(ert-deftest buffer-tests-insert-at-end-away-from-gap ()
+  "Text inserted at the end of a buffer while the gap is elsewhere."
+  (with-temp-buffer
+    (insert (make-string 200000 ?a))
+    (goto-char (point-min))
+    (insert "é")
+    (let ((gap (gap-position))
+          (marker (copy-marker (point-max) t))
+          (other (generate-new-buffer " *buffer-tests*")))
+      (unwind-protect
+          (progn
+            (with-current-buffer other (insert "from other"))
+            (dotimes (i 1000)
+              (goto-char (point-max))
+              (pcase (% i 3)
+                (0 (insert "line é" ?\n))
+                (1 (insert (propertize "prop" 'face 'bold) ?\n))
+                (_ (insert-buffer-substring other))))
+            (should (= (gap-position) gap))
+            (should (= marker (point-max)))
+            (should (equal (buffer-substring (- (point-max) 7) (point-max))
+                           "line é\n"))
+            (should (eq (get-text-property (- (point-max) 20) 'face)
+                        'bold))
+            (should (= (position-bytes (point-max))
+                       (+ 1 (string-bytes (buffer-string)))))
+            (should (= (how-many "é" (point-min) (point-max)) 335))
+            (should (search-backward "from other" nil t))
+            ;; Grow the gap, which takes over the room after the end,
+            ;; and then shrink it.
+            (goto-char 100)
+            (insert (make-string 100000 ?b))
+            (delete-region 100 100100)
+            (garbage-collect)
+            (goto-char (point-max))
+            (insert "end")
+            (should (equal (buffer-substring 1 4) "éaa"))
+            (should (equal (buffer-substring (- (point-max) 10) (point-max))
+                           "line é\nend"))
+            (should (= (length (buffer-string)) (1- (point-max)))))
+        (kill-buffer other)))))
+
 ;;; buffer-tests.el ends here
@@ -41,4 +41,33 @@ forward-line-with-bignum
       (should (= shortage (1+ most-positive-fixnum))))))
 
 (provide 'cmds-tests)
+(ert-deftest forward-line-long-counts ()
+  "Check `forward-line' over text spanning several blocks."
+  (with-temp-buffer
+    (random "cmds-tests")
+    (dotimes (_ 20000)
+      (insert (make-string (random 6) ?x)
+              (if (zerop (random 10)) "\u00e9" "")
+              "\n"))
+    ;; Put the gap in the middle of the text.
+    (goto-char (/ (point-max) 2))
+    (insert "y")
+    (let ((lines (count-matches "\n" (point-min) (point-max))))
+      (should (= (count-lines (point-min) (point-max)) lines))
+      (dolist (cache '(t nil))
+        (setq cache-long-scans cache)
+        (dolist (n '(1 100 16385 19999 20000))
+          (goto-char (point-min))
+          (should (= (forward-line n) 0))
+          (should (= (point) (progn (goto-char (point-min))
+                                    (re-search-forward "\n" nil t n)
+                                    (point))))
+          (goto-char (point-max))
+          (should (= (forward-line (- n)) 0))
+          (should (= (count-lines (point) (point-max)) n)))
+        (goto-char (point-min))
+        (should (= (forward-line (* 2 lines)) lines))
+        (goto-char (point-max))
+        (should (= (forward-line (- (* 2 lines))) (- lines)))))))
+
 ;;; cmds-tests.el ends here
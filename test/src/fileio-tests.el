@@ -189,3 +189,87 @@ fileio-tests--circular-after-insert-file-functions
     (write-region "hello\n" nil f nil 'silent)
     (should-error (insert-file-contents f) :type 'circular-list)
     (delete-file f)))
+
+(ert-deftest fileio-tests--insert-file-mapped ()
+  "Test inserting files mapped into memory."
+  (let ((f (make-temp-file "fileio"))
+        (text (mapconcat (lambda (i) (format "line %d été\n" i))
+                         (number-sequence 1 5000) "")))
+    (unwind-protect
+        (dolist (coding '(utf-8-unix utf-8-dos latin-1-unix))
+          (let ((coding-system-for-write coding)
+                (large-file-mapping-threshold 0))
+            (write-region text nil f nil 'silent)
+            (with-temp-buffer
+              (let ((coding-system-for-read coding))
+                (insert-file-contents f))
+              (should (equal (buffer-string) text))
+              (goto-char 100)
+              (insert "inserted")
+              (goto-char (point-max))
+              (insert "appended")
+              (should (equal (buffer-string)
+                             (concat (substring text 0 99) "inserted"
+                                     (substring text 99) "appended"))))
+            (with-temp-buffer
+              (set-buffer-multibyte nil)
+              (insert-file-contents-literally f)
+              (should (equal (buffer-string)
+                             (encode-coding-string text coding))))
+            (with-temp-buffer
+              (catch 'interrupted
+                (let ((set-auto-coding-function
+                       (lambda (&rest _) (throw 'interrupted nil))))
+                  (insert-file-contents f)))
+              (insert "after")
+              (should (equal (buffer-string) "after")))))
+      (delete-file f))))
+
+(ert-deftest fileio-tests--insert-file-mapped-truncated ()
+  "Test truncating a file mapped into a buffer."
+  (skip-unless (eq system-type 'gnu/linux))
+  (let ((f (make-temp-file "fileio"))
+        (large-file-mapping-threshold 0))
+    (unwind-protect
+        (with-temp-buffer
+          (write-region (make-string 100000 ?a) nil f nil 'silent)
+          (set-buffer-multibyte nil)
+          (insert-file-contents-literally f)
+          (write-region "b" nil f nil 'silent)
+          ;; The error is signaled at the next check for quits.
+          (should-error (progn (buffer-substring (point-min) (point-max))
+                               (eval '(ignore) t)))
+          (should (equal (buffer-substring 1 3) "b\0"))
+          (should (equal (buffer-substring (- (point-max) 2) (point-max))
+                         "\0\0"))
+          (should (= (buffer-size) 100000)))
+      (delete-file f))))
+
+(ert-deftest fileio-tests--insert-file-mapped-modified ()
+  "Test modifying a file mapped into a buffer."
+  (skip-unless (eq system-type 'gnu/linux))
+  (let ((f (make-temp-file "fileio"))
+        (large-file-mapping-threshold 0))
+    (unwind-protect
+        (progn
+          ;; Decoded text is copied, so it does not change.
+          (with-temp-buffer
+            (write-region (make-string 100000 ?é) nil f nil 'silent)
+            (let ((coding-system-for-read 'utf-8-unix))
+              (insert-file-contents f))
+            (write-region (make-string 200000 ?a) nil f nil 'silent)
+            (should (equal (buffer-string) (make-string 100000 ?é))))
+          (with-temp-buffer
+            (write-region (make-string 100000 ?a) nil f nil 'silent)
+            (set-buffer-multibyte nil)
+            (insert-file-contents-literally f)
+            (should (= (count-lines (point-min) (point-max)) 1))
+            (write-region (make-string 100000 ?\n) nil f nil 'silent)
+            ;; The change is noticed before the next command.
+            (should-error (save-current-buffer (execute-kbd-macro "")))
+            (should (= (count-lines (point-min) (point-max)) 100000))
+            ;; The text no longer follows the file.
+            (write-region (make-string 100000 ?b) nil f nil 'silent)
+            (save-current-buffer (execute-kbd-macro ""))
+            (should (equal (buffer-substring 1 3) "\n\n"))))
+      (delete-file f))))
@@ -0,0 +1,109 @@
+;;; line-index-tests.el --- tests for line-index.c  -*- lexical-binding: t -*-
+
+;; Copyright (C) 2020 Free Software Foundation, Inc.
+
+;; This file is part of GNU Emacs.
+
+;; GNU Emacs is free software: you can redistribute it and/or modify
+;; it under the terms of the GNU General Public License as published by
+;; the Free Software Foundation, either version 3 of the License, or
+;; (at your option) any later version.
+
+;; GNU Emacs is distributed in the hope that it will be useful,
+;; but WITHOUT ANY WARRANTY; without even the implied warranty of
+;; MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;; GNU General Public License for more details.
+
+;; You should have received a copy of the GNU General Public License
+;; along with GNU Emacs.  If not, see <https://www.gnu.org/licenses/>.
+
+;;; Code:
+
+(require 'ert)
+
+(ert-deftest buffer-line-count-small ()
+  (with-temp-buffer
+    (should (= (buffer-line-count) 0))
+    (insert "a")
+    (should (= (buffer-line-count) 1))
+    (insert "\n")
+    (should (= (buffer-line-count) 1))
+    (insert "b\nc")
+    (should (= (buffer-line-count) 3))
+    (narrow-to-region 1 2)
+    (should (= (buffer-line-count) 3))
+    (let ((buffer (current-buffer)))
+      (with-temp-buffer
+        (should (= (buffer-line-count) 0))
+        (should (= (buffer-line-count buffer) 3))))))
+
+(defun line-index-tests--check ()
+  "Check the line index of the current buffer against a plain scan."
+  (let ((lines (save-restriction
+                 (widen)
+                 (let ((cache-long-scans nil))
+                   (count-lines (point-min) (point-max)))))
+        (pos (1+ (random (max 1 (buffer-size))))))
+    (should (= (buffer-line-count) lines))
+    (should (= (line-number-at-pos pos)
+               (let ((cache-long-scans nil))
+                 (line-number-at-pos pos))))
+    (dolist (n (list 300 -300 (/ lines 2) (- (/ lines 2)) (* 2 lines)))
+      (goto-char pos)
+      (let ((shortage (forward-line n))
+            (indexed (point)))
+        (goto-char pos)
+        (let ((cache-long-scans nil))
+          (should (= (forward-line n) shortage)))
+        (should (= indexed (point)))))))
+
+(ert-deftest buffer-line-count-edits ()
+  "Check that the line index follows changes to the text."
+  (random "line-index-tests")
+  (with-temp-buffer
+    (dotimes (i 20000)
+      (insert (make-string (random 8) (if (zerop (% i 7)) ?é ?x)) "\n"))
+    (line-index-tests--check)
+    (dotimes (_ 200)
+      (let ((pos (1+ (random (max 1 (buffer-size))))))
+        (goto-char pos)
+        (pcase (random 4)
+          (0 (insert (make-string (random 100) ?\n)))
+          (1 (delete-region pos (min (point-max) (+ pos (random 40000)))))
+          (2 (subst-char-in-region pos (min (point-max) (+ pos 1000)) ?\n ?y))
+          (3 (insert (make-string (random 70000) ?z) "\nα\n"))))
+      (line-index-tests--check))
+    ;; Changes that convert or swap the whole text.
+    (set-buffer-multibyte nil)
+    (line-index-tests--check)
+    (set-buffer-multibyte t)
+    (line-index-tests--check)
+    (let ((other (generate-new-buffer " *line-index-tests*")))
+      (unwind-protect
+          (progn
+            (with-current-buffer other
+              (insert (make-string 100000 ?\n)))
+            (buffer-swap-text other)
+            (line-index-tests--check)
+            (with-current-buffer other
+              (line-index-tests--check)))
+        (kill-buffer other)))))
+
+(ert-deftest buffer-line-count-indirect ()
+  "Check that edits in an indirect buffer update the line index."
+  (with-temp-buffer
+    (insert (make-string 100000 ?\n))
+    (line-index-tests--check)
+    (let ((indirect (make-indirect-buffer (current-buffer)
+                                          " *line-index-tests*")))
+      (unwind-protect
+          (progn
+            (with-current-buffer indirect
+              (goto-char 5000)
+              (insert "abc\n\n")
+              (delete-region 50000 60000)
+              (line-index-tests--check))
+            (line-index-tests--check))
+        (kill-buffer indirect)))))
+
+;;; line-index-tests.el ends here
@@ -57,4 +57,172 @@ marker-goto-char-from-other-buffer
     (set-marker marker-2 marker-1)
     (should (goto-char marker-2))))
 
+;; The markers of a buffer are kept in a tree sorted by position,
+;; whose subtrees can have pending offsets.  The following tests check
+;; the markers against a simple model of where they should be.
+
+(defun marker-tests--check (markers)
+  "Check that MARKERS are at the positions they are paired with."
+  (dolist (elt markers)
+    (should (= (marker-position (car elt)) (cdr elt)))
+    (should (buffer-has-markers-at (cdr elt)))
+    (should (= (position-bytes (car elt))
+               (+ (string-bytes (buffer-substring (point-min) (car elt)))
+                  (point-min))))))
+
+(defun marker-tests--insert (markers pos text before-markers)
+  "Insert TEXT at POS, and update the positions in MARKERS to match."
+  (goto-char pos)
+  (if before-markers (insert-before-markers text) (insert text))
+  (dolist (elt markers)
+    (when (or (> (cdr elt) pos)
+              (and (= (cdr elt) pos)
+                   (or before-markers (marker-insertion-type (car elt)))))
+      (setcdr elt (+ (cdr elt) (length text))))))
+
+(defun marker-tests--delete (markers from to)
+  "Delete the text between FROM and TO, and update MARKERS to match."
+  (delete-region from to)
+  (dolist (elt markers)
+    (cond ((> (cdr elt) to) (setcdr elt (- (cdr elt) (- to from))))
+          ((> (cdr elt) from) (setcdr elt from)))))
+
+(ert-deftest marker-tree-random-edits ()
+  "Markers follow random insertions and deletions."
+  (random "marker-tree")
+  (with-temp-buffer
+    (dotimes (i 200)
+      (insert (if (zerop (% i 3)) "été " "ab ")))
+    (let ((markers nil))
+      (dotimes (_ 300)
+        (let* ((pos (1+ (random (buffer-size))))
+               (m (copy-marker pos (zerop (random 2)))))
+          (push (cons m pos) markers)))
+      (marker-tests--check markers)
+      (dotimes (i 400)
+        (let ((a (1+ (random (1+ (buffer-size)))))
+              (b (1+ (random (1+ (buffer-size))))))
+          (pcase (random 3)
+            (0 (marker-tests--insert markers a "xüy" nil))
+            (1 (marker-tests--insert markers a "à" t))
+            (_ (marker-tests--delete markers (min a b)
+                                     (min (max a b) (+ (min a b) 7))))))
+        (when (zerop (% i 20))
+          (dolist (elt markers)
+            (when (zerop (random 5))
+              (let ((pos (1+ (random (1+ (buffer-size))))))
+                (set-marker (car elt) pos)
+                (setcdr elt pos))))
+          (marker-tests--check markers)))
+      (marker-tests--check markers))))
+
+(ert-deftest marker-tree-garbage-collection ()
+  "Markers survive the collection of other markers in their buffer."
+  (with-temp-buffer
+    (insert (make-string 1000 ?é))
+    (let ((markers nil))
+      (dotimes (i 1000)
+        (let ((m (copy-marker (+ i 2))))
+          (when (zerop (% i 10))
+            (push (cons m (+ i 2)) markers))))
+      (garbage-collect)
+      (goto-char (point-min))
+      (insert "abc")
+      (dolist (elt markers)
+        (setcdr elt (+ (cdr elt) 3)))
+      (marker-tests--check markers))))
+
+(ert-deftest marker-tree-indirect-buffer ()
+  "Killing an indirect buffer unchains only its own markers."
+  (with-temp-buffer
+    (insert "hello world")
+    (let* ((base-marker (copy-marker 7))
+           (indirect (make-indirect-buffer (current-buffer) " *marker-tests*"))
+           (indirect-marker (with-current-buffer indirect (copy-marker 3))))
+      (kill-buffer indirect)
+      (should-not (marker-buffer indirect-marker))
+      (should (eq (marker-buffer base-marker) (current-buffer)))
+      (goto-char (point-min))
+      (insert "well, ")
+      (should (= base-marker 13)))))
+
+(ert-deftest marker-tree-transpose-regions ()
+  "Markers move with the regions that `transpose-regions' swaps."
+  (with-temp-buffer
+    (insert "abc-éééé-fg")
+    (let ((m1 (copy-marker 2))
+          (m2 (copy-marker 6))
+          (m3 (copy-marker 10)))
+      (transpose-regions 1 4 5 9)
+      (should (equal (buffer-string) "éééé-abc-fg"))
+      (should (= m1 7))
+      (should (= m2 2))
+      (should (= m3 10))
+      (dolist (m (list m1 m2 m3))
+        (should (= (position-bytes m)
+                   (+ 1 (string-bytes (buffer-substring 1 m)))))))))
+
+(ert-deftest marker-tree-stress ()
+  "Editing a buffer with many markers does not take quadratic time."
+  (with-temp-buffer
+    (insert (make-string 20000 ?é))
+    (let ((markers (make-vector 20000 nil)))
+      (dotimes (i 20000)
+        (aset markers i (copy-marker (1+ i))))
+      (goto-char (point-min))
+      (dotimes (_ 20000)
+        (insert "a"))
+      (dotimes (_ 20000)
+        (delete-char -1))
+      (dotimes (_ 20000)
+        (let ((pos (1+ (random (buffer-size)))))
+          (goto-char pos)
+          (insert "b")
+          (delete-region pos (1+ pos))
+          (setq pos (1+ (random (buffer-size))))
+          (should (= (position-bytes pos) (1- (* 2 pos))))))
+      (dotimes (i 20000)
+        (should (= (aref markers i) (1+ i)))
+        (should (= (position-bytes (aref markers i)) (1+ (* 2 i))))))))
+
+;;; The index of character positions.
+
+(defun marker-tests--check-positions ()
+  "Check the conversions between character and byte positions."
+  (let ((text (buffer-string)))
+    (goto-char (point-min))
+    (dotimes (_ 20)
+      (let* ((pos (1+ (random (1+ (buffer-size)))))
+             (byte (1+ (string-bytes (substring text 0 (1- pos))))))
+        (should (= (position-bytes pos) byte))
+        (should (= (byte-to-position byte) pos))))))
+
+(ert-deftest marker-char-index-random-edits ()
+  "Positions are converted right in large buffers being edited."
+  (random "char-index")
+  (with-temp-buffer
+    (dotimes (i 2000)
+      (insert (make-string 40 (if (zerop (% i 300)) ?é ?a)) "\n"))
+    (marker-tests--check-positions)
+    (dotimes (i 200)
+      (let ((a (1+ (random (1+ (buffer-size)))))
+            (b (1+ (random (1+ (buffer-size))))))
+        (pcase (random 4)
+          (0 (goto-char a)
+             (insert (make-string (random 100) ?ü)))
+          (1 (goto-char a)
+             (insert (make-string (random 30000) ?x)))
+          (2 (delete-region (min a b) (min (max a b) (+ (min a b) 10000))))
+          (_ (let ((ends (sort (list a b
+                                     (1+ (random (1+ (buffer-size))))
+                                     (1+ (random (1+ (buffer-size)))))
+                               #'<)))
+               (apply #'transpose-regions
+                      (append ends (list (zerop (random 2)))))))))
+      (when (zerop (% i 10))
+        (marker-tests--check-positions)))
+    (set-buffer-multibyte nil)
+    (set-buffer-multibyte t)
+    (marker-tests--check-positions)))
+
 ;;; marker-tests.el ends here.
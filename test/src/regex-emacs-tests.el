@@ -803,4 +803,194 @@ regexp-multibyte-unibyte
   (should-not (string-match "å" "\xe5"))
   (should-not (string-match "[å]" "\xe5")))
 
+;; Random regexps, matched with and without the DFA.
+
+(defconst regex-tests--dfa-atoms
+  '("a" "b" "ab" "é" "α" "\n" " " "." "[ab]" "[^a\n]" "[[:alpha:]]"
+    "[[:space:]]" "[[:punct:]]" "[é-ω]" "\\w" "\\W" "\\s-" "\\s_" "\\_<"
+    "\\_>" "\\<" "\\>" "\\b" "\\B" "^" "$" "\\`" "\\'" "")
+  "Pieces that `regex-tests--random-regexp' builds regexps from.")
+
+(defun regex-tests--random-regexp (depth &optional flat)
+  "Return a random regexp of nesting depth at most DEPTH.
+If FLAT is non-nil, don't use repetition operators, so that
+the regexp can be repeated without making the matcher backtrack
+exponentially."
+  (let ((pieces nil))
+    (dotimes (_ (1+ (random 4)))
+      (let* ((repeat (and (not flat) (zerop (random 3))))
+             (piece
+              (if (and (> depth 0) (zerop (random 4)))
+                  (concat (if (zerop (random 2)) "\\(" "\\(?:")
+                          (regex-tests--random-regexp (1- depth)
+                                                      (or flat repeat))
+                          (if (zerop (random 2))
+                              (concat "\\|"
+                                      (regex-tests--random-regexp
+                                       (1- depth) (or flat repeat)))
+                            "")
+                          "\\)")
+                (nth (random (length regex-tests--dfa-atoms))
+                     regex-tests--dfa-atoms))))
+        (when (and repeat
+                   (> (length piece) 0)
+                   (not (member piece '("^" "$" "\\`" "\\'"))))
+          (setq piece (concat (if (> (length piece) 1)
+                                  (concat "\\(?:" piece "\\)")
+                                piece)
+                              (nth (random 5) '("*" "+" "?" "*?" "+?")))))
+        (push piece pieces)))
+    (apply #'concat pieces)))
+
+(defun regex-tests--random-text (length)
+  "Return a random string of LENGTH characters."
+  (let ((chars "aaabbé α_-.\n"))
+    (apply #'string (mapcar (lambda (_) (aref chars (random (length chars))))
+                            (make-list length nil)))))
+
+(defun regex-tests--search-results (regexp pos)
+  "Return the results of a few searches for REGEXP in the current buffer.
+Search from the beginning of the buffer and from POS."
+  (set-match-data nil)
+  (let ((results nil))
+    (dolist (from (list (point-min) pos))
+      (goto-char from)
+      (push (list (re-search-forward regexp nil t) (match-data t)) results)
+      (goto-char from)
+      (push (list (re-search-forward regexp (min (point-max) (+ from 40)) t)
+                  (match-data t))
+            results)
+      (goto-char (point-max))
+      (push (list (re-search-backward regexp from t) (match-data t))
+            results)
+      (goto-char from)
+      (push (list (posix-search-forward regexp nil t) (match-data t))
+            results))
+    (let ((string (buffer-string)))
+      (push (list (string-match regexp string) (match-data t)) results)
+      (push (list (string-match regexp string 5) (match-data t)) results))
+    results))
+
+(ert-deftest regexp-dfa-random ()
+  "Check that searching with the DFA finds the same matches as without."
+  (random "regexp-dfa-random")
+  (with-temp-buffer
+    (set-syntax-table (make-syntax-table))
+    (dotimes (_ 1500)
+      (let ((regexp (regex-tests--random-regexp 2))
+            (case-fold-search (zerop (random 2))))
+        (erase-buffer)
+        (set-buffer-multibyte t)
+        (insert (regex-tests--random-text (+ 40 (random 200))))
+        (when (zerop (random 5))
+          (set-buffer-multibyte nil))
+        (when (zerop (random 5))
+          (modify-syntax-entry ?_ (if (zerop (random 2)) "w" "_")))
+        (let ((pos (1+ (random (buffer-size)))))
+          (should (equal (cons regexp (regex-tests--search-results regexp pos))
+                         (cons regexp
+                               (let ((regexp-use-dfa nil))
+                                 (regex-tests--search-results
+                                  regexp pos))))))))))
+
+(ert-deftest regexp-exactn-end-of-string ()
+  "Check that a string that fails to match at the end isn't consumed."
+  (should (= (string-match ".\\(?:ab\\)*\\'" "xa") 1))
+  (should (equal (match-data) '(1 2))))
+
+(ert-deftest regexp-dfa-long-line ()
+  "Check that the DFA finds there is no match in a long line quickly."
+  (with-temp-buffer
+    (insert (make-string 200000 ?a) "\n")
+    (goto-char (point-min))
+    (should-not (re-search-forward "\\(?:a\\|ab\\)*c" nil t))
+    (goto-char (point-min))
+    (should (re-search-forward "a+\n" nil t))
+    (should (= (match-beginning 0) 1))))
+
+(ert-deftest regexp-literal-prefix-random ()
+  "Check searches that look for the bytes that the matches start with.
+They are only used without case folding, so compare with searches
+that fold case in text where that changes nothing."
+  (random "regexp-literal-prefix-random")
+  (with-temp-buffer
+    (dotimes (_ 1500)
+      (let ((regexp (regex-tests--random-regexp 2)))
+        (erase-buffer)
+        (set-buffer-multibyte t)
+        (insert (regex-tests--random-text (+ 40 (random 200))))
+        (when (zerop (random 5))
+          (set-buffer-multibyte nil))
+        ;; Move the gap, so that the text is split in two strings.
+        (goto-char (1+ (random (buffer-size))))
+        (insert "a")
+        (delete-char -1)
+        (let ((pos (1+ (random (buffer-size)))))
+          (should (equal (cons regexp
+                               (let ((case-fold-search nil))
+                                 (regex-tests--search-results regexp pos)))
+                         (cons regexp
+                               (let ((case-fold-search t))
+                                 (regex-tests--search-results
+                                  regexp pos))))))))))
+
+(ert-deftest regexp-literal-prefix ()
+  "Check searches for literal strings around the gap."
+  (with-temp-buffer
+    (insert "xxabcxxabc" (make-string 100 ?x) "abé")
+    (let ((case-fold-search nil))
+      (dotimes (i (buffer-size))
+        (goto-char (1+ i))
+        (insert "a")
+        (delete-char -1)
+        (goto-char (point-min))
+        (should (equal (list (re-search-forward "abc" nil t)
+                             (re-search-forward "\\(ab\\)c" nil t)
+                             (re-search-forward "abc" nil t)
+                             (re-search-forward "abé\\|xyz" nil t)
+                             (re-search-forward "b" nil t))
+                       '(6 11 nil 114 nil)))
+        (goto-char (point-min))
+        (should (= (re-search-forward "é" nil t) 114))
+        (goto-char 3)
+        (should-not (re-search-forward "abc" 5 t))
+        (should (= (re-search-forward "abc" 6 t) 6))))))
+
+(ert-deftest regexp-memoize-backtracking-random ()
+  "Check that memoizing backtracking finds the same matches as without."
+  (random "regexp-memoize-backtracking-random")
+  (with-temp-buffer
+    (dotimes (_ 1500)
+      (let ((regexp (regex-tests--random-regexp 2))
+            (case-fold-search (zerop (random 2))))
+        ;; Refer back to a group, if there is one.
+        (when (and (string-match-p "\\\\([^?]" regexp) (zerop (random 2)))
+          (setq regexp (concat regexp (nth (random 3) '("\\1" "a\\1" "\\1*")))))
+        (erase-buffer)
+        (set-buffer-multibyte t)
+        (insert (regex-tests--random-text (+ 40 (random 200))))
+        (when (zerop (random 5))
+          (set-buffer-multibyte nil))
+        (let ((pos (1+ (random (buffer-size)))))
+          (should (equal (cons regexp
+                               (let ((regexp-memoize-backtracking t))
+                                 (regex-tests--search-results regexp pos)))
+                         (cons regexp
+                               (regex-tests--search-results regexp pos)))))))))
+
+(ert-deftest regexp-memoize-backtracking ()
+  "Check that memoizing backtracking avoids exponential matching."
+  (let ((regexp-memoize-backtracking t)
+        (regexp-use-dfa nil))
+    (with-temp-buffer
+      (insert (make-string 40 ?a))
+      (dolist (regexp '("\\(a*\\)*b" "\\(a\\|aa\\)*\\1b" "\\(a*\\)*?\\1b"))
+        (goto-char (point-min))
+        (should-not (re-search-forward regexp nil t)))
+      (goto-char (point-max))
+      (insert "b")
+      (goto-char (point-min))
+      (should (re-search-forward "\\(a\\|aa\\)*\\1b" nil t))
+      (should (equal (list (match-beginning 0) (match-beginning 1)) '(1 39))))))
+
 ;;; regex-emacs-tests.el ends here
@@ -0,0 +1,423 @@
+;;; search-tests.el --- tests for search.c -*- lexical-binding: t -*-
+
+;; Copyright (C) 2020 Free Software Foundation, Inc.
+
+;; This file is part of GNU Emacs.
+
+;; GNU Emacs is free software: you can redistribute it and/or modify
+;; it under the terms of the GNU General Public License as published by
+;; the Free Software Foundation, either version 3 of the License, or
+;; (at your option) any later version.
+
+;; GNU Emacs is distributed in the hope that it will be useful,
+;; but WITHOUT ANY WARRANTY; without even the implied warranty of
+;; MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;; GNU General Public License for more details.
+
+;; You should have received a copy of the GNU General Public License
+;; along with GNU Emacs.  If not, see <https://www.gnu.org/licenses/>.
+
+;;; Code:
+
+(require 'ert)
+
+(defun search-tests--which ()
+  "Return the index of the string found by `search-forward-any'."
+  (- (/ (length (match-data t)) 2) 2))
+
+(ert-deftest search-forward-any-basic ()
+  (with-temp-buffer
+    (insert "The quick brown fox jumps over the lazy dog")
+    (goto-char (point-min))
+    ;; The first occurrence wins, then the longest one.
+    (should (= (search-forward-any '("fox" "ox" "quick" "qu")) 10))
+    (should (= (search-tests--which) 2))
+    (should (equal (match-string 3) "quick"))
+    (should-not (match-beginning 1))
+    (should (= (search-forward-any ["ox" "jump" "jumps" "fox"]) 20))
+    (should (= (search-tests--which) 3))
+    (should (= (match-beginning 0) 17))
+    ;; Bounds and COUNT.
+    (goto-char (point-min))
+    (should (= (search-forward-any '("o") nil nil 3) 28))
+    (should-not (search-forward-any '("dog") 43 t))
+    (should (= (point) 28))
+    (should-not (search-forward-any '("dog") 43 'move))
+    (should (= (point) 43))
+    (should-error (search-forward-any '("cat")) :type 'search-failed)
+    (should-error (search-forward-any '("cat") 1) :type 'error)
+    (should-error (search-forward-any '(cat)) :type 'wrong-type-argument)
+    (goto-char (point-min))
+    (should-not (search-forward-any nil nil t))
+    ;; The empty string is found where nothing longer is.
+    (should (= (search-forward-any '("" "Th")) 3))
+    (should (= (search-forward-any '("" "e")) 4))
+    (should (= (search-forward-any '("" "e")) 4))
+    (should (= (search-tests--which) 0))))
+
+(ert-deftest search-forward-any-case-fold ()
+  (with-temp-buffer
+    (insert "Éclair, ÉCLAIR, and LAZY dog")
+    (goto-char (point-min))
+    (let ((case-fold-search nil))
+      (should (= (search-forward-any '("éclair" "lazy" "ÉCLAIR")) 15))
+      (should (= (search-tests--which) 2)))
+    (goto-char (point-min))
+    (let ((case-fold-search t))
+      (should (= (search-forward-any '("éclair" "lazy" "ÉCLAIR")) 7))
+      (should (= (search-tests--which) 0))
+      (should (= (search-forward-any '("lazy" "dog") nil nil 2) 29)))))
+
+(ert-deftest search-forward-any-unibyte ()
+  (with-temp-buffer
+    (set-buffer-multibyte nil)
+    (insert "ab\351cd\377")
+    (goto-char (point-min))
+    (should (= (search-forward-any (list "\351c" (string-to-multibyte "\377")))
+               5))
+    (should (= (search-forward-any (list (string-to-multibyte "\377")))
+               7)))
+  (with-temp-buffer
+    (insert "ab" (string-to-multibyte "\351") "c")
+    (goto-char (point-min))
+    (should (= (search-forward-any '("\351c")) 5))))
+
+(ert-deftest search-forward-any-cache ()
+  "Changing a string after a search doesn't affect the next one."
+  (let ((strings (list (copy-sequence "foo") "bar")))
+    (with-temp-buffer
+      (insert "bar foo baz")
+      (goto-char (point-min))
+      (should (= (search-forward-any strings) 4))
+      (aset (car strings) 2 ?z)
+      (goto-char (point-min))
+      (should (= (search-forward-any strings) 4))
+      (should-not (search-forward-any strings nil t))
+      (setcar strings "baz")
+      (should (= (search-forward-any strings) 12))
+      (should (= (search-tests--which) 0)))))
+
+(ert-deftest search-forward-any-random ()
+  "Compare `search-forward-any' with `posix-search-forward'."
+  (random "search-forward-any")
+  (with-temp-buffer
+    (dotimes (_ 200)
+      (let* ((letters "abcAB")
+             (word (lambda (max)
+                     (let ((s (make-string (random max) ?a)))
+                       (dotimes (i (length s))
+                         (aset s i (aref letters (random (length letters)))))
+                       s)))
+             (strings (let (l)
+                        (dotimes (_ (1+ (random 6)))
+                          (push (funcall word 5) l))
+                        l))
+             (regexp (mapconcat (lambda (s) (concat "\\(" (regexp-quote s)
+                                                    "\\)"))
+                                strings "\\|"))
+             (case-fold-search (zerop (random 2))))
+        (erase-buffer)
+        (insert (funcall word 60))
+        (let ((from (1+ (random (point-max)))))
+          (goto-char from)
+          (let* ((expected (and (posix-search-forward regexp nil t)
+                                (list (match-beginning 0) (match-end 0))))
+                 (found (progn
+                          (goto-char from)
+                          (search-forward-any strings nil t))))
+            (should (equal (and found (list (match-beginning 0) found))
+                           expected))
+            (when found
+              (should (eq t (compare-strings
+                             (nth (search-tests--which) strings) nil nil
+                             (match-string 0) nil nil
+                             case-fold-search))))))))))
+
+(defun search-tests--fold-search (string bound count)
+  "Search for STRING like `search-forward', comparing canonical characters.
+Search backward to BOUND if COUNT is negative.  Return the beginning
+and end of the COUNTth match, or nil."
+  (let* ((canon (char-table-extra-slot (current-case-table) 1))
+         (fold (lambda (c) (or (aref canon c) c)))
+         (len (length string))
+         (pos (point))
+         (match nil))
+    (while (and (/= count 0)
+                (if (> count 0) (<= (+ pos len) bound) (>= (- pos len) bound)))
+      (let ((beg (if (> count 0) pos (- pos len))))
+        (if (let ((i 0))
+              (while (and (< i len)
+                          (eq (funcall fold (char-after (+ beg i)))
+                              (funcall fold (aref string i))))
+                (setq i (1+ i)))
+              (= i len))
+            (setq match (list beg (+ beg len))
+                  pos (if (> count 0) (+ beg len) beg)
+                  count (if (> count 0) (1- count) (1+ count)))
+          (setq pos (if (> count 0) (1+ pos) (1- pos))))))
+    (and (= count 0) match)))
+
+(ert-deftest search-forward-case-fold-multibyte ()
+  (with-temp-buffer
+    (insert "Straße STRASSE straẞe ΣΟΦΟΣ σοφος école ÉCOLE")
+    (let ((case-fold-search t))
+      (goto-char (point-min))
+      (should (= (search-forward "STRAßE") 7))
+      (should (= (search-forward "straße") 22))
+      (should (= (match-beginning 0) 16))
+      (should (= (search-forward "σοφοσ") 28))
+      (should (= (search-forward "σοφοσ") 34))
+      (should (= (search-forward "ÉCOLE" nil nil 2) 46))
+      (should (= (search-backward "école") 41))
+      (should (= (search-backward "STRASSE" nil t) 8))
+      (should-not (search-backward "straße" 2 t)))
+    (let ((case-fold-search nil))
+      (goto-char (point-min))
+      (should-not (search-forward "STRAßE" nil t)))))
+
+(ert-deftest search-forward-case-fold-multibyte-random ()
+  "Compare `search-forward' with case folding to a simple search."
+  (random "search-forward-case-fold")
+  (with-temp-buffer
+    (let ((letters "aAbßẞkKKsSſΣσςéÉàაx")
+          (case-fold-search t))
+      (dotimes (_ 300)
+        (let* ((word (lambda (max)
+                       (let ((s (make-string (random max) ?a t)))
+                         (dotimes (i (length s))
+                           (aset s i (aref letters (random (length letters)))))
+                         s)))
+               (string (funcall word 5))
+               (count (* (if (zerop (random 2)) 1 -1) (1+ (random 2)))))
+          (erase-buffer)
+          (insert (funcall word 200))
+          ;; Put the gap somewhere in the text.
+          (goto-char (1+ (random (point-max))))
+          (insert "x")
+          (delete-char -1)
+          (unless (string= string "")
+            (let* ((from (1+ (random (point-max))))
+                   (bound (1+ (random (point-max))))
+                   (bound (if (> count 0) (max from bound) (min from bound))))
+              (goto-char from)
+              (let ((expected (search-tests--fold-search string bound count))
+                    (found (progn
+                             (goto-char from)
+                             (search-forward string bound t count))))
+                (should (equal (list string from count
+                                     (and found (list (match-beginning 0)
+                                                     (match-end 0))))
+                               (list string from count expected)))))))))))
+
+(defun search-tests--all-matches (regexp start end)
+  "Return the matches for REGEXP between START and END, one by one."
+  (let ((matches nil)
+        (looping t))
+    (save-excursion
+      (goto-char start)
+      (while (and looping (re-search-forward regexp end t))
+        (push (match-beginning 0) matches)
+        (push (match-end 0) matches)
+        (when (= (match-beginning 0) (match-end 0))
+          (if (= (point) end)
+              (setq looping nil)
+            (forward-char 1)))))
+    (vconcat (nreverse matches))))
+
+(ert-deftest search-all-matches-basic ()
+  (with-temp-buffer
+    (insert "foo bar Foo baz foo")
+    (goto-char 5)
+    (set-match-data '(1 2))
+    (let ((case-fold-search t))
+      (should (equal (search-all-matches "fo*") [1 4 9 12 17 20]))
+      (should (equal (search-all-matches "fo*" 2 19) [9 12 17 19]))
+      (should (equal (search-all-matches "fo*" 19 2) [9 12 17 19]))
+      (should (equal (search-all-matches "fo*" nil nil 2) [1 4 9 12]))
+      (should (equal (search-all-matches "fo*" nil nil 0) [])))
+    (let ((case-fold-search nil))
+      (should (equal (search-all-matches "fo*") [1 4 17 20]))
+      (should (equal (search-all-matches "x") [])))
+    ;; Empty matches, and a match right after a non-empty one.
+    (should (equal (search-all-matches "o*" 1 5) [1 1 2 4 4 4 5 5]))
+    ;; Neither point nor the match data change.
+    (should (= (point) 5))
+    (should (equal (match-data t) '(1 2)))
+    (should-error (search-all-matches "fo*" 0) :type 'args-out-of-range)
+    (should-error (search-all-matches "\\(") :type 'invalid-regexp)
+    (narrow-to-region 3 18)
+    (should (equal (search-all-matches "\\bf") [9 10 17 18]))
+    (should (equal (search-all-matches "\\`.\\|.\\'") [3 4 17 18]))))
+
+(ert-deftest search-all-matches-random ()
+  "Compare `search-all-matches' with a loop of `re-search-forward'."
+  (random "search-all-matches")
+  (with-temp-buffer
+    (dotimes (_ 200)
+      (let ((regexp (nth (random 8) '("a" "ab*" "b*" "\\(ab\\)+\\|c"
+                                      "^a\\|c$" "\\bab" "[é-ü]+" "é?")))
+            (case-fold-search (zerop (random 2))))
+        (erase-buffer)
+        (set-buffer-multibyte t)
+        (dotimes (_ (random 60))
+          (insert (aref "abcABé\n " (random 8))))
+        (when (zerop (random 4))
+          (set-buffer-multibyte nil))
+        (let* ((start (1+ (random (point-max))))
+               (end (+ start (random (- (point-max) start -1)))))
+          (should (equal (cons regexp (search-all-matches regexp start end))
+                         (cons regexp (search-tests--all-matches
+                                       regexp start end)))))))))
+
+(defun search-tests--replace-loop (regexp replacement start end
+                                          &optional fixedcase literal)
+  "Replace REGEXP with REPLACEMENT from START to END, one match at a time."
+  (save-excursion
+    (let ((end (copy-marker end))
+          (n 0)
+          (looping t))
+      (goto-char start)
+      (while (and looping (re-search-forward regexp end t))
+        (let ((empty (= (match-beginning 0) (match-end 0))))
+          (replace-match replacement fixedcase literal)
+          (setq n (1+ n))
+          (when empty
+            (if (>= (point) end)
+                (setq looping nil)
+              (forward-char 1)))))
+      (and (> n 0) n))))
+
+(ert-deftest replace-regexp-in-region-basic ()
+  (with-temp-buffer
+    (insert "Foo foo FOO bar")
+    (goto-char 3)
+    (should (= (replace-regexp-in-region "fo\\(o\\)" "x\\1y") 2))
+    (should (equal (buffer-string) "Foo xoy XOY bar"))
+    (should (= (point) 3))
+    (should (equal (list (match-beginning 0) (match-end 0)) '(9 12)))
+    (should-not (replace-regexp-in-region "foo" "x" 3))
+    (should (= (replace-regexp-in-region "o" "\\&\\&" 1 5 t) 2))
+    (should (equal (buffer-string) "Foooo xoy XOY bar"))
+    (should (= (replace-regexp-in-region "X\\|b" "\\&?" 11 nil nil t) 2))
+    (should (equal (buffer-string) "Foooo xoy \\&?OY \\&?ar"))
+    ;; An error leaves the text as it was.
+    (should-error (replace-regexp-in-region "o" "\\x" 1))
+    (should (equal (buffer-string) "Foooo xoy \\&?OY \\&?ar"))
+    (should-error (replace-regexp-in-region "o" "x" 0) :type 'args-out-of-range)
+    ;; Empty matches.
+    (erase-buffer)
+    (insert "ab")
+    (should (= (replace-regexp-in-region "x*" "-" 1) 3))
+    (should (equal (buffer-string) "-a-b-"))))
+
+(ert-deftest replace-regexp-in-region-change ()
+  "Check that the replacement counts as a single change."
+  (with-temp-buffer
+    (buffer-enable-undo)
+    (insert "Foo foo FOO bar foo")
+    (undo-boundary)
+    (set-buffer-modified-p nil)
+    (let ((changes nil)
+          (marker (copy-marker 13)))
+      (add-hook 'before-change-functions
+                (lambda (beg end) (push (list beg end) changes)) nil t)
+      (add-hook 'after-change-functions
+                (lambda (beg end len) (push (list beg end len) changes))
+                nil t)
+      (should (= (replace-regexp-in-region "foo" "quux" 2 17) 2))
+      (should (equal (buffer-string) "Foo quux QUUX bar foo"))
+      (should (equal changes '((5 19 12) (5 17))))
+      (should (= marker 15))
+      (undo-boundary)
+      (primitive-undo 1 (cdr buffer-undo-list))
+      (should (equal (buffer-string) "Foo foo FOO bar foo"))
+      (should-not (buffer-modified-p)))))
+
+(ert-deftest replace-regexp-in-region-random ()
+  "Compare `replace-regexp-in-region' with a loop of `replace-match'."
+  (random "replace-regexp-in-region")
+  (dotimes (_ 200)
+    (let* ((regexp (nth (random 6) '("a" "ab*" "b*" "\\(a\\)\\(b\\)?" "\\bab"
+                                     "[é-ü]+")))
+           (replacement (nth (random 5) '("" "x" "\\&\\&" "<\\1>" "Éé")))
+           (fixedcase (zerop (random 2)))
+           (literal (zerop (random 3)))
+           (case-fold-search (zerop (random 2)))
+           (text (let ((s (make-string (random 40) ?a)))
+                   (dotimes (i (length s))
+                     (aset s i (aref "abcABé\n " (random 8))))
+                   s))
+           (start (1+ (random (1+ (length text)))))
+           (end (+ start (random (- (length text) start -2))))
+           (results
+            (mapcar (lambda (replace)
+                      (with-temp-buffer
+                        (insert text)
+                        (list (condition-case nil
+                                  (funcall replace regexp replacement
+                                           start end fixedcase literal)
+                                (error 'error))
+                              (buffer-string))))
+                    (list #'replace-regexp-in-region
+                          #'search-tests--replace-loop))))
+      (should (equal (cons regexp (car results))
+                     (cons regexp (cadr results)))))))
+
+;; Regexp profiling.
+
+(ert-deftest regexp-profile-data ()
+  "Check the costs counted for each regexp."
+  (regexp-profile-data t)
+  (with-temp-buffer
+    (insert (make-string 200 ?a) "b")
+    (let ((regexp-profile t))
+      (dotimes (_ 3)
+        (goto-char (point-min))
+        (should (re-search-forward "a*b" nil t)))
+      (should (string-match "a\\(c\\)?" "xa"))
+      (should-not (looking-at "a\\(c\\)?")))
+    ;; Not counted.
+    (should (string-match "a\\(d\\)?" "xa")))
+  (let ((data (regexp-profile-data t)))
+    (should (= (length data) 2))
+    (pcase-let ((`(,calls ,bytes ,pushes ,stack ,time)
+                 (cdr (assoc "a*b" data))))
+      (should (= calls 3))
+      (should (= bytes (* 3 201)))
+      (should (> pushes 0))
+      (should (> stack 0))
+      (should (floatp time)))
+    (should (= (nth 1 (assoc "a\\(c\\)?" data)) 2)))
+  (should-not (regexp-profile-data)))
+
+;; The cache of compiled regexps.
+
+(ert-deftest regexp-cache-stats ()
+  "Check that regexps used in turn stay in a cache of sufficient size."
+  (let ((regexps (mapcar (lambda (i) (format "x\\(%d\\)\\b" i))
+                         (number-sequence 1 50))))
+    (with-temp-buffer
+      (insert "x17 x42")
+      (let ((regexp-cache-size 60))
+        (dolist (regexp regexps) (string-match regexp "x1"))
+        (regexp-cache-stats t)
+        (dotimes (_ 3)
+          (dolist (regexp regexps)
+            (goto-char (point-min))
+            (should (eq (re-search-forward regexp nil t)
+                        (cdr (assoc regexp '(("x\\(17\\)\\b" . 4)
+                                             ("x\\(42\\)\\b" . 8))))))))
+        (let ((stats (regexp-cache-stats t)))
+          (should (= (cdr (assq 'hits stats)) 150))
+          (should (= (cdr (assq 'misses stats)) 0))
+          (should (<= (cdr (assq 'entries stats)) 60))))
+      ;; A smaller cache evicts regexps used in turn.
+      (let ((regexp-cache-size 10))
+        (dotimes (_ 2)
+          (dolist (regexp regexps) (string-match (concat "y" regexp) "x1")))
+        (let ((stats (regexp-cache-stats)))
+          (should (= (cdr (assq 'misses stats)) 100))
+          (should (<= (cdr (assq 'entries stats)) 10))
+          (should (floatp (cdr (assq 'compile-time stats)))))))))
+
+;;; search-tests.el ends here
@@ -82,4 +82,86 @@ parse-partial-sexp-paren-comments
       (should (equal (parse-partial-sexp pointC pointX nil nil ppsC)
                      ppsX)))))
 
+;;; Parse state checkpoints.
+
+(defun syntax-tests--ppss-sans-2-6 (ppss)
+  "Return PPSS without its elements 2 and 6."
+  (let ((ppss (copy-sequence ppss)))
+    (setf (nth 2 ppss) nil (nth 6 ppss) nil)
+    ppss))
+
+(defun syntax-tests--check-checkpoints (positions)
+  "Check parse states at POSITIONS with and without checkpoints."
+  (dolist (pos positions)
+    (should (equal (syntax-tests--ppss-sans-2-6
+                    (let ((parse-sexp-use-checkpoints t))
+                      (parse-partial-sexp (point-min) pos)))
+                   (syntax-tests--ppss-sans-2-6
+                    (parse-partial-sexp (point-min) pos))))))
+
+(ert-deftest parse-partial-sexp-checkpoints ()
+  "Check that recorded parse states are discarded when needed."
+  (with-temp-buffer
+    (emacs-lisp-mode)
+    (let ((chunks ["(" ")" "\"" "\\" ";; c\n" "\n" "?\\(" "a " "#|" "|#"])
+          (positions nil))
+      (random "syntax-tests")
+      (dotimes (_ 30000)
+        (insert (aref chunks (random (length chunks)))))
+      (dotimes (_ 50)
+        (push (1+ (random (buffer-size))) positions))
+      (setq positions (sort positions #'<))
+      (setq-local parse-sexp-lookup-properties t)
+      (syntax-tests--check-checkpoints positions)
+      (dotimes (i 30)
+        (let ((pos (1+ (random (buffer-size)))))
+          (pcase (% i 3)
+            (0 (goto-char pos) (insert "\""))
+            (1 (delete-region pos (min (point-max) (+ pos 3))))
+            (2 (put-text-property pos (1+ pos) 'syntax-table
+                                  (string-to-syntax "\"")))))
+        (setq positions (mapcar (lambda (pos) (min pos (point-max)))
+                                positions))
+        (syntax-tests--check-checkpoints positions))
+      (let ((parse-sexp-lookup-properties nil))
+        (syntax-tests--check-checkpoints positions))
+      ;; Changes to the syntax table.
+      (modify-syntax-entry ?\; "." (syntax-table))
+      (syntax-tests--check-checkpoints positions)
+      (with-syntax-table (make-syntax-table)
+        (syntax-tests--check-checkpoints positions))
+      ;; Narrowing.
+      (narrow-to-region (/ (point-max) 3) (point-max))
+      (syntax-tests--check-checkpoints
+       (mapcar (lambda (pos) (max pos (point-min))) positions)))))
+
+(ert-deftest parse-partial-sexp-checkpoints-indirect ()
+  "Check recorded parse states in an indirect buffer and its base."
+  (with-temp-buffer
+    (emacs-lisp-mode)
+    (random "syntax-tests-indirect")
+    (dotimes (i 3000)
+      (insert (if (zerop (% i 7)) "\"(\" " "(a ;; b\n") ")\n"))
+    (let ((base (current-buffer))
+          (indirect (make-indirect-buffer (current-buffer)
+                                          " *syntax-tests*")))
+      (unwind-protect
+          (let ((positions nil))
+            (dotimes (_ 30)
+              (push (1+ (random (buffer-size))) positions))
+            (setq positions (sort positions #'<))
+            (with-current-buffer indirect
+              (set-syntax-table (make-syntax-table))
+              (narrow-to-region 1000 (point-max)))
+            (dotimes (i 20)
+              (syntax-tests--check-checkpoints positions)
+              (with-current-buffer indirect
+                (syntax-tests--check-checkpoints
+                 (mapcar (lambda (pos) (max pos (point-min))) positions)))
+              (with-current-buffer (if (zerop (% i 2)) base indirect)
+                (goto-char (+ 1000 (random (- (point-max) 1000))))
+                (insert (if (zerop (% i 3)) "\"" "(;"))))
+            (syntax-tests--check-checkpoints positions))
+        (kill-buffer indirect)))))
+
 ;;; syntax-tests.el ends here